@@ -22,24 +22,120 @@ SOFTWARE.
 
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
+#include <cstring>
+#include <limits>
 #include <system_error>
 #include <type_traits>
+#include <utility>
+
+#if defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+// Everything except plain data types is declared in an inline namespace
+// named after the SIMD instruction set the translation unit is compiled
+// for. Translation units built with different -m flags, such as the kernels
+// of the CharConvDispatch library, then never share an inline function with
+// different code, which would violate the ODR.
+#if defined(__AVX2__)
+#define RIGTORP_CHARCONV_ISA_NAMESPACE isa_avx2
+#elif defined(__SSE4_1__)
+#define RIGTORP_CHARCONV_ISA_NAMESPACE isa_sse41
+#else
+#define RIGTORP_CHARCONV_ISA_NAMESPACE isa_generic
+#endif
 
 namespace rigtorp {
 
-struct to_chars_result {
-  char *ptr;
+// Results of conversions to and from buffers of CharT code units.
+template <typename CharT> struct basic_to_chars_result {
+  CharT *ptr;
+  std::errc ec;
+};
+
+template <typename CharT> struct basic_from_chars_result {
+  const CharT *ptr;
   std::errc ec;
 };
 
-struct from_chars_result {
+using to_chars_result = basic_to_chars_result<char>;
+using from_chars_result = basic_from_chars_result<char>;
+
+struct from_chars_many_result {
   const char *ptr;
   std::errc ec;
+  size_t count;
+};
+
+struct from_chars_file_result {
+  size_t offset;
+  std::errc ec;
+  size_t count;
+};
+
+// Options for from_chars_prefix, combined with bitwise or.
+enum prefix_options : unsigned {
+  // Accept a leading '+' as well as '-' for signed types.
+  allow_plus = 1,
+  // Skip leading whitespace as defined by isspace.
+  skip_whitespace = 2,
+};
+
+// Rounding policies for from_chars_decimal. Given the first digit beyond the
+// scale, whether any later digit is non-zero and whether the last kept digit
+// is odd, round_up returns true if the magnitude should be incremented.
+
+// Discards the extra digits.
+struct round_toward_zero {
+  static constexpr bool round_up(unsigned, bool, bool) noexcept {
+    return false;
+  }
+};
+
+// Rounds to nearest, ties away from zero.
+struct round_half_away_from_zero {
+  static constexpr bool round_up(unsigned digit, bool, bool) noexcept {
+    return digit >= 5;
+  }
+};
+
+// Rounds to nearest, ties to even.
+struct round_half_to_even {
+  static constexpr bool round_up(unsigned digit, bool sticky,
+                                 bool odd) noexcept {
+    return digit > 5 || (digit == 5 && (sticky || odd));
+  }
 };
 
+inline namespace RIGTORP_CHARCONV_ISA_NAMESPACE {
+
 namespace detail {
 
+__extension__ typedef __int128 int128_t;
+__extension__ typedef unsigned __int128 uint128_t;
+
+// The standard type traits only recognize the 128-bit integer types in GNU
+// mode, so the integer conversions use these instead.
+template <typename T> struct is_integral : std::is_integral<T> {};
+template <> struct is_integral<int128_t> : std::true_type {};
+template <> struct is_integral<uint128_t> : std::true_type {};
+
+template <typename T> struct is_signed : std::is_signed<T> {};
+template <> struct is_signed<int128_t> : std::true_type {};
+template <> struct is_signed<uint128_t> : std::false_type {};
+
+template <typename T> struct is_unsigned : std::is_unsigned<T> {};
+template <> struct is_unsigned<int128_t> : std::false_type {};
+template <> struct is_unsigned<uint128_t> : std::true_type {};
+
+template <typename T> struct make_unsigned : std::make_unsigned<T> {};
+template <> struct make_unsigned<int128_t> { using type = uint128_t; };
+template <> struct make_unsigned<uint128_t> { using type = uint128_t; };
+
+template <typename T> using make_unsigned_t = typename make_unsigned<T>::type;
+
 static constexpr uint32_t powers_of_10_32[] = {
     UINT32_C(0),          UINT32_C(10),       UINT32_C(100),
     UINT32_C(1000),       UINT32_C(10000),    UINT32_C(100000),
@@ -70,29 +166,356 @@ static constexpr uint64_t powers_of_10_64[] = {
     UINT64_C(10000000000000000000),
 };
 
+struct powers_of_10_128_table {
+  uint128_t values[39];
+};
+
+constexpr powers_of_10_128_table make_powers_of_10_128() noexcept {
+  powers_of_10_128_table t = {};
+  uint128_t p = 1;
+  for (int i = 1; i < 39; ++i) {
+    p *= 10;
+    t.values[i] = p;
+  }
+  return t;
+}
+
+static constexpr powers_of_10_128_table powers_of_10_128 =
+    make_powers_of_10_128();
+
 template <typename T> constexpr unsigned to_chars_len(T value) noexcept {
-  static_assert(std::is_unsigned<T>::value);
+  static_assert(is_unsigned<T>::value);
   static_assert(std::numeric_limits<unsigned>::max() >=
                 std::numeric_limits<T>::digits);
   if constexpr (sizeof(T) <= sizeof(int)) {
     static_assert(sizeof(int) == 4);
     const unsigned t = (32 - __builtin_clz(value | 1)) * 1233 >> 12;
     return t - (value < powers_of_10_32[t]) + 1;
-  } else {
-    static_assert(sizeof(T) <= sizeof(long long));
+  } else if constexpr (sizeof(T) <= sizeof(long long)) {
     static_assert(sizeof(long long) == 8);
     const unsigned t = (64 - __builtin_clzll(value | 1)) * 1233 >> 12;
     return t - (value < powers_of_10_64[t]) + 1;
+  } else {
+    static_assert(sizeof(T) == 16);
+    const uint64_t hi = static_cast<uint64_t>(value >> 64);
+    if (hi == 0) {
+      return to_chars_len(static_cast<uint64_t>(value));
+    }
+    const unsigned t = (128 - __builtin_clzll(hi)) * 1233 >> 12;
+    return t - (value < powers_of_10_128.values[t]) + 1;
   }
 }
 
-template <typename T>
+static constexpr char digit_pairs[] =
+    "0001020304050607080910111213141516171819"
+    "2021222324252627282930313233343536373839"
+    "4041424344454647484950515253545556575859"
+    "6061626364656667686970717273747576777879"
+    "8081828384858687888990919293949596979899";
+
+constexpr char *write_digit_pair(char *last, uint32_t value) noexcept {
+  last -= 2;
+  last[0] = digit_pairs[2 * value];
+  last[1] = digit_pairs[2 * value + 1];
+  return last;
+}
+
+// Writes exactly 8 digits (zero padded) of value < 10^8 ending at last.
+constexpr char *write_8_digits(char *last, uint32_t value) noexcept {
+  const uint32_t hi = value / 10000;
+  const uint32_t lo = value - hi * 10000;
+  last = write_digit_pair(last, lo % 100);
+  last = write_digit_pair(last, lo / 100);
+  last = write_digit_pair(last, hi % 100);
+  return write_digit_pair(last, hi / 100);
+}
+
+// Writes exactly the N least significant digits of value ending at last.
+template <unsigned N, typename T>
+constexpr void write_fixed_digits(char *last, T value) noexcept {
+  static_assert(std::is_unsigned<T>::value);
+  if constexpr (N >= 8) {
+    const T q = value / 100000000;
+    write_8_digits(last, static_cast<uint32_t>(value - q * 100000000));
+    write_fixed_digits<N - 8>(last - 8, q);
+  } else if constexpr (N >= 2) {
+    const T q = value / 100;
+    write_digit_pair(last, static_cast<uint32_t>(value - q * 100));
+    write_fixed_digits<N - 2>(last - 2, q);
+  } else if constexpr (N == 1) {
+    last[-1] = static_cast<char>('0' + value % 10);
+  }
+}
+
+// Returns value / 10^19 and stores value % 10^19 in rem. The high word is
+// reduced first so that the rest is a single 128-by-64 bit division with a
+// 64-bit quotient, which x86-64 does in one instruction.
+inline uint128_t divmod_10_19(uint128_t value, uint64_t &rem) noexcept {
+  constexpr uint64_t d = UINT64_C(10000000000000000000);
+  const uint64_t hi = static_cast<uint64_t>(value >> 64);
+  const uint64_t lo = static_cast<uint64_t>(value);
+  const uint64_t qhi = hi >= d;
+  const uint64_t rhi = hi - qhi * d;
+  uint64_t qlo;
+#if defined(__x86_64__)
+  __asm__("divq %[d]" : "=a"(qlo), "=d"(rem) : [d] "r"(d), "a"(lo), "d"(rhi));
+#else
+  const uint128_t n = (uint128_t(rhi) << 64) | lo;
+  qlo = static_cast<uint64_t>(n / d);
+  rem = static_cast<uint64_t>(n - uint128_t(qlo) * d);
+#endif
+  return (uint128_t(qhi) << 64) | qlo;
+}
+
+// Digit writers write the decimal digits of an unsigned value backwards
+// ending at last and return a pointer to the first digit.
+
+// One digit per division by 10.
+struct single_digit_writer {
+  template <typename T>
+  static constexpr char *write(char *last, T value) noexcept {
+    static_assert(is_unsigned<T>::value);
+    while (value >= 10) {
+      const auto q = value / 10;
+      const auto r = value % 10;
+      *--last = r + '0';
+      value = q;
+    }
+    *--last = value + '0';
+    return last;
+  }
+};
+
+// Two digits per division by 100 using the digit_pairs table. 64-bit values
+// are split into 32-bit chunks at 10^8 so that the inner loop uses 32-bit
+// arithmetic. 128-bit values are first split into 64-bit chunks at 10^19.
+struct digit_pair_writer {
+  template <typename T>
+  static constexpr char *write(char *last, T value) noexcept {
+    static_assert(is_unsigned<T>::value);
+    if constexpr (sizeof(T) > sizeof(uint64_t)) {
+      while (value > std::numeric_limits<uint64_t>::max()) {
+        uint64_t r = 0;
+        if (__builtin_is_constant_evaluated()) {
+          const T q = value / UINT64_C(10000000000000000000);
+          r = static_cast<uint64_t>(value -
+                                    q * UINT64_C(10000000000000000000));
+          value = q;
+        } else {
+          value = divmod_10_19(value, r);
+        }
+        write_fixed_digits<19>(last, r);
+        last -= 19;
+      }
+      return write(last, static_cast<uint64_t>(value));
+    } else if constexpr (sizeof(T) > sizeof(uint32_t)) {
+      while (value >= 100000000) {
+        const T q = value / 100000000;
+        last =
+            write_8_digits(last, static_cast<uint32_t>(value - q * 100000000));
+        value = q;
+      }
+    }
+    uint32_t v = static_cast<uint32_t>(value);
+    while (v >= 100) {
+      const uint32_t q = v / 100;
+      last = write_digit_pair(last, v - q * 100);
+      v = q;
+    }
+    if (v >= 10) {
+      return write_digit_pair(last, v);
+    }
+    *--last = v + '0';
+    return last;
+  }
+};
+
+// Digits by fixed-point multiplication without lookup tables, in the style
+// of jeaiii's itoa, for callers where the tables are likely not in cache.
+// The length is found with a tree of comparisons against constants. A value
+// v of N <= 9 digits is then scaled to t = v * ceil(2^57 / 10^K), a
+// fixed-point number whose integer part holds the leading 1 or 2 digits,
+// and the remaining K digits are extracted two at a time by multiplying the
+// 57-bit fraction by 100. The reciprocal is rounded up by less than
+// 10^N / 2^57 <= 10^-K, so every digit is exact. Wider values are split at
+// 10^8 and 10^19 with divisions by constants.
+struct multiply_shift_writer {
+  static constexpr unsigned shift = 57;
+  static constexpr uint64_t mask = (uint64_t(1) << shift) - 1;
+
+  static constexpr uint64_t pow10(unsigned n) noexcept {
+    uint64_t p = 1;
+    while (n-- > 0) {
+      p *= 10;
+    }
+    return p;
+  }
+
+  // Writes pair < 100 as two digits, dividing by 10 as (pair * 103) >> 10.
+  static constexpr char *write_pair(char *first, uint32_t pair) noexcept {
+    const uint32_t hi = (pair * 103) >> 10;
+    first[0] = char('0' + hi);
+    first[1] = char('0' + pair - hi * 10);
+    return first + 2;
+  }
+
+  // Writes exactly the N digits of value < 10^N starting at first.
+  template <unsigned N>
+  static constexpr char *write_digits(char *first, uint32_t value) noexcept {
+    static_assert(N >= 1 && N <= 9);
+    constexpr unsigned lead = 2 - N % 2;
+    constexpr uint64_t m = (uint64_t(1) << shift) / pow10(N - lead) + 1;
+    uint64_t t = value * m;
+    if constexpr (lead == 1) {
+      *first++ = char('0' + (t >> shift));
+    } else {
+      first = write_pair(first, uint32_t(t >> shift));
+    }
+    for (unsigned i = lead; i < N; i += 2) {
+      t = (t & mask) * 100;
+      first = write_pair(first, uint32_t(t >> shift));
+    }
+    return first;
+  }
+
+  // Writes the 19 digits of value < 10^19 starting at first.
+  static constexpr char *write_19_digits(char *first, uint64_t value) noexcept {
+    const uint64_t q = value / UINT64_C(10000000000000000);
+    const uint64_t r = value - q * UINT64_C(10000000000000000);
+    const uint64_t mid = r / 100000000;
+    first = write_digits<3>(first, uint32_t(q));
+    first = write_digits<8>(first, uint32_t(mid));
+    return write_digits<8>(first, uint32_t(r - mid * 100000000));
+  }
+
+  static constexpr unsigned len(uint32_t value) noexcept {
+    if (value < 10000) {
+      if (value < 100) {
+        return value < 10 ? 1 : 2;
+      }
+      return value < 1000 ? 3 : 4;
+    }
+    if (value < 100000000) {
+      if (value < 1000000) {
+        return value < 100000 ? 5 : 6;
+      }
+      return value < 10000000 ? 7 : 8;
+    }
+    return value < 1000000000 ? 9 : 10;
+  }
+
+  static constexpr unsigned len(uint64_t value) noexcept {
+    if (value <= UINT32_MAX) {
+      return len(uint32_t(value));
+    }
+    const uint64_t q = value / 100000000;
+    if (q <= UINT32_MAX) {
+      return 8 + len(uint32_t(q));
+    }
+    return 16 + len(uint32_t(q / 100000000));
+  }
+
+  static constexpr unsigned len(uint128_t value) noexcept {
+    if (value <= UINT64_MAX) {
+      return len(uint64_t(value));
+    }
+    return 19 + len(uint64_t(value / UINT64_C(10000000000000000000)));
+  }
+
+  static constexpr char *write_forward(char *first, uint32_t value) noexcept {
+    if (value < 10000) {
+      if (value < 100) {
+        return value < 10 ? write_digits<1>(first, value)
+                          : write_digits<2>(first, value);
+      }
+      return value < 1000 ? write_digits<3>(first, value)
+                          : write_digits<4>(first, value);
+    }
+    if (value < 100000000) {
+      if (value < 1000000) {
+        return value < 100000 ? write_digits<5>(first, value)
+                              : write_digits<6>(first, value);
+      }
+      return value < 10000000 ? write_digits<7>(first, value)
+                              : write_digits<8>(first, value);
+    }
+    if (value < 1000000000) {
+      return write_digits<9>(first, value);
+    }
+    const uint32_t hi = value / 100000000;
+    return write_digits<8>(write_pair(first, hi), value - hi * 100000000);
+  }
+
+  static constexpr char *write_forward(char *first, uint64_t value) noexcept {
+    if (value <= UINT32_MAX) {
+      return write_forward(first, uint32_t(value));
+    }
+    const uint64_t q = value / 100000000;
+    const uint32_t r = uint32_t(value - q * 100000000);
+    if (q <= UINT32_MAX) {
+      first = write_forward(first, uint32_t(q));
+    } else {
+      const uint32_t hi = uint32_t(q / 100000000);
+      first = write_forward(first, hi);
+      first = write_digits<8>(first, uint32_t(q - uint64_t(hi) * 100000000));
+    }
+    return write_digits<8>(first, r);
+  }
+
+  static constexpr char *write_forward(char *first, uint128_t value) noexcept {
+    if (value <= UINT64_MAX) {
+      return write_forward(first, uint64_t(value));
+    }
+    constexpr uint64_t e19 = UINT64_C(10000000000000000000);
+    uint64_t lo = 0;
+    uint128_t q = 0;
+    if (__builtin_is_constant_evaluated()) {
+      q = value / e19;
+      lo = static_cast<uint64_t>(value - q * e19);
+    } else {
+      q = divmod_10_19(value, lo);
+    }
+    if (q <= UINT64_MAX) {
+      first = write_forward(first, uint64_t(q));
+    } else {
+      const uint64_t hi = static_cast<uint64_t>(q / e19);
+      first = write_forward(first, hi);
+      first = write_19_digits(first, static_cast<uint64_t>(q - hi * e19));
+    }
+    return write_19_digits(first, lo);
+  }
+
+  template <typename T>
+  static constexpr char *write(char *last, T value) noexcept {
+    static_assert(is_unsigned<T>::value);
+    if constexpr (sizeof(T) < sizeof(uint32_t)) {
+      return write(last, uint32_t(value));
+    } else {
+      char *first = last - len(value);
+      write_forward(first, value);
+      return first;
+    }
+  }
+};
+
+// Writers with write_forward write the digits from the front, finding the
+// length on the way.
+template <typename Writer, typename = void>
+struct has_write_forward : std::false_type {};
+
+template <typename Writer>
+struct has_write_forward<Writer,
+                         std::void_t<decltype(Writer::write_forward(
+                             std::declval<char *>(), uint32_t()))>>
+    : std::true_type {};
+
+template <typename T, typename Writer = digit_pair_writer>
 constexpr to_chars_result to_chars(char *first, char *last, T value) noexcept {
-  static_assert(std::is_integral<T>::value);
-  using UT = std::make_unsigned_t<T>;
+  static_assert(is_integral<T>::value);
+  using UT = make_unsigned_t<T>;
   static_assert(sizeof(UT) == sizeof(T));
   UT uvalue = value;
-  if constexpr (std::is_signed<T>::value) {
+  if constexpr (is_signed<T>::value) {
     if (value < 0) {
       if (__builtin_expect(first != last, 1)) {
         *first++ = '-';
@@ -100,27 +523,225 @@ constexpr to_chars_result to_chars(char *first, char *last, T value) noexcept {
       }
     }
   }
-  const auto len = to_chars_len(uvalue);
-  if (__builtin_expect(last - first < len, 0)) {
-    return {last, std::errc::value_too_large};
+  if constexpr (has_write_forward<Writer>::value) {
+    // The length is only needed if the buffer may be too small.
+    constexpr unsigned max_len = Writer::len(UT(~UT(0)));
+    if (__builtin_expect(last - first < max_len, 0) &&
+        last - first < Writer::len(uvalue)) {
+      return {last, std::errc::value_too_large};
+    }
+    return {Writer::write_forward(first, uvalue), {}};
+  } else {
+    const auto len = to_chars_len(uvalue);
+    if (__builtin_expect(last - first < len, 0)) {
+      return {last, std::errc::value_too_large};
+    }
+    Writer::write(first + len, uvalue);
+    return {first + len, {}};
+  }
+}
+
+// Writes value ending at last without computing its length first and
+// returns a pointer to the first character.
+template <typename T, typename Writer = digit_pair_writer>
+constexpr char *to_chars_backward(char *last, T value) noexcept {
+  static_assert(is_integral<T>::value);
+  using UT = make_unsigned_t<T>;
+  static_assert(sizeof(UT) == sizeof(T));
+  UT uvalue = value;
+  if constexpr (is_signed<T>::value) {
+    if (value < 0) {
+      uvalue = UT(~value) + UT(1);
+    }
   }
-  uint32_t pos = len - 1;
-  while (uvalue >= 10) {
-    const auto q = uvalue / 10;
-    const auto r = uvalue % 10;
-    first[pos--] = r + '0';
-    uvalue = q;
+  char *first = Writer::write(last, uvalue);
+  if constexpr (is_signed<T>::value) {
+    if (value < 0) {
+      *--first = '-';
+    }
   }
-  first[0] = uvalue + '0';
-  return {first + len, {}};
+  return first;
 }
 
-template <typename T>
-constexpr from_chars_result from_chars(const char *first, const char *last,
-                                       T &value) noexcept {
+template <unsigned N, typename T>
+constexpr to_chars_result to_chars_fixed(char *first, T value) noexcept {
   static_assert(std::is_integral<T>::value);
-  [[maybe_unused]] int sign = 1;
+  using UT = std::make_unsigned_t<T>;
+  static_assert(N >= 1 && N <= std::numeric_limits<UT>::digits10 + 1);
+  UT uvalue = value;
   if constexpr (std::is_signed<T>::value) {
+    if (value < 0) {
+      *first++ = '-';
+      uvalue = UT(~value) + UT(1);
+    }
+  }
+  write_fixed_digits<N>(first + N, uvalue);
+  if constexpr (N <= std::numeric_limits<UT>::digits10) {
+    if (__builtin_expect(uvalue >= powers_of_10_64[N], 0)) {
+      return {first + N, std::errc::value_too_large};
+    }
+  }
+  return {first + N, {}};
+}
+
+// Loads 8 characters into a uint64_t with the first character in the least
+// significant byte.
+inline uint64_t load_8_chars(const char *p) noexcept {
+  uint64_t v;
+  std::memcpy(&v, p, sizeof(v));
+#if __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+  v = __builtin_bswap64(v);
+#endif
+  return v;
+}
+
+// Returns true if all 8 characters loaded by load_8_chars are digits.
+constexpr bool is_8_digits(uint64_t v) noexcept {
+  const uint64_t hi = v & UINT64_C(0xF0F0F0F0F0F0F0F0);
+  const uint64_t lo =
+      ((v + UINT64_C(0x0606060606060606)) & UINT64_C(0xF0F0F0F0F0F0F0F0)) >> 4;
+  return (hi | lo) == UINT64_C(0x3333333333333333);
+}
+
+// Converts 8 digits loaded by load_8_chars to their value using 3
+// multiplications.
+constexpr uint32_t parse_8_digits(uint64_t v) noexcept {
+  constexpr uint64_t mask = UINT64_C(0x000000FF000000FF);
+  constexpr uint64_t mul1 = 100 + (UINT64_C(1000000) << 32);
+  constexpr uint64_t mul2 = 1 + (UINT64_C(10000) << 32);
+  v -= UINT64_C(0x3030303030303030);
+  v = (v * 10) + (v >> 8);
+  v = (((v & mask) * mul1) + (((v >> 16) & mask) * mul2)) >> 32;
+  return static_cast<uint32_t>(v);
+}
+
+// Loads 8 code units like load_8_chars. Code units above 0xFF saturate to
+// a byte that is not a digit, so is_8_digits on the result validates the
+// original code units. SSE2 narrows with saturating packs, after setting
+// 32-bit code units above 0xFF to all ones.
+template <typename CharT>
+inline uint64_t load_8_chars(const CharT *p) noexcept {
+  if constexpr (sizeof(CharT) == 1) {
+    return load_8_chars(reinterpret_cast<const char *>(p));
+  } else {
+#if defined(__SSE2__)
+    __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p));
+    if constexpr (sizeof(CharT) == 4) {
+      const __m128i limit = _mm_set1_epi32(0xFF);
+      __m128i hi = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p + 4));
+      v = _mm_or_si128(v, _mm_cmpgt_epi32(v, limit));
+      hi = _mm_or_si128(hi, _mm_cmpgt_epi32(hi, limit));
+      v = _mm_packs_epi32(v, hi);
+    }
+    uint64_t res;
+    _mm_storel_epi64(reinterpret_cast<__m128i *>(&res),
+                     _mm_packus_epi16(v, v));
+    return res;
+#else
+    uint64_t v = 0;
+    for (unsigned i = 0; i < 8; ++i) {
+      const auto c = std::make_unsigned_t<CharT>(p[i]);
+      v |= uint64_t(c > 0xFF ? 0xFF : c) << (8 * i);
+    }
+    return v;
+#endif
+  }
+}
+
+// Digit parsers accumulate the digits in [first, last) into the unsigned
+// value. On error the returned pointer points to the offending character. If
+// the offending character is not a digit value holds the digits before it.
+
+// One digit per step with overflow checks on every digit.
+struct scalar_digit_parser {
+  template <typename CharT, typename T>
+  static constexpr basic_from_chars_result<CharT>
+  parse(const CharT *first, const CharT *last, T &value) noexcept {
+    static_assert(is_unsigned<T>::value);
+    T res = value;
+    while (first != last) {
+      const unsigned c = unsigned(std::make_unsigned_t<CharT>(*first)) - '0';
+      if (__builtin_expect(c > 9, 0)) {
+        value = res;
+        return {first, std::errc::invalid_argument};
+      }
+      if (__builtin_expect(__builtin_mul_overflow(res, 10, &res), 0) ||
+          __builtin_expect(__builtin_add_overflow(res, c, &res), 0)) {
+        return {first, std::errc::result_out_of_range};
+      }
+      ++first;
+    }
+    value = res;
+    return {first, {}};
+  }
+};
+
+// Eight digits per step using SWAR validation and conversion. Loads never
+// extend past last; the remaining tail, and any 8 character block that is
+// not all digits or would overflow, is handled by scalar_digit_parser so
+// that errors are reported at exactly the same position. 128-bit values
+// accumulate blocks of up to 19 digits in 64-bit arithmetic and combine them
+// with one 128-bit multiply-add per block.
+struct swar_digit_parser {
+  template <typename CharT, typename T>
+  static constexpr basic_from_chars_result<CharT>
+  parse(const CharT *first, const CharT *last, T &value) noexcept {
+    static_assert(is_unsigned<T>::value);
+    if constexpr (sizeof(T) > sizeof(uint64_t)) {
+      T res = value;
+      while (first != last) {
+        const CharT *block_last = last - first > 19 ? first + 19 : last;
+        uint64_t block = 0;
+        const auto r = parse(first, block_last, block);
+        const auto n = r.ptr - first;
+        T tmp = 0;
+        if (n != 0 &&
+            (__builtin_expect(
+                 __builtin_mul_overflow(res, powers_of_10_64[n], &tmp), 0) ||
+             __builtin_expect(__builtin_add_overflow(tmp, block, &tmp), 0))) {
+          break;
+        }
+        res = n != 0 ? tmp : res;
+        if (r.ec != std::errc{}) {
+          value = res;
+          return r;
+        }
+        first = r.ptr;
+      }
+      value = res;
+      return scalar_digit_parser::parse(first, last, value);
+    }
+    if (!__builtin_is_constant_evaluated()) {
+      T res = value;
+      while (last - first >= 8) {
+        const uint64_t chunk = load_8_chars(first);
+        if (__builtin_expect(!is_8_digits(chunk), 0)) {
+          break;
+        }
+        T tmp = 0;
+        if (__builtin_expect(__builtin_mul_overflow(res, 100000000, &tmp),
+                             0) ||
+            __builtin_expect(
+                __builtin_add_overflow(tmp, parse_8_digits(chunk), &tmp), 0)) {
+          break;
+        }
+        res = tmp;
+        first += 8;
+      }
+      value = res;
+    }
+    return scalar_digit_parser::parse(first, last, value);
+  }
+};
+
+template <typename T, typename Parser = swar_digit_parser,
+          typename CharT = char>
+constexpr basic_from_chars_result<CharT>
+from_chars(const CharT *first, const CharT *last, T &value,
+           const Parser &parser = {}) noexcept {
+  static_assert(is_integral<T>::value);
+  [[maybe_unused]] int sign = 1;
+  if constexpr (is_signed<T>::value) {
     if (first != last && *first == '-') {
       sign = -1;
       ++first;
@@ -129,21 +750,15 @@ constexpr from_chars_result from_chars(const char *first, const char *last,
   if (__builtin_expect(first == last, 0)) {
     return {first, std::errc::invalid_argument};
   }
-  std::make_unsigned_t<T> res = 0;
+  make_unsigned_t<T> res = 0;
   static_assert(sizeof(res) == sizeof(T));
-  while (first != last) {
-    const uint8_t c = *first - '0';
-    if (__builtin_expect(c > 9, 0)) {
-      return {first, std::errc::invalid_argument};
-    }
-    if (__builtin_expect(__builtin_mul_overflow(res, 10, &res), 0) ||
-        __builtin_expect(__builtin_add_overflow(res, c, &res), 0)) {
-      return {first, std::errc::result_out_of_range};
-    }
-    ++first;
+  const auto r = parser.parse(first, last, res);
+  if (__builtin_expect(r.ec != std::errc{}, 0)) {
+    return r;
   }
-  if constexpr (std::is_signed<T>::value) {
-    T tmp;
+  first = r.ptr;
+  if constexpr (is_signed<T>::value) {
+    T tmp = 0;
     if (__builtin_expect(__builtin_mul_overflow(res, sign, &tmp), 0)) {
       return {first, std::errc::result_out_of_range};
     }
@@ -153,45 +768,3842 @@ constexpr from_chars_result from_chars(const char *first, const char *last,
   }
   return {first, {}};
 }
-} // namespace detail
 
-constexpr inline to_chars_result to_chars(char *first, char *last,
-                                          uint32_t value) noexcept {
-  return detail::to_chars(first, last, value);
+// Code unit types other than char that to_chars and from_chars accept.
+template <typename CharT> struct is_code_unit : std::false_type {};
+template <> struct is_code_unit<char16_t> : std::true_type {};
+template <> struct is_code_unit<char32_t> : std::true_type {};
+template <> struct is_code_unit<wchar_t> : std::true_type {};
+#if defined(__cpp_char8_t)
+template <> struct is_code_unit<char8_t> : std::true_type {};
+#endif
+
+template <typename CharT>
+using enable_if_code_unit_t = std::enable_if_t<is_code_unit<CharT>::value>;
+
+// Widens the n characters at src to code units at dst, 8 characters per
+// step by interleaving with zeros.
+template <typename CharT>
+inline void widen_chars(CharT *dst, const char *src, size_t n) noexcept {
+  if constexpr (sizeof(CharT) == 1) {
+    std::memcpy(dst, src, n);
+  } else {
+    size_t i = 0;
+#if defined(__SSE2__)
+    const __m128i zero = _mm_setzero_si128();
+    for (; i + 8 <= n; i += 8) {
+      const __m128i v = _mm_unpacklo_epi8(
+          _mm_loadl_epi64(reinterpret_cast<const __m128i *>(src + i)), zero);
+      __m128i *out = reinterpret_cast<__m128i *>(dst + i);
+      if constexpr (sizeof(CharT) == 2) {
+        _mm_storeu_si128(out, v);
+      } else {
+        _mm_storeu_si128(out, _mm_unpacklo_epi16(v, zero));
+        _mm_storeu_si128(out + 1, _mm_unpackhi_epi16(v, zero));
+      }
+    }
+#endif
+    for (; i < n; ++i) {
+      dst[i] = CharT(uint8_t(src[i]));
+    }
+  }
 }
 
-constexpr inline to_chars_result to_chars(char *first, char *last,
-                                          int32_t value) noexcept {
-  return detail::to_chars(first, last, value);
+// Writes value to a buffer of CharT code units. The at most 40 characters
+// are written to a char buffer by to_chars and then widened, so there is no
+// separate transcoding pass over the output.
+template <typename T, typename CharT>
+inline basic_to_chars_result<CharT>
+to_chars_code_units(CharT *first, CharT *last, T value) noexcept {
+  char buf[40];
+  const auto res = to_chars(buf, buf + sizeof(buf), value);
+  const size_t n = res.ptr - buf;
+  if (__builtin_expect(size_t(last - first) < n, 0)) {
+    return {last, std::errc::value_too_large};
+  }
+  widen_chars(first, buf, n);
+  return {first + n, {}};
 }
 
-constexpr inline to_chars_result to_chars(char *first, char *last,
-                                          uint64_t value) noexcept {
-  return detail::to_chars(first, last, value);
+constexpr bool is_space(char c) noexcept {
+  return c == ' ' || (c >= '\t' && c <= '\r');
 }
 
-constexpr inline to_chars_result to_chars(char *first, char *last,
-                                          int64_t value) noexcept {
-  return detail::to_chars(first, last, value);
+// Parses the longest prefix of [first, last) that is a number, like
+// std::from_chars, and returns a pointer to the first character after it.
+// If there is no number ptr is first and on overflow ptr points past all the
+// digits; in both cases value is unmodified.
+template <unsigned Options, typename T, typename Parser = swar_digit_parser>
+constexpr from_chars_result
+from_chars_prefix(const char *first, const char *last, T &value,
+                  const Parser &parser = {}) noexcept {
+  static_assert(is_integral<T>::value);
+  const char *const start = first;
+  if constexpr ((Options & skip_whitespace) != 0) {
+    while (first != last && is_space(*first)) {
+      ++first;
+    }
+  }
+  [[maybe_unused]] int sign = 1;
+  if constexpr (is_signed<T>::value) {
+    if (first != last && *first == '-') {
+      sign = -1;
+      ++first;
+    }
+  }
+  if constexpr ((Options & allow_plus) != 0) {
+    if (sign == 1 && first != last && *first == '+') {
+      ++first;
+    }
+  }
+  make_unsigned_t<T> res = 0;
+  static_assert(sizeof(res) == sizeof(T));
+  auto r = parser.parse(first, last, res);
+  if (__builtin_expect(r.ptr == first, 0)) {
+    return {start, std::errc::invalid_argument};
+  }
+  if (__builtin_expect(r.ec == std::errc::result_out_of_range, 0)) {
+    while (r.ptr != last && uint8_t(*r.ptr - '0') <= 9) {
+      ++r.ptr;
+    }
+    return r;
+  }
+  if constexpr (is_signed<T>::value) {
+    T tmp = 0;
+    if (__builtin_expect(__builtin_mul_overflow(res, sign, &tmp), 0)) {
+      return {r.ptr, std::errc::result_out_of_range};
+    }
+    value = tmp;
+  } else {
+    value = res;
+  }
+  return {r.ptr, {}};
 }
 
-constexpr inline from_chars_result
-from_chars(const char *first, const char *last, uint32_t &value) noexcept {
-  return detail::from_chars(first, last, value);
+// Loads N <= 8 characters like load_8_chars, padded on the left with '0'.
+// Lengths that are not a power of two use two overlapping loads to avoid a
+// store forwarding stall.
+template <unsigned N> inline uint64_t load_n_chars(const char *p) noexcept {
+  static_assert(N >= 1 && N <= 8);
+  if constexpr (N == 8) {
+    return load_8_chars(p);
+  } else {
+    uint64_t v;
+    if constexpr (N >= 4) {
+      uint32_t lo, hi;
+      std::memcpy(&lo, p, 4);
+      std::memcpy(&hi, p + N - 4, 4);
+#if __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+      lo = __builtin_bswap32(lo);
+      hi = __builtin_bswap32(hi);
+#endif
+      v = lo | (uint64_t(hi) << (8 * (N - 4)));
+    } else if constexpr (N >= 2) {
+      uint16_t lo, hi;
+      std::memcpy(&lo, p, 2);
+      std::memcpy(&hi, p + N - 2, 2);
+#if __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+      lo = __builtin_bswap16(lo);
+      hi = __builtin_bswap16(hi);
+#endif
+      v = lo | (uint64_t(hi) << (8 * (N - 2)));
+    } else {
+      v = uint8_t(*p);
+    }
+    return (v << (8 * (8 - N))) | (UINT64_C(0x3030303030303030) >> (8 * N));
+  }
 }
 
-constexpr inline from_chars_result
-from_chars(const char *first, const char *last, int32_t &value) noexcept {
-  return detail::from_chars(first, last, value);
+// Parses exactly N digits starting at first using one SWAR load per 8
+// digits. Falls back to from_chars to report errors.
+template <unsigned N, typename T>
+constexpr from_chars_result from_chars_fixed(const char *first,
+                                             T &value) noexcept {
+  static_assert(std::is_integral<T>::value);
+  using UT = std::make_unsigned_t<T>;
+  static_assert(N >= 1 && N <= std::numeric_limits<UT>::digits10 + 1);
+  const char *const start = first;
+  [[maybe_unused]] bool negative = false;
+  if constexpr (std::is_signed<T>::value) {
+    if (*first == '-') {
+      negative = true;
+      ++first;
+    }
+  }
+  if (!__builtin_is_constant_evaluated()) {
+    constexpr unsigned blocks = (N - 1) / 8;
+    constexpr unsigned head = N - 8 * blocks;
+    uint64_t chunk = load_n_chars<head>(first);
+    bool valid = is_8_digits(chunk);
+    uint64_t res = parse_8_digits(chunk);
+    [[maybe_unused]] bool overflow = false;
+    for (unsigned i = 0; i < blocks; ++i) {
+      chunk = load_8_chars(first + head + 8 * i);
+      valid &= is_8_digits(chunk);
+      if constexpr (N > std::numeric_limits<uint64_t>::digits10) {
+        overflow |= __builtin_mul_overflow(res, 100000000, &res);
+        overflow |= __builtin_add_overflow(res, parse_8_digits(chunk), &res);
+      } else {
+        res = res * 100000000 + parse_8_digits(chunk);
+      }
+    }
+    if constexpr (N > std::numeric_limits<T>::digits10) {
+      overflow |= res > uint64_t(std::numeric_limits<T>::max()) + negative;
+    }
+    if (__builtin_expect(valid && !overflow, 1)) {
+      value = negative ? T(UT(0) - UT(res)) : T(res);
+      return {first + N, {}};
+    }
+  }
+  return from_chars<T, scalar_digit_parser>(start, first + N, value);
 }
 
-constexpr inline from_chars_result
-from_chars(const char *first, const char *last, uint64_t &value) noexcept {
-  return detail::from_chars(first, last, value);
+// Writes value / 10^Scale with exactly Scale fraction digits. The digits are
+// written one position to the right and the integer part is then moved left
+// to make room for the decimal point, avoiding a division by 10^Scale.
+template <unsigned Scale, typename T, typename Writer = digit_pair_writer>
+constexpr to_chars_result to_chars_decimal(char *first, char *last,
+                                           T value) noexcept {
+  static_assert(std::is_integral<T>::value);
+  using UT = std::make_unsigned_t<T>;
+  static_assert(sizeof(UT) == sizeof(T));
+  static_assert(Scale <= std::numeric_limits<UT>::digits10);
+  UT uvalue = value;
+  bool negative = false;
+  if constexpr (std::is_signed<T>::value) {
+    if (value < 0) {
+      negative = true;
+      uvalue = UT(~value) + UT(1);
+    }
+  }
+  const unsigned len = to_chars_len(uvalue);
+  const unsigned digits = len > Scale ? len : Scale + 1;
+  if (__builtin_expect(last - first < negative + digits + (Scale > 0), 0)) {
+    return {last, std::errc::value_too_large};
+  }
+  if (negative) {
+    *first++ = '-';
+  }
+  char *const end = first + digits + (Scale > 0);
+  char *p = Writer::write(end, uvalue);
+  while (p != end - digits) {
+    *--p = '0';
+  }
+  if constexpr (Scale > 0) {
+    const unsigned int_len = digits - Scale;
+    if (__builtin_is_constant_evaluated()) {
+      for (unsigned i = 0; i < int_len; ++i) {
+        first[i] = first[i + 1];
+      }
+    } else {
+      std::memmove(first, first + 1, int_len);
+    }
+    first[int_len] = '.';
+  }
+  return {end, {}};
+}
+
+// Parses [-]digits[.digits] into value * 10^Scale in a single pass. Fraction
+// digits beyond Scale are validated and rounded according to Rounding.
+template <unsigned Scale, typename Rounding, typename T,
+          typename Parser = swar_digit_parser>
+constexpr from_chars_result from_chars_decimal(const char *first,
+                                               const char *last,
+                                               T &value) noexcept {
+  static_assert(std::is_integral<T>::value);
+  using UT = std::make_unsigned_t<T>;
+  static_assert(sizeof(UT) == sizeof(T));
+  static_assert(Scale <= std::numeric_limits<UT>::digits10);
+  [[maybe_unused]] bool negative = false;
+  if constexpr (std::is_signed<T>::value) {
+    if (first != last && *first == '-') {
+      negative = true;
+      ++first;
+    }
+  }
+  if (__builtin_expect(first == last, 0)) {
+    return {first, std::errc::invalid_argument};
+  }
+
+  // Integer part
+  UT res = 0;
+  auto r = Parser::parse(first, last, res);
+  const char *p = r.ptr;
+  const bool has_point = r.ec == std::errc::invalid_argument && *p == '.';
+  if (__builtin_expect(r.ec != std::errc{} && !has_point, 0)) {
+    return r;
+  }
+  bool has_digits = p != first;
+  constexpr UT scale = Scale == 0 ? 1 : UT(powers_of_10_64[Scale]);
+  if (__builtin_expect(__builtin_mul_overflow(res, scale, &res), 0)) {
+    return {p, std::errc::result_out_of_range};
+  }
+
+  // Fraction digits up to Scale
+  if (has_point) {
+    ++p;
+    const char *frac_last = last - p > Scale ? p + Scale : last;
+    UT frac = 0;
+    r = Parser::parse(p, frac_last, frac);
+    if (__builtin_expect(r.ec != std::errc{}, 0)) {
+      return r;
+    }
+    has_digits |= last != p;
+    const unsigned frac_len = unsigned(frac_last - p);
+    if (frac_len < Scale) {
+      frac *= UT(powers_of_10_64[Scale - frac_len]);
+    }
+    if (__builtin_expect(__builtin_add_overflow(res, frac, &res), 0)) {
+      return {frac_last, std::errc::result_out_of_range};
+    }
+    p = frac_last;
+  }
+  if (__builtin_expect(!has_digits, 0)) {
+    return {p, std::errc::invalid_argument};
+  }
+
+  // Fraction digits beyond Scale
+  if (p != last) {
+    const unsigned digit = uint8_t(*p - '0');
+    bool sticky = false;
+    for (const char *q = p; q != last; ++q) {
+      const uint8_t c = *q - '0';
+      if (__builtin_expect(c > 9, 0)) {
+        return {q, std::errc::invalid_argument};
+      }
+      sticky |= q != p && c != 0;
+    }
+    if (Rounding::round_up(digit, sticky, res & 1) &&
+        __builtin_expect(__builtin_add_overflow(res, UT(1), &res), 0)) {
+      return {last, std::errc::result_out_of_range};
+    }
+  }
+
+  if constexpr (std::is_signed<T>::value) {
+    if (__builtin_expect(res > UT(std::numeric_limits<T>::max()) + negative,
+                         0)) {
+      return {last, std::errc::result_out_of_range};
+    }
+    value = negative ? T(UT(0) - res) : T(res);
+  } else {
+    value = res;
+  }
+  return {last, {}};
+}
+
+// Timestamps are nanoseconds since the Unix epoch written in UTC as
+// YYYY-MM-DDTHH:MM:SS.nnnnnnnnn. Every int64_t value has a 4 digit year, so
+// the length is fixed.
+static constexpr unsigned timestamp_len = 29;
+static constexpr int64_t nanos_per_day = INT64_C(86400000000000);
+
+struct civil_date {
+  uint32_t year;
+  uint32_t month;
+  uint32_t day;
+};
+
+// Eras of 400 years added to the year so that the calendar arithmetic below
+// is unsigned for all years >= -32800.
+static constexpr uint32_t civil_eras = 82;
+static constexpr uint32_t civil_day_shift = 719468 + 146097 * civil_eras;
+
+// Converts days since 1970-01-01 to a date in the proleptic Gregorian
+// calendar without branches, using the Euclidean affine functions of Neri
+// and Schneider. The year starts in March so that the leap day is last, and
+// is moved to January at the end. Valid for years in [0, 9999].
+constexpr civil_date civil_from_days(int32_t days) noexcept {
+  const uint32_t n = 4 * (uint32_t(days) + civil_day_shift) + 3;
+  const uint32_t century = n / 146097;
+  const uint32_t day_of_century = n % 146097 / 4;
+  const uint64_t p = UINT64_C(2939745) * (4 * day_of_century + 3);
+  const uint32_t year_of_century = uint32_t(p >> 32);
+  const uint32_t day_of_year = uint32_t(p) / 2939745 / 4;
+  const uint32_t m = 2141 * day_of_year + 197913;
+  const uint32_t january = day_of_year >= 306;
+  return {100 * century + year_of_century + january - 400 * civil_eras,
+          (m >> 16) - 12 * january, (m & 0xFFFF) / 2141 + 1};
+}
+
+// Inverse of civil_from_days.
+constexpr int32_t days_from_civil(uint32_t year, uint32_t month,
+                                  uint32_t day) noexcept {
+  const uint32_t january = month <= 2;
+  const uint32_t y = year + 400 * civil_eras - january;
+  const uint32_t m = month + 12 * january;
+  const uint32_t century = y / 100;
+  const uint32_t days =
+      1461 * y / 4 - century + century / 4 + (979 * m - 2919) / 32 + day - 1;
+  return int32_t(days - civil_day_shift);
+}
+
+constexpr uint32_t days_in_month(uint32_t year, uint32_t month) noexcept {
+  if (month == 2) {
+    return 28 + ((year % 4 == 0 && year % 100 != 0) || year % 400 == 0);
+  }
+  return 30 + ((month + (month >> 3)) & 1);
+}
+
+constexpr to_chars_result to_chars_timestamp(char *first, char *last,
+                                             int64_t value) noexcept {
+  if (__builtin_expect(size_t(last - first) < timestamp_len, 0)) {
+    return {last, std::errc::value_too_large};
+  }
+  int64_t days = value / nanos_per_day;
+  int64_t nanos = value % nanos_per_day;
+  days -= nanos < 0;
+  nanos += nanos < 0 ? nanos_per_day : 0;
+  const civil_date date = civil_from_days(int32_t(days));
+  const uint32_t secs = uint32_t(uint64_t(nanos) / 1000000000);
+  const uint32_t frac = uint32_t(uint64_t(nanos) - uint64_t(secs) * 1000000000);
+  const uint32_t hours = secs / 3600;
+  const uint32_t mins = secs / 60 - hours * 60;
+  write_digit_pair(first + 2, date.year / 100);
+  write_digit_pair(first + 4, date.year % 100);
+  first[4] = '-';
+  write_digit_pair(first + 7, date.month);
+  first[7] = '-';
+  write_digit_pair(first + 10, date.day);
+  first[10] = 'T';
+  write_digit_pair(first + 13, hours);
+  first[13] = ':';
+  write_digit_pair(first + 16, mins);
+  first[16] = ':';
+  write_digit_pair(first + 19, secs - (hours * 60 + mins) * 60);
+  first[19] = '.';
+  write_fixed_digits<9>(first + timestamp_len, frac);
+  return {first + timestamp_len, {}};
+}
+
+// The timestamp layout with '0' in place of each digit.
+static constexpr char timestamp_layout[] = "0000-00-00T00:00:00.000000000";
+
+// Returns the 8 characters of the layout at offset as loaded by
+// load_8_chars.
+constexpr uint64_t timestamp_layout_word(unsigned offset) noexcept {
+  uint64_t v = 0;
+  for (unsigned i = 0; i < 8; ++i) {
+    v |= uint64_t(uint8_t(timestamp_layout[offset + i])) << (8 * i);
+  }
+  return v;
+}
+
+// Returns 0xFF in each byte of the layout word that is a separator.
+constexpr uint64_t timestamp_separator_mask(uint64_t layout) noexcept {
+  uint64_t mask = 0;
+  for (unsigned i = 0; i < 8; ++i) {
+    mask |= uint64_t(((layout >> (8 * i)) & 0xFF) != '0' ? 0xFF : 0) << (8 * i);
+  }
+  return mask;
+}
+
+// Returns true if the 8 characters in v match the layout word: separators
+// compare equal and every other character is a digit.
+template <uint64_t Layout>
+inline bool match_timestamp_word(uint64_t v) noexcept {
+  constexpr uint64_t separators = timestamp_separator_mask(Layout);
+  return ((v ^ Layout) & separators) == 0 &&
+         is_8_digits((v & ~separators) |
+                     (UINT64_C(0x3030303030303030) & separators));
+}
+
+// Converts the layout word v to the values of its digit pairs: byte i of the
+// result is 10 * digit i + digit i + 1. The separators are subtracted out
+// along with '0' so that no byte borrows from its neighbor.
+template <uint64_t Layout>
+inline uint64_t timestamp_digit_pairs(uint64_t v) noexcept {
+  v -= Layout;
+  return v * 10 + (v >> 8);
+}
+
+constexpr unsigned timestamp_byte(uint64_t v, unsigned i) noexcept {
+  return unsigned(v >> (8 * i)) & 0xFF;
+}
+
+// Returns the first character in [first, last) that does not match the
+// layout, or last if the range is a prefix of it.
+inline const char *timestamp_mismatch(const char *first,
+                                      const char *last) noexcept {
+  const char *const end =
+      size_t(last - first) < timestamp_len ? last : first + timestamp_len;
+  for (const char *p = first; p != end; ++p) {
+    const char c = timestamp_layout[p - first];
+    if (c == '0' ? unsigned(*p - '0') > 9 : *p != c) {
+      return p;
+    }
+  }
+  return end;
+}
+
+// Parses a timestamp written by to_chars_timestamp, optionally followed by
+// Z or a UTC offset +HH:MM or -HH:MM. The layout is validated with four
+// overlapping 8 character loads, and the fields are converted two digits at
+// a time within each word. Fields out of range, such as a month of 13 or the
+// 30th of February, are reported at the first character of the field.
+inline from_chars_result from_chars_timestamp(const char *first,
+                                              const char *last,
+                                              int64_t &value) noexcept {
+  if (__builtin_expect(size_t(last - first) < timestamp_len, 0)) {
+    return {timestamp_mismatch(first, last), std::errc::invalid_argument};
+  }
+  constexpr uint64_t date_layout = timestamp_layout_word(0);
+  constexpr uint64_t time_layout = timestamp_layout_word(8);
+  constexpr uint64_t secs_layout = timestamp_layout_word(16);
+  const uint64_t date = load_8_chars(first);
+  const uint64_t time = load_8_chars(first + 8);
+  const uint64_t secs = load_8_chars(first + 16);
+  const uint64_t frac = load_8_chars(first + 21);
+  if (__builtin_expect(!(match_timestamp_word<date_layout>(date) &
+                         match_timestamp_word<time_layout>(time) &
+                         match_timestamp_word<secs_layout>(secs) &
+                         is_8_digits(frac)),
+                       0)) {
+    return {timestamp_mismatch(first, last), std::errc::invalid_argument};
+  }
+
+  const uint64_t date_pairs = timestamp_digit_pairs<date_layout>(date);
+  const uint64_t time_pairs = timestamp_digit_pairs<time_layout>(time);
+  const uint64_t secs_pairs = timestamp_digit_pairs<secs_layout>(secs);
+  const uint32_t year =
+      timestamp_byte(date_pairs, 0) * 100 + timestamp_byte(date_pairs, 2);
+  const uint32_t month = timestamp_byte(date_pairs, 5);
+  const uint32_t day = timestamp_byte(time_pairs, 0);
+  const uint32_t hours = timestamp_byte(time_pairs, 3);
+  const uint32_t mins = timestamp_byte(time_pairs, 6);
+  const uint32_t seconds = timestamp_byte(secs_pairs, 1);
+  const uint32_t nanos =
+      (timestamp_byte(secs, 4) - '0') * 100000000 + parse_8_digits(frac);
+  if (__builtin_expect(month - 1 >= 12, 0)) {
+    return {first + 5, std::errc::invalid_argument};
+  }
+  if (__builtin_expect(day - 1 >= days_in_month(year, month), 0)) {
+    return {first + 8, std::errc::invalid_argument};
+  }
+  if (__builtin_expect(hours >= 24, 0)) {
+    return {first + 11, std::errc::invalid_argument};
+  }
+  if (__builtin_expect(mins >= 60, 0)) {
+    return {first + 14, std::errc::invalid_argument};
+  }
+  if (__builtin_expect(seconds >= 60, 0)) {
+    return {first + 17, std::errc::invalid_argument};
+  }
+
+  int64_t offset = 0;
+  const char *p = first + timestamp_len;
+  if (p != last) {
+    if (*p == 'Z') {
+      ++p;
+    } else if (*p == '+' || *p == '-') {
+      constexpr char offset_layout[] = "+00:00";
+      const char *q = p + 1;
+      for (; q != last && q != p + 6; ++q) {
+        const char c = offset_layout[q - p];
+        if (c == '0' ? unsigned(*q - '0') > 9 : *q != c) {
+          break;
+        }
+      }
+      if (q != p + 6) {
+        return {q, std::errc::invalid_argument};
+      }
+      const int64_t offset_hours = (p[1] - '0') * 10 + (p[2] - '0');
+      const int64_t offset_mins = (p[4] - '0') * 10 + (p[5] - '0');
+      if (offset_hours >= 24) {
+        return {p + 1, std::errc::invalid_argument};
+      }
+      if (offset_mins >= 60) {
+        return {p + 4, std::errc::invalid_argument};
+      }
+      offset = (offset_hours * 60 + offset_mins) * 60 * 1000000000;
+      offset = *p == '-' ? -offset : offset;
+      p += 6;
+    }
+    if (p != last) {
+      return {p, std::errc::invalid_argument};
+    }
+  }
+
+  const int64_t nanos_of_day =
+      int64_t((hours * 60 + mins) * 60 + seconds) * 1000000000 + nanos - offset;
+  // The first and last days in range do not start within int64_t.
+  const int128_t res =
+      int128_t(days_from_civil(year, month, day)) * nanos_per_day +
+      nanos_of_day;
+  if (__builtin_expect(res < std::numeric_limits<int64_t>::min() ||
+                           res > std::numeric_limits<int64_t>::max(),
+                       0)) {
+    return {last, std::errc::result_out_of_range};
+  }
+  value = int64_t(res);
+  return {last, {}};
+}
+
+static constexpr char base_digits[] = "0123456789abcdefghijklmnopqrstuvwxyz";
+
+struct digit_value_table {
+  uint8_t values[256];
+};
+
+constexpr digit_value_table make_digit_value_table() noexcept {
+  digit_value_table t = {};
+  for (unsigned i = 0; i < 256; ++i) {
+    t.values[i] = 255;
+  }
+  for (unsigned i = 0; i < 10; ++i) {
+    t.values['0' + i] = i;
+  }
+  for (unsigned i = 0; i < 26; ++i) {
+    t.values['a' + i] = t.values['A' + i] = 10 + i;
+  }
+  return t;
+}
+
+static constexpr digit_value_table digit_values = make_digit_value_table();
+
+// Returns the value of the digit c in bases up to 36, or 255 if c is not a
+// digit.
+constexpr unsigned digit_value(char c) noexcept {
+  return digit_values.values[uint8_t(c)];
+}
+
+// Converts the 8 nibbles of value into 8 hex characters, most significant
+// nibble in the first character, ready to be stored with memcpy.
+inline uint64_t hex_8_chars(uint32_t value) noexcept {
+  uint64_t x = value;
+  x = (x | (x << 16)) & UINT64_C(0x0000FFFF0000FFFF);
+  x = (x | (x << 8)) & UINT64_C(0x00FF00FF00FF00FF);
+  x = (x | (x << 4)) & UINT64_C(0x0F0F0F0F0F0F0F0F);
+  const uint64_t letters =
+      ((x + UINT64_C(0x0606060606060606)) >> 4) & UINT64_C(0x0101010101010101);
+  x += UINT64_C(0x3030303030303030) + letters * ('a' - '0' - 10);
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+  x = __builtin_bswap64(x);
+#endif
+  return x;
+}
+
+// Converts the 8 bits of value into 8 binary characters, most significant
+// bit in the first character, ready to be stored with memcpy.
+inline uint64_t binary_8_chars(uint8_t value) noexcept {
+  uint64_t x = ((value * UINT64_C(0x8040201008040201)) >> 7) &
+               UINT64_C(0x0101010101010101);
+  x += UINT64_C(0x3030303030303030);
+#if __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+  x = __builtin_bswap64(x);
+#endif
+  return x;
+}
+
+// Writer for base 2^Shift. Digits are extracted with shifts and masks, hex
+// and binary digits 8 at a time using hex_8_chars and binary_8_chars.
+template <unsigned Shift> struct pow2_writer {
+  static_assert(Shift >= 1 && Shift <= 5);
+
+  template <typename T> static constexpr unsigned len(T value) noexcept {
+    static_assert(std::is_unsigned<T>::value && sizeof(T) <= 8);
+    const unsigned bits = 64 - __builtin_clzll(uint64_t(value) | 1);
+    return (bits + Shift - 1) / Shift;
+  }
+
+  template <typename T>
+  static constexpr char *write(char *last, T value) noexcept {
+    static_assert(std::is_unsigned<T>::value);
+    if constexpr (Shift == 4) {
+      if (!__builtin_is_constant_evaluated()) {
+        unsigned n = len(value);
+        if constexpr (sizeof(T) > sizeof(uint32_t)) {
+          if (n > 8) {
+            const uint64_t chars = hex_8_chars(uint32_t(value));
+            std::memcpy(last - 8, &chars, 8);
+            last -= 8;
+            n -= 8;
+            value >>= 32;
+          }
+        }
+        const uint64_t chars = hex_8_chars(uint32_t(value));
+        char buf[8] = {};
+        std::memcpy(buf, &chars, 8);
+        std::memcpy(last - n, buf + 8 - n, n);
+        return last - n;
+      }
+    }
+    if constexpr (Shift == 1) {
+      if (!__builtin_is_constant_evaluated()) {
+        unsigned n = len(value);
+        for (; n > 8; n -= 8) {
+          const uint64_t chars = binary_8_chars(uint8_t(value));
+          std::memcpy(last - 8, &chars, 8);
+          last -= 8;
+          value >>= 8;
+        }
+        const uint64_t chars = binary_8_chars(uint8_t(value));
+        char buf[8] = {};
+        std::memcpy(buf, &chars, 8);
+        std::memcpy(last - n, buf + 8 - n, n);
+        return last - n;
+      }
+    }
+    constexpr T mask = (T(1) << Shift) - 1;
+    do {
+      *--last = Shift <= 3 ? char('0' + (value & mask))
+                           : base_digits[value & mask];
+      value >>= Shift;
+    } while (value != 0);
+    return last;
+  }
+};
+
+// Writer for any base in [2, 36] given at runtime. Digits are extracted
+// from 32-bit chunks dividing by multiplication with magic = ceil(2^64 /
+// base), which is exact for 32-bit dividends. Values wider than a chunk are
+// first split with one hardware division per chunk. Computing the length up
+// front would cost a multiplication per digit, so the digits are written to
+// a temporary buffer and then copied.
+struct base_writer {
+  uint32_t base;
+  uint64_t magic;
+  uint64_t chunk; // base^chunk_digits <= 2^32
+  unsigned chunk_digits = 1;
+
+  constexpr explicit base_writer(unsigned b) noexcept
+      : base(b), magic(UINT64_C(0xFFFFFFFFFFFFFFFF) / b + 1), chunk(b) {
+    while (chunk * base <= (UINT64_C(1) << 32)) {
+      chunk *= base;
+      ++chunk_digits;
+    }
+  }
+
+  constexpr uint32_t div(uint32_t n) const noexcept {
+    return uint32_t((uint128_t(magic) * n) >> 64);
+  }
+
+  template <typename T>
+  constexpr char *write(char *last, T value) const noexcept {
+    static_assert(std::is_unsigned<T>::value && sizeof(T) <= 8);
+    uint64_t v = value;
+    while (v >= chunk) {
+      const uint64_t q = v / chunk;
+      uint32_t r = uint32_t(v - q * chunk);
+      for (unsigned i = 0; i < chunk_digits; ++i) {
+        const uint32_t d = div(r);
+        *--last = base_digits[r - d * base];
+        r = d;
+      }
+      v = q;
+    }
+    uint32_t r = uint32_t(v);
+    do {
+      const uint32_t d = div(r);
+      *--last = base_digits[r - d * base];
+      r = d;
+    } while (r != 0);
+    return last;
+  }
+};
+
+template <typename T, typename Writer>
+constexpr to_chars_result to_chars_with(char *first, char *last, T value,
+                                        const Writer &writer) noexcept {
+  static_assert(std::is_integral<T>::value);
+  using UT = std::make_unsigned_t<T>;
+  static_assert(sizeof(UT) == sizeof(T));
+  UT uvalue = value;
+  if constexpr (std::is_signed<T>::value) {
+    if (value < 0) {
+      if (__builtin_expect(first != last, 1)) {
+        *first++ = '-';
+        uvalue = UT(~value) + UT(1);
+      }
+    }
+  }
+  const auto len = writer.len(uvalue);
+  if (__builtin_expect(last - first < len, 0)) {
+    return {last, std::errc::value_too_large};
+  }
+  writer.write(first + len, uvalue);
+  return {first + len, {}};
+}
+
+template <typename T>
+constexpr to_chars_result to_chars_base(char *first, char *last, T value,
+                                        int base) noexcept {
+  switch (base) {
+  case 10:
+    return to_chars(first, last, value);
+  case 16:
+    return to_chars_with(first, last, value, pow2_writer<4>());
+  case 8:
+    return to_chars_with(first, last, value, pow2_writer<3>());
+  case 2:
+    return to_chars_with(first, last, value, pow2_writer<1>());
+  default:
+    if (__builtin_expect(base < 2 || base > 36, 0)) {
+      return {first, std::errc::invalid_argument};
+    }
+    using UT = std::make_unsigned_t<T>;
+    UT uvalue = value;
+    char buf[std::numeric_limits<UT>::digits + 1] = {};
+    char *const end = buf + sizeof(buf);
+    char *p = end;
+    if constexpr (std::is_signed<T>::value) {
+      if (value < 0) {
+        p = base_writer(base).write(end, UT(UT(~value) + UT(1)));
+        *--p = '-';
+      }
+    }
+    if (p == end) {
+      p = base_writer(base).write(end, uvalue);
+    }
+    if (__builtin_expect(last - first < end - p, 0)) {
+      return {last, std::errc::value_too_large};
+    }
+    while (p != end) {
+      *first++ = *p++;
+    }
+    return {first, {}};
+  }
+}
+
+// Parser for base 2^Shift accumulating digits with shifts. Binary digits are
+// converted 8 at a time with a multiplication.
+template <unsigned Shift> struct pow2_digit_parser {
+  template <typename T>
+  static constexpr from_chars_result parse(const char *first, const char *last,
+                                          T &value) noexcept {
+    static_assert(std::is_unsigned<T>::value);
+    T res = value;
+    if constexpr (Shift == 1) {
+      if (!__builtin_is_constant_evaluated()) {
+        while (last - first >= 8) {
+          const uint64_t chunk = load_8_chars(first);
+          if ((chunk & UINT64_C(0xFEFEFEFEFEFEFEFE)) !=
+                  UINT64_C(0x3030303030303030) ||
+              res >> (std::numeric_limits<T>::digits - 8) != 0) {
+            break;
+          }
+          res = T(res << 8) |
+                T(((chunk - UINT64_C(0x3030303030303030)) *
+                   UINT64_C(0x8040201008040201)) >>
+                  56);
+          first += 8;
+        }
+      }
+    }
+    for (; first != last; ++first) {
+      const unsigned d = digit_value(*first);
+      if (__builtin_expect(d >= (1u << Shift), 0)) {
+        value = res;
+        return {first, std::errc::invalid_argument};
+      }
+      if (__builtin_expect(res >> (std::numeric_limits<T>::digits - Shift),
+                           0)) {
+        return {first, std::errc::result_out_of_range};
+      }
+      res = T(res << Shift) | d;
+    }
+    value = res;
+    return {first, {}};
+  }
+};
+
+// Parser for any base in [2, 36] given at runtime.
+struct base_digit_parser {
+  unsigned base;
+
+  template <typename T>
+  constexpr from_chars_result parse(const char *first, const char *last,
+                                    T &value) const noexcept {
+    static_assert(std::is_unsigned<T>::value);
+    T res = value;
+    for (; first != last; ++first) {
+      const unsigned d = digit_value(*first);
+      if (__builtin_expect(d >= base, 0)) {
+        value = res;
+        return {first, std::errc::invalid_argument};
+      }
+      if (__builtin_expect(__builtin_mul_overflow(res, base, &res), 0) ||
+          __builtin_expect(__builtin_add_overflow(res, d, &res), 0)) {
+        return {first, std::errc::result_out_of_range};
+      }
+    }
+    value = res;
+    return {first, {}};
+  }
+};
+
+template <typename T>
+constexpr from_chars_result from_chars_base(const char *first,
+                                            const char *last, T &value,
+                                            int base) noexcept {
+  switch (base) {
+  case 10:
+    return from_chars(first, last, value);
+  case 16:
+    return from_chars(first, last, value, pow2_digit_parser<4>());
+  case 8:
+    return from_chars(first, last, value, pow2_digit_parser<3>());
+  case 2:
+    return from_chars(first, last, value, pow2_digit_parser<1>());
+  default:
+    if (__builtin_expect(base < 2 || base > 36, 0)) {
+      return {first, std::errc::invalid_argument};
+    }
+    return from_chars(first, last, value, base_digit_parser{unsigned(base)});
+  }
+}
+
+// Maximum number of characters written by to_chars for type T.
+template <typename T>
+constexpr unsigned to_chars_max_len =
+    std::numeric_limits<T>::digits10 + 1 + std::is_signed<T>::value;
+
+// Writes the values in [values_first, values_last) separated by delimiter
+// starting at first. Offsets are stored relative to base.
+template <typename T>
+to_chars_result to_chars_many_scalar(char *base, char *first, char *last,
+                                     const T *values_first,
+                                     const T *values_last, char delimiter,
+                                     size_t *offsets) noexcept {
+  for (const T *it = values_first; it != values_last; ++it) {
+    if (it != values_first) {
+      if (__builtin_expect(first == last, 0)) {
+        return {last, std::errc::value_too_large};
+      }
+      *first++ = delimiter;
+    }
+    if (offsets) {
+      *offsets++ = first - base;
+    }
+    const auto res = to_chars(first, last, *it);
+    if (__builtin_expect(res.ec != std::errc{}, 0)) {
+      return res;
+    }
+    first = res.ptr;
+  }
+  return {first, {}};
+}
+
+#if defined(__SSE4_1__)
+
+// The SIMD kernels split each value into its decimal length, the digits
+// above 10^16 (64-bit only) and two 8-digit blocks for the low 16 digits.
+// The blocks are converted to ASCII in vector registers, 16 digits per value,
+// and the leading zeros are removed by a byte shuffle before an unaligned
+// 16 byte store. Stores may write up to 16 bytes past the end of a value, so
+// the kernels only run while the output has room for a whole group plus 16
+// bytes. Each value is followed by the delimiter and the kernels return the
+// first value not written, leaving the remainder to the next kernel.
+
+struct split_value {
+  uint64_t top;
+  uint32_t hi;
+  uint32_t lo;
+  unsigned len;
+  bool negative;
+};
+
+template <typename T> inline split_value split_16_digits(T value) noexcept {
+  using UT = std::make_unsigned_t<T>;
+  split_value s = {};
+  UT uvalue = value;
+  if constexpr (std::is_signed<T>::value) {
+    s.negative = value < 0;
+    if (s.negative) {
+      uvalue = UT(~value) + UT(1);
+    }
+  }
+  s.len = to_chars_len(uvalue);
+  if constexpr (sizeof(T) > sizeof(uint32_t)) {
+    if (s.len > 16) {
+      s.top = uvalue / UINT64_C(10000000000000000);
+      uvalue -= s.top * UINT64_C(10000000000000000);
+    }
+  }
+  s.hi = static_cast<uint32_t>(uvalue / 100000000);
+  s.lo = static_cast<uint32_t>(uvalue - UT(s.hi) * 100000000);
+  return s;
+}
+
+alignas(32) static constexpr uint8_t compact_shuffle[32] = {
+    0,    1,    2,    3,    4,    5,    6,    7,    8,    9,    10,
+    11,   12,   13,   14,   15,   0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+};
+
+// Writes the value described by s given the 16 low digits in ASCII.
+inline char *store_16_digits(char *p, const split_value &s,
+                             __m128i digits) noexcept {
+  *p = '-';
+  p += s.negative;
+  unsigned len = s.len;
+  if (__builtin_expect(len > 16, 0)) {
+    p = digit_pair_writer::write(p + len - 16, s.top) + len - 16;
+    len = 16;
+  }
+  const __m128i mask = _mm_loadu_si128(
+      reinterpret_cast<const __m128i *>(compact_shuffle + 16 - len));
+  _mm_storeu_si128(reinterpret_cast<__m128i *>(p),
+                   _mm_shuffle_epi8(digits, mask));
+  return p + len;
+}
+
+// Splits each 32-bit lane x < 10^8 into x / 10^4 and x % 10^4 and returns
+// them interleaved in 16-bit lanes.
+inline __m128i split_10000_sse41(__m128i x) noexcept {
+  const __m128i div = _mm_set1_epi32(0xd1b71759);
+  const __m128i even = _mm_srli_epi64(_mm_mul_epu32(x, div), 45);
+  const __m128i odd =
+      _mm_srli_epi64(_mm_mul_epu32(_mm_srli_epi64(x, 32), div), 45);
+  const __m128i q = _mm_blend_epi16(even, _mm_slli_epi64(odd, 32), 0xcc);
+  const __m128i r = _mm_sub_epi32(x, _mm_mullo_epi32(q, _mm_set1_epi32(10000)));
+  return _mm_or_si128(q, _mm_slli_epi32(r, 16));
+}
+
+// Converts each 64-bit lane holding a value < 10^4 repeated in all four
+// 16-bit lanes to its four digits, most significant digit first.
+inline __m128i digits_10000_sse41(__m128i v) noexcept {
+  const __m128i div = _mm_setr_epi16(8389, 5243, 13108, -32768, 8389, 5243,
+                                     13108, -32768);
+  const __m128i shift = _mm_setr_epi16(1 << 7, 1 << 11, 1 << 13, -32768,
+                                       1 << 7, 1 << 11, 1 << 13, -32768);
+  const __m128i t = _mm_mulhi_epu16(
+      _mm_mulhi_epu16(_mm_slli_epi16(v, 2), div), shift);
+  return _mm_sub_epi16(
+      t, _mm_slli_epi64(_mm_mullo_epi16(t, _mm_set1_epi16(10)), 16));
+}
+
+// Converts the blocks {hi0, lo0, hi1, lo1} to 16 ASCII digits per value.
+inline void digits_16x2_sse41(__m128i blocks, __m128i &a, __m128i &b) noexcept {
+  const __m128i w = split_10000_sse41(blocks);
+  const __m128i wa = _mm_unpacklo_epi16(w, w);
+  const __m128i wb = _mm_unpackhi_epi16(w, w);
+  const __m128i zero = _mm_set1_epi8('0');
+  a = _mm_add_epi8(
+      _mm_packus_epi16(digits_10000_sse41(_mm_unpacklo_epi32(wa, wa)),
+                       digits_10000_sse41(_mm_unpackhi_epi32(wa, wa))),
+      zero);
+  b = _mm_add_epi8(
+      _mm_packus_epi16(digits_10000_sse41(_mm_unpacklo_epi32(wb, wb)),
+                       digits_10000_sse41(_mm_unpackhi_epi32(wb, wb))),
+      zero);
+}
+
+template <typename T>
+const T *to_chars_many_sse41(char *base, char *&p, char *last, const T *it,
+                             const T *values_last, char delimiter,
+                             size_t *&offsets) noexcept {
+  constexpr ptrdiff_t group_len = 2 * (to_chars_max_len<T> + 1) + 16;
+  while (values_last - it >= 2 && last - p >= group_len) {
+    const split_value s0 = split_16_digits(it[0]);
+    const split_value s1 = split_16_digits(it[1]);
+    __m128i d0, d1;
+    digits_16x2_sse41(_mm_setr_epi32(s0.hi, s0.lo, s1.hi, s1.lo), d0, d1);
+    if (offsets) {
+      *offsets++ = p - base;
+    }
+    p = store_16_digits(p, s0, d0);
+    *p++ = delimiter;
+    if (offsets) {
+      *offsets++ = p - base;
+    }
+    p = store_16_digits(p, s1, d1);
+    *p++ = delimiter;
+    it += 2;
+  }
+  return it;
+}
+
+#endif
+
+#if defined(__AVX2__)
+
+inline __m256i split_10000_avx2(__m256i x) noexcept {
+  const __m256i div = _mm256_set1_epi32(0xd1b71759);
+  const __m256i even = _mm256_srli_epi64(_mm256_mul_epu32(x, div), 45);
+  const __m256i odd =
+      _mm256_srli_epi64(_mm256_mul_epu32(_mm256_srli_epi64(x, 32), div), 45);
+  const __m256i q =
+      _mm256_blend_epi32(even, _mm256_slli_epi64(odd, 32), 0xaa);
+  const __m256i r =
+      _mm256_sub_epi32(x, _mm256_mullo_epi32(q, _mm256_set1_epi32(10000)));
+  return _mm256_or_si256(q, _mm256_slli_epi32(r, 16));
+}
+
+inline __m256i digits_10000_avx2(__m256i v) noexcept {
+  const __m256i div = _mm256_setr_epi16(8389, 5243, 13108, -32768, 8389, 5243,
+                                        13108, -32768, 8389, 5243, 13108,
+                                        -32768, 8389, 5243, 13108, -32768);
+  const __m256i shift = _mm256_setr_epi16(
+      1 << 7, 1 << 11, 1 << 13, -32768, 1 << 7, 1 << 11, 1 << 13, -32768,
+      1 << 7, 1 << 11, 1 << 13, -32768, 1 << 7, 1 << 11, 1 << 13, -32768);
+  const __m256i t = _mm256_mulhi_epu16(
+      _mm256_mulhi_epu16(_mm256_slli_epi16(v, 2), div), shift);
+  return _mm256_sub_epi16(
+      t, _mm256_slli_epi64(_mm256_mullo_epi16(t, _mm256_set1_epi16(10)), 16));
+}
+
+// Converts the blocks {hi0, lo0, hi1, lo1, hi2, lo2, hi3, lo3} to 16 ASCII
+// digits per value. Returns values 0 and 2 in a and values 1 and 3 in b.
+inline void digits_16x4_avx2(__m256i blocks, __m256i &a, __m256i &b) noexcept {
+  const __m256i w = split_10000_avx2(blocks);
+  const __m256i wa = _mm256_unpacklo_epi16(w, w);
+  const __m256i wb = _mm256_unpackhi_epi16(w, w);
+  const __m256i zero = _mm256_set1_epi8('0');
+  a = _mm256_add_epi8(
+      _mm256_packus_epi16(digits_10000_avx2(_mm256_unpacklo_epi32(wa, wa)),
+                          digits_10000_avx2(_mm256_unpackhi_epi32(wa, wa))),
+      zero);
+  b = _mm256_add_epi8(
+      _mm256_packus_epi16(digits_10000_avx2(_mm256_unpacklo_epi32(wb, wb)),
+                          digits_10000_avx2(_mm256_unpackhi_epi32(wb, wb))),
+      zero);
+}
+
+template <typename T>
+const T *to_chars_many_avx2(char *base, char *&p, char *last, const T *it,
+                            const T *values_last, char delimiter,
+                            size_t *&offsets) noexcept {
+  constexpr ptrdiff_t group_len = 4 * (to_chars_max_len<T> + 1) + 16;
+  while (values_last - it >= 4 && last - p >= group_len) {
+    const split_value s[4] = {split_16_digits(it[0]), split_16_digits(it[1]),
+                              split_16_digits(it[2]), split_16_digits(it[3])};
+    __m256i a, b;
+    digits_16x4_avx2(_mm256_setr_epi32(s[0].hi, s[0].lo, s[1].hi, s[1].lo,
+                                       s[2].hi, s[2].lo, s[3].hi, s[3].lo),
+                     a, b);
+    const __m128i d[4] = {
+        _mm256_castsi256_si128(a), _mm256_castsi256_si128(b),
+        _mm256_extracti128_si256(a, 1), _mm256_extracti128_si256(b, 1)};
+    for (int i = 0; i < 4; ++i) {
+      if (offsets) {
+        *offsets++ = p - base;
+      }
+      p = store_16_digits(p, s[i], d[i]);
+      *p++ = delimiter;
+    }
+    it += 4;
+  }
+  return it;
+}
+
+#endif
+
+template <typename T>
+to_chars_result to_chars_many(char *first, char *last, const T *values_first,
+                              const T *values_last, char delimiter,
+                              size_t *offsets) noexcept {
+  [[maybe_unused]] char *p = first;
+  [[maybe_unused]] const T *it = values_first;
+#if defined(__AVX2__)
+  it = to_chars_many_avx2(first, p, last, it, values_last, delimiter, offsets);
+#endif
+#if defined(__SSE4_1__)
+  it = to_chars_many_sse41(first, p, last, it, values_last, delimiter, offsets);
+  if (it != values_first) {
+    // The kernels leave a delimiter after the last value written.
+    if (it == values_last) {
+      return {p - 1, {}};
+    }
+    return to_chars_many_scalar(first, p, last, it, values_last, delimiter,
+                                offsets);
+  }
+#endif
+  return to_chars_many_scalar(first, first, last, values_first, values_last,
+                              delimiter, offsets);
+}
+
+constexpr bool is_delimiter(char c) noexcept {
+  return c == ',' || c == ' ' || c == '\n' || c == '\r' || c == '\t';
+}
+
+// Returns a bitmask with bit i set if p[i] is a delimiter for the 64
+// characters starting at p.
+#if defined(__AVX2__)
+inline uint64_t delimiter_mask(const char *p) noexcept {
+  uint64_t mask = 0;
+  for (int i = 0; i < 2; ++i) {
+    const __m256i v =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p + 32 * i));
+    const __m256i d = _mm256_or_si256(
+        _mm256_or_si256(_mm256_cmpeq_epi8(v, _mm256_set1_epi8(',')),
+                        _mm256_cmpeq_epi8(v, _mm256_set1_epi8(' '))),
+        _mm256_or_si256(
+            _mm256_or_si256(_mm256_cmpeq_epi8(v, _mm256_set1_epi8('\n')),
+                            _mm256_cmpeq_epi8(v, _mm256_set1_epi8('\r'))),
+            _mm256_cmpeq_epi8(v, _mm256_set1_epi8('\t'))));
+    mask |= uint64_t(uint32_t(_mm256_movemask_epi8(d))) << (32 * i);
+  }
+  return mask;
+}
+#elif defined(__SSE2__)
+inline uint64_t delimiter_mask(const char *p) noexcept {
+  uint64_t mask = 0;
+  for (int i = 0; i < 4; ++i) {
+    const __m128i v =
+        _mm_loadu_si128(reinterpret_cast<const __m128i *>(p + 16 * i));
+    const __m128i d = _mm_or_si128(
+        _mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8(',')),
+                     _mm_cmpeq_epi8(v, _mm_set1_epi8(' '))),
+        _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8('\n')),
+                                  _mm_cmpeq_epi8(v, _mm_set1_epi8('\r'))),
+                     _mm_cmpeq_epi8(v, _mm_set1_epi8('\t'))));
+    mask |= uint64_t(uint16_t(_mm_movemask_epi8(d))) << (16 * i);
+  }
+  return mask;
+}
+#else
+inline uint64_t delimiter_mask(const char *p) noexcept {
+  uint64_t mask = 0;
+  for (int i = 0; i < 64; ++i) {
+    mask |= uint64_t(is_delimiter(p[i])) << i;
+  }
+  return mask;
+}
+#endif
+
+// Parses the delimiter separated integers in [first, last) 64 characters at
+// a time. Each block is classified with delimiter_mask and the token
+// boundaries are found as the transitions between delimiter and
+// non-delimiter characters. Tokens are parsed with from_chars. A run of
+// delimiters separates two numbers, so empty fields such as in "1,,2" are
+// skipped rather than reported.
+template <typename T>
+from_chars_many_result from_chars_many(const char *first, const char *last,
+                                       T *values_first,
+                                       T *values_last) noexcept {
+  T *out = values_first;
+  if (out == values_last) {
+    return {first, {}, 0};
+  }
+  const char *token = nullptr;
+  uint64_t prev = 1; // Previous character was a delimiter
+  for (const char *block = first; block < last; block += 64) {
+    uint64_t mask;
+    if (__builtin_expect(last - block >= 64, 1)) {
+      mask = delimiter_mask(block);
+    } else {
+      char buf[64];
+      std::memset(buf, ' ', sizeof(buf));
+      std::memcpy(buf, block, last - block);
+      mask = delimiter_mask(buf);
+    }
+    uint64_t edges = mask ^ ((mask << 1) | prev);
+    prev = mask >> 63;
+    while (edges) {
+      const char *p = block + __builtin_ctzll(edges);
+      edges &= edges - 1;
+      if (token == nullptr) {
+        token = p;
+        continue;
+      }
+      const auto res = from_chars(token, p, *out);
+      if (__builtin_expect(res.ec != std::errc{}, 0)) {
+        return {res.ptr, res.ec, size_t(out - values_first)};
+      }
+      token = nullptr;
+      if (++out == values_last) {
+        return {p, {}, size_t(out - values_first)};
+      }
+    }
+  }
+  if (token != nullptr) {
+    const auto res = from_chars(token, last, *out);
+    if (__builtin_expect(res.ec != std::errc{}, 0)) {
+      return {res.ptr, res.ec, size_t(out - values_first)};
+    }
+    ++out;
+  }
+  return {last, {}, size_t(out - values_first)};
+}
+
+// Calls from_chars_many. The bulk parsers built on it take the batch parser
+// as a type so that CharConvDispatch can substitute the kernels selected at
+// runtime.
+struct from_chars_many_parser {
+  template <typename T>
+  static from_chars_many_result parse(const char *first, const char *last,
+                                      T *values_first,
+                                      T *values_last) noexcept {
+    return from_chars_many(first, last, values_first, values_last);
+  }
+};
+
+// Approximations g of 10^k for k in [-292, 326] normalized to [2^127, 2^128)
+// as {high, low} 64-bit words. Each entry is floor(10^k * 2^(127 - r)) + 1
+// where r = floor(log2(10^k)).
+static constexpr int pow10_128_min = -292;
+static constexpr uint64_t pow10_128[][2] = {
+    {UINT64_C(0xFF77B1FCBEBCDC4F), UINT64_C(0x25E8E89C13BB0F7B)},
+    {UINT64_C(0x9FAACF3DF73609B1), UINT64_C(0x77B191618C54E9AD)},
+    {UINT64_C(0xC795830D75038C1D), UINT64_C(0xD59DF5B9EF6A2418)},
+    {UINT64_C(0xF97AE3D0D2446F25), UINT64_C(0x4B0573286B44AD1E)},
+    {UINT64_C(0x9BECCE62836AC577), UINT64_C(0x4EE367F9430AEC33)},
+    {UINT64_C(0xC2E801FB244576D5), UINT64_C(0x229C41F793CDA740)},
+    {UINT64_C(0xF3A20279ED56D48A), UINT64_C(0x6B43527578C11110)},
+    {UINT64_C(0x9845418C345644D6), UINT64_C(0x830A13896B78AAAA)},
+    {UINT64_C(0xBE5691EF416BD60C), UINT64_C(0x23CC986BC656D554)},
+    {UINT64_C(0xEDEC366B11C6CB8F), UINT64_C(0x2CBFBE86B7EC8AA9)},
+    {UINT64_C(0x94B3A202EB1C3F39), UINT64_C(0x7BF7D71432F3D6AA)},
+    {UINT64_C(0xB9E08A83A5E34F07), UINT64_C(0xDAF5CCD93FB0CC54)},
+    {UINT64_C(0xE858AD248F5C22C9), UINT64_C(0xD1B3400F8F9CFF69)},
+    {UINT64_C(0x91376C36D99995BE), UINT64_C(0x23100809B9C21FA2)},
+    {UINT64_C(0xB58547448FFFFB2D), UINT64_C(0xABD40A0C2832A78B)},
+    {UINT64_C(0xE2E69915B3FFF9F9), UINT64_C(0x16C90C8F323F516D)},
+    {UINT64_C(0x8DD01FAD907FFC3B), UINT64_C(0xAE3DA7D97F6792E4)},
+    {UINT64_C(0xB1442798F49FFB4A), UINT64_C(0x99CD11CFDF41779D)},
+    {UINT64_C(0xDD95317F31C7FA1D), UINT64_C(0x40405643D711D584)},
+    {UINT64_C(0x8A7D3EEF7F1CFC52), UINT64_C(0x482835EA666B2573)},
+    {UINT64_C(0xAD1C8EAB5EE43B66), UINT64_C(0xDA3243650005EED0)},
+    {UINT64_C(0xD863B256369D4A40), UINT64_C(0x90BED43E40076A83)},
+    {UINT64_C(0x873E4F75E2224E68), UINT64_C(0x5A7744A6E804A292)},
+    {UINT64_C(0xA90DE3535AAAE202), UINT64_C(0x711515D0A205CB37)},
+    {UINT64_C(0xD3515C2831559A83), UINT64_C(0x0D5A5B44CA873E04)},
+    {UINT64_C(0x8412D9991ED58091), UINT64_C(0xE858790AFE9486C3)},
+    {UINT64_C(0xA5178FFF668AE0B6), UINT64_C(0x626E974DBE39A873)},
+    {UINT64_C(0xCE5D73FF402D98E3), UINT64_C(0xFB0A3D212DC81290)},
+    {UINT64_C(0x80FA687F881C7F8E), UINT64_C(0x7CE66634BC9D0B9A)},
+    {UINT64_C(0xA139029F6A239F72), UINT64_C(0x1C1FFFC1EBC44E81)},
+    {UINT64_C(0xC987434744AC874E), UINT64_C(0xA327FFB266B56221)},
+    {UINT64_C(0xFBE9141915D7A922), UINT64_C(0x4BF1FF9F0062BAA9)},
+    {UINT64_C(0x9D71AC8FADA6C9B5), UINT64_C(0x6F773FC3603DB4AA)},
+    {UINT64_C(0xC4CE17B399107C22), UINT64_C(0xCB550FB4384D21D4)},
+    {UINT64_C(0xF6019DA07F549B2B), UINT64_C(0x7E2A53A146606A49)},
+    {UINT64_C(0x99C102844F94E0FB), UINT64_C(0x2EDA7444CBFC426E)},
+    {UINT64_C(0xC0314325637A1939), UINT64_C(0xFA911155FEFB5309)},
+    {UINT64_C(0xF03D93EEBC589F88), UINT64_C(0x793555AB7EBA27CB)},
+    {UINT64_C(0x96267C7535B763B5), UINT64_C(0x4BC1558B2F3458DF)},
+    {UINT64_C(0xBBB01B9283253CA2), UINT64_C(0x9EB1AAEDFB016F17)},
+    {UINT64_C(0xEA9C227723EE8BCB), UINT64_C(0x465E15A979C1CADD)},
+    {UINT64_C(0x92A1958A7675175F), UINT64_C(0x0BFACD89EC191ECA)},
+    {UINT64_C(0xB749FAED14125D36), UINT64_C(0xCEF980EC671F667C)},
+    {UINT64_C(0xE51C79A85916F484), UINT64_C(0x82B7E12780E7401B)},
+    {UINT64_C(0x8F31CC0937AE58D2), UINT64_C(0xD1B2ECB8B0908811)},
+    {UINT64_C(0xB2FE3F0B8599EF07), UINT64_C(0x861FA7E6DCB4AA16)},
+    {UINT64_C(0xDFBDCECE67006AC9), UINT64_C(0x67A791E093E1D49B)},
+    {UINT64_C(0x8BD6A141006042BD), UINT64_C(0xE0C8BB2C5C6D24E1)},
+    {UINT64_C(0xAECC49914078536D), UINT64_C(0x58FAE9F773886E19)},
+    {UINT64_C(0xDA7F5BF590966848), UINT64_C(0xAF39A475506A899F)},
+    {UINT64_C(0x888F99797A5E012D), UINT64_C(0x6D8406C952429604)},
+    {UINT64_C(0xAAB37FD7D8F58178), UINT64_C(0xC8E5087BA6D33B84)},
+    {UINT64_C(0xD5605FCDCF32E1D6), UINT64_C(0xFB1E4A9A90880A65)},
+    {UINT64_C(0x855C3BE0A17FCD26), UINT64_C(0x5CF2EEA09A550680)},
+    {UINT64_C(0xA6B34AD8C9DFC06F), UINT64_C(0xF42FAA48C0EA481F)},
+    {UINT64_C(0xD0601D8EFC57B08B), UINT64_C(0xF13B94DAF124DA27)},
+    {UINT64_C(0x823C12795DB6CE57), UINT64_C(0x76C53D08D6B70859)},
+    {UINT64_C(0xA2CB1717B52481ED), UINT64_C(0x54768C4B0C64CA6F)},
+    {UINT64_C(0xCB7DDCDDA26DA268), UINT64_C(0xA9942F5DCF7DFD0A)},
+    {UINT64_C(0xFE5D54150B090B02), UINT64_C(0xD3F93B35435D7C4D)},
+    {UINT64_C(0x9EFA548D26E5A6E1), UINT64_C(0xC47BC5014A1A6DB0)},
+    {UINT64_C(0xC6B8E9B0709F109A), UINT64_C(0x359AB6419CA1091C)},
+    {UINT64_C(0xF867241C8CC6D4C0), UINT64_C(0xC30163D203C94B63)},
+    {UINT64_C(0x9B407691D7FC44F8), UINT64_C(0x79E0DE63425DCF1E)},
+    {UINT64_C(0xC21094364DFB5636), UINT64_C(0x985915FC12F542E5)},
+    {UINT64_C(0xF294B943E17A2BC4), UINT64_C(0x3E6F5B7B17B2939E)},
+    {UINT64_C(0x979CF3CA6CEC5B5A), UINT64_C(0xA705992CEECF9C43)},
+    {UINT64_C(0xBD8430BD08277231), UINT64_C(0x50C6FF782A838354)},
+    {UINT64_C(0xECE53CEC4A314EBD), UINT64_C(0xA4F8BF5635246429)},
+    {UINT64_C(0x940F4613AE5ED136), UINT64_C(0x871B7795E136BE9A)},
+    {UINT64_C(0xB913179899F68584), UINT64_C(0x28E2557B59846E40)},
+    {UINT64_C(0xE757DD7EC07426E5), UINT64_C(0x331AEADA2FE589D0)},
+    {UINT64_C(0x9096EA6F3848984F), UINT64_C(0x3FF0D2C85DEF7622)},
+    {UINT64_C(0xB4BCA50B065ABE63), UINT64_C(0x0FED077A756B53AA)},
+    {UINT64_C(0xE1EBCE4DC7F16DFB), UINT64_C(0xD3E8495912C62895)},
+    {UINT64_C(0x8D3360F09CF6E4BD), UINT64_C(0x64712DD7ABBBD95D)},
+    {UINT64_C(0xB080392CC4349DEC), UINT64_C(0xBD8D794D96AACFB4)},
+    {UINT64_C(0xDCA04777F541C567), UINT64_C(0xECF0D7A0FC5583A1)},
+    {UINT64_C(0x89E42CAAF9491B60), UINT64_C(0xF41686C49DB57245)},
+    {UINT64_C(0xAC5D37D5B79B6239), UINT64_C(0x311C2875C522CED6)},
+    {UINT64_C(0xD77485CB25823AC7), UINT64_C(0x7D633293366B828C)},
+    {UINT64_C(0x86A8D39EF77164BC), UINT64_C(0xAE5DFF9C02033198)},
+    {UINT64_C(0xA8530886B54DBDEB), UINT64_C(0xD9F57F830283FDFD)},
+    {UINT64_C(0xD267CAA862A12D66), UINT64_C(0xD072DF63C324FD7C)},
+    {UINT64_C(0x8380DEA93DA4BC60), UINT64_C(0x4247CB9E59F71E6E)},
+    {UINT64_C(0xA46116538D0DEB78), UINT64_C(0x52D9BE85F074E609)},
+    {UINT64_C(0xCD795BE870516656), UINT64_C(0x67902E276C921F8C)},
+    {UINT64_C(0x806BD9714632DFF6), UINT64_C(0x00BA1CD8A3DB53B7)},
+    {UINT64_C(0xA086CFCD97BF97F3), UINT64_C(0x80E8A40ECCD228A5)},
+    {UINT64_C(0xC8A883C0FDAF7DF0), UINT64_C(0x6122CD128006B2CE)},
+    {UINT64_C(0xFAD2A4B13D1B5D6C), UINT64_C(0x796B805720085F82)},
+    {UINT64_C(0x9CC3A6EEC6311A63), UINT64_C(0xCBE3303674053BB1)},
+    {UINT64_C(0xC3F490AA77BD60FC), UINT64_C(0xBEDBFC4411068A9D)},
+    {UINT64_C(0xF4F1B4D515ACB93B), UINT64_C(0xEE92FB5515482D45)},
+    {UINT64_C(0x991711052D8BF3C5), UINT64_C(0x751BDD152D4D1C4B)},
+    {UINT64_C(0xBF5CD54678EEF0B6), UINT64_C(0xD262D45A78A0635E)},
+    {UINT64_C(0xEF340A98172AACE4), UINT64_C(0x86FB897116C87C35)},
+    {UINT64_C(0x9580869F0E7AAC0E), UINT64_C(0xD45D35E6AE3D4DA1)},
+    {UINT64_C(0xBAE0A846D2195712), UINT64_C(0x8974836059CCA10A)},
+    {UINT64_C(0xE998D258869FACD7), UINT64_C(0x2BD1A438703FC94C)},
+    {UINT64_C(0x91FF83775423CC06), UINT64_C(0x7B6306A34627DDD0)},
+    {UINT64_C(0xB67F6455292CBF08), UINT64_C(0x1A3BC84C17B1D543)},
+    {UINT64_C(0xE41F3D6A7377EECA), UINT64_C(0x20CABA5F1D9E4A94)},
+    {UINT64_C(0x8E938662882AF53E), UINT64_C(0x547EB47B7282EE9D)},
+    {UINT64_C(0xB23867FB2A35B28D), UINT64_C(0xE99E619A4F23AA44)},
+    {UINT64_C(0xDEC681F9F4C31F31), UINT64_C(0x6405FA00E2EC94D5)},
+    {UINT64_C(0x8B3C113C38F9F37E), UINT64_C(0xDE83BC408DD3DD05)},
+    {UINT64_C(0xAE0B158B4738705E), UINT64_C(0x9624AB50B148D446)},
+    {UINT64_C(0xD98DDAEE19068C76), UINT64_C(0x3BADD624DD9B0958)},
+    {UINT64_C(0x87F8A8D4CFA417C9), UINT64_C(0xE54CA5D70A80E5D7)},
+    {UINT64_C(0xA9F6D30A038D1DBC), UINT64_C(0x5E9FCF4CCD211F4D)},
+    {UINT64_C(0xD47487CC8470652B), UINT64_C(0x7647C32000696720)},
+    {UINT64_C(0x84C8D4DFD2C63F3B), UINT64_C(0x29ECD9F40041E074)},
+    {UINT64_C(0xA5FB0A17C777CF09), UINT64_C(0xF468107100525891)},
+    {UINT64_C(0xCF79CC9DB955C2CC), UINT64_C(0x7182148D4066EEB5)},
+    {UINT64_C(0x81AC1FE293D599BF), UINT64_C(0xC6F14CD848405531)},
+    {UINT64_C(0xA21727DB38CB002F), UINT64_C(0xB8ADA00E5A506A7D)},
+    {UINT64_C(0xCA9CF1D206FDC03B), UINT64_C(0xA6D90811F0E4851D)},
+    {UINT64_C(0xFD442E4688BD304A), UINT64_C(0x908F4A166D1DA664)},
+    {UINT64_C(0x9E4A9CEC15763E2E), UINT64_C(0x9A598E4E043287FF)},
+    {UINT64_C(0xC5DD44271AD3CDBA), UINT64_C(0x40EFF1E1853F29FE)},
+    {UINT64_C(0xF7549530E188C128), UINT64_C(0xD12BEE59E68EF47D)},
+    {UINT64_C(0x9A94DD3E8CF578B9), UINT64_C(0x82BB74F8301958CF)},
+    {UINT64_C(0xC13A148E3032D6E7), UINT64_C(0xE36A52363C1FAF02)},
+    {UINT64_C(0xF18899B1BC3F8CA1), UINT64_C(0xDC44E6C3CB279AC2)},
+    {UINT64_C(0x96F5600F15A7B7E5), UINT64_C(0x29AB103A5EF8C0BA)},
+    {UINT64_C(0xBCB2B812DB11A5DE), UINT64_C(0x7415D448F6B6F0E8)},
+    {UINT64_C(0xEBDF661791D60F56), UINT64_C(0x111B495B3464AD22)},
+    {UINT64_C(0x936B9FCEBB25C995), UINT64_C(0xCAB10DD900BEEC35)},
+    {UINT64_C(0xB84687C269EF3BFB), UINT64_C(0x3D5D514F40EEA743)},
+    {UINT64_C(0xE65829B3046B0AFA), UINT64_C(0x0CB4A5A3112A5113)},
+    {UINT64_C(0x8FF71A0FE2C2E6DC), UINT64_C(0x47F0E785EABA72AC)},
+    {UINT64_C(0xB3F4E093DB73A093), UINT64_C(0x59ED216765690F57)},
+    {UINT64_C(0xE0F218B8D25088B8), UINT64_C(0x306869C13EC3532D)},
+    {UINT64_C(0x8C974F7383725573), UINT64_C(0x1E414218C73A13FC)},
+    {UINT64_C(0xAFBD2350644EEACF), UINT64_C(0xE5D1929EF90898FB)},
+    {UINT64_C(0xDBAC6C247D62A583), UINT64_C(0xDF45F746B74ABF3A)},
+    {UINT64_C(0x894BC396CE5DA772), UINT64_C(0x6B8BBA8C328EB784)},
+    {UINT64_C(0xAB9EB47C81F5114F), UINT64_C(0x066EA92F3F326565)},
+    {UINT64_C(0xD686619BA27255A2), UINT64_C(0xC80A537B0EFEFEBE)},
+    {UINT64_C(0x8613FD0145877585), UINT64_C(0xBD06742CE95F5F37)},
+    {UINT64_C(0xA798FC4196E952E7), UINT64_C(0x2C48113823B73705)},
+    {UINT64_C(0xD17F3B51FCA3A7A0), UINT64_C(0xF75A15862CA504C6)},
+    {UINT64_C(0x82EF85133DE648C4), UINT64_C(0x9A984D73DBE722FC)},
+    {UINT64_C(0xA3AB66580D5FDAF5), UINT64_C(0xC13E60D0D2E0EBBB)},
+    {UINT64_C(0xCC963FEE10B7D1B3), UINT64_C(0x318DF905079926A9)},
+    {UINT64_C(0xFFBBCFE994E5C61F), UINT64_C(0xFDF17746497F7053)},
+    {UINT64_C(0x9FD561F1FD0F9BD3), UINT64_C(0xFEB6EA8BEDEFA634)},
+    {UINT64_C(0xC7CABA6E7C5382C8), UINT64_C(0xFE64A52EE96B8FC1)},
+    {UINT64_C(0xF9BD690A1B68637B), UINT64_C(0x3DFDCE7AA3C673B1)},
+    {UINT64_C(0x9C1661A651213E2D), UINT64_C(0x06BEA10CA65C084F)},
+    {UINT64_C(0xC31BFA0FE5698DB8), UINT64_C(0x486E494FCFF30A63)},
+    {UINT64_C(0xF3E2F893DEC3F126), UINT64_C(0x5A89DBA3C3EFCCFB)},
+    {UINT64_C(0x986DDB5C6B3A76B7), UINT64_C(0xF89629465A75E01D)},
+    {UINT64_C(0xBE89523386091465), UINT64_C(0xF6BBB397F1135824)},
+    {UINT64_C(0xEE2BA6C0678B597F), UINT64_C(0x746AA07DED582E2D)},
+    {UINT64_C(0x94DB483840B717EF), UINT64_C(0xA8C2A44EB4571CDD)},
+    {UINT64_C(0xBA121A4650E4DDEB), UINT64_C(0x92F34D62616CE414)},
+    {UINT64_C(0xE896A0D7E51E1566), UINT64_C(0x77B020BAF9C81D18)},
+    {UINT64_C(0x915E2486EF32CD60), UINT64_C(0x0ACE1474DC1D122F)},
+    {UINT64_C(0xB5B5ADA8AAFF80B8), UINT64_C(0x0D819992132456BB)},
+    {UINT64_C(0xE3231912D5BF60E6), UINT64_C(0x10E1FFF697ED6C6A)},
+    {UINT64_C(0x8DF5EFABC5979C8F), UINT64_C(0xCA8D3FFA1EF463C2)},
+    {UINT64_C(0xB1736B96B6FD83B3), UINT64_C(0xBD308FF8A6B17CB3)},
+    {UINT64_C(0xDDD0467C64BCE4A0), UINT64_C(0xAC7CB3F6D05DDBDF)},
+    {UINT64_C(0x8AA22C0DBEF60EE4), UINT64_C(0x6BCDF07A423AA96C)},
+    {UINT64_C(0xAD4AB7112EB3929D), UINT64_C(0x86C16C98D2C953C7)},
+    {UINT64_C(0xD89D64D57A607744), UINT64_C(0xE871C7BF077BA8B8)},
+    {UINT64_C(0x87625F056C7C4A8B), UINT64_C(0x11471CD764AD4973)},
+    {UINT64_C(0xA93AF6C6C79B5D2D), UINT64_C(0xD598E40D3DD89BD0)},
+    {UINT64_C(0xD389B47879823479), UINT64_C(0x4AFF1D108D4EC2C4)},
+    {UINT64_C(0x843610CB4BF160CB), UINT64_C(0xCEDF722A585139BB)},
+    {UINT64_C(0xA54394FE1EEDB8FE), UINT64_C(0xC2974EB4EE658829)},
+    {UINT64_C(0xCE947A3DA6A9273E), UINT64_C(0x733D226229FEEA33)},
+    {UINT64_C(0x811CCC668829B887), UINT64_C(0x0806357D5A3F5260)},
+    {UINT64_C(0xA163FF802A3426A8), UINT64_C(0xCA07C2DCB0CF26F8)},
+    {UINT64_C(0xC9BCFF6034C13052), UINT64_C(0xFC89B393DD02F0B6)},
+    {UINT64_C(0xFC2C3F3841F17C67), UINT64_C(0xBBAC2078D443ACE3)},
+    {UINT64_C(0x9D9BA7832936EDC0), UINT64_C(0xD54B944B84AA4C0E)},
+    {UINT64_C(0xC5029163F384A931), UINT64_C(0x0A9E795E65D4DF12)},
+    {UINT64_C(0xF64335BCF065D37D), UINT64_C(0x4D4617B5FF4A16D6)},
+    {UINT64_C(0x99EA0196163FA42E), UINT64_C(0x504BCED1BF8E4E46)},
+    {UINT64_C(0xC06481FB9BCF8D39), UINT64_C(0xE45EC2862F71E1D7)},
+    {UINT64_C(0xF07DA27A82C37088), UINT64_C(0x5D767327BB4E5A4D)},
+    {UINT64_C(0x964E858C91BA2655), UINT64_C(0x3A6A07F8D510F870)},
+    {UINT64_C(0xBBE226EFB628AFEA), UINT64_C(0x890489F70A55368C)},
+    {UINT64_C(0xEADAB0ABA3B2DBE5), UINT64_C(0x2B45AC74CCEA842F)},
+    {UINT64_C(0x92C8AE6B464FC96F), UINT64_C(0x3B0B8BC90012929E)},
+    {UINT64_C(0xB77ADA0617E3BBCB), UINT64_C(0x09CE6EBB40173745)},
+    {UINT64_C(0xE55990879DDCAABD), UINT64_C(0xCC420A6A101D0516)},
+    {UINT64_C(0x8F57FA54C2A9EAB6), UINT64_C(0x9FA946824A12232E)},
+    {UINT64_C(0xB32DF8E9F3546564), UINT64_C(0x47939822DC96ABFA)},
+    {UINT64_C(0xDFF9772470297EBD), UINT64_C(0x59787E2B93BC56F8)},
+    {UINT64_C(0x8BFBEA76C619EF36), UINT64_C(0x57EB4EDB3C55B65B)},
+    {UINT64_C(0xAEFAE51477A06B03), UINT64_C(0xEDE622920B6B23F2)},
+    {UINT64_C(0xDAB99E59958885C4), UINT64_C(0xE95FAB368E45ECEE)},
+    {UINT64_C(0x88B402F7FD75539B), UINT64_C(0x11DBCB0218EBB415)},
+    {UINT64_C(0xAAE103B5FCD2A881), UINT64_C(0xD652BDC29F26A11A)},
+    {UINT64_C(0xD59944A37C0752A2), UINT64_C(0x4BE76D3346F04960)},
+    {UINT64_C(0x857FCAE62D8493A5), UINT64_C(0x6F70A4400C562DDC)},
+    {UINT64_C(0xA6DFBD9FB8E5B88E), UINT64_C(0xCB4CCD500F6BB953)},
+    {UINT64_C(0xD097AD07A71F26B2), UINT64_C(0x7E2000A41346A7A8)},
+    {UINT64_C(0x825ECC24C873782F), UINT64_C(0x8ED400668C0C28C9)},
+    {UINT64_C(0xA2F67F2DFA90563B), UINT64_C(0x728900802F0F32FB)},
+    {UINT64_C(0xCBB41EF979346BCA), UINT64_C(0x4F2B40A03AD2FFBA)},
+    {UINT64_C(0xFEA126B7D78186BC), UINT64_C(0xE2F610C84987BFA9)},
+    {UINT64_C(0x9F24B832E6B0F436), UINT64_C(0x0DD9CA7D2DF4D7CA)},
+    {UINT64_C(0xC6EDE63FA05D3143), UINT64_C(0x91503D1C79720DBC)},
+    {UINT64_C(0xF8A95FCF88747D94), UINT64_C(0x75A44C6397CE912B)},
+    {UINT64_C(0x9B69DBE1B548CE7C), UINT64_C(0xC986AFBE3EE11ABB)},
+    {UINT64_C(0xC24452DA229B021B), UINT64_C(0xFBE85BADCE996169)},
+    {UINT64_C(0xF2D56790AB41C2A2), UINT64_C(0xFAE27299423FB9C4)},
+    {UINT64_C(0x97C560BA6B0919A5), UINT64_C(0xDCCD879FC967D41B)},
+    {UINT64_C(0xBDB6B8E905CB600F), UINT64_C(0x5400E987BBC1C921)},
+    {UINT64_C(0xED246723473E3813), UINT64_C(0x290123E9AAB23B69)},
+    {UINT64_C(0x9436C0760C86E30B), UINT64_C(0xF9A0B6720AAF6522)},
+    {UINT64_C(0xB94470938FA89BCE), UINT64_C(0xF808E40E8D5B3E6A)},
+    {UINT64_C(0xE7958CB87392C2C2), UINT64_C(0xB60B1D1230B20E05)},
+    {UINT64_C(0x90BD77F3483BB9B9), UINT64_C(0xB1C6F22B5E6F48C3)},
+    {UINT64_C(0xB4ECD5F01A4AA828), UINT64_C(0x1E38AEB6360B1AF4)},
+    {UINT64_C(0xE2280B6C20DD5232), UINT64_C(0x25C6DA63C38DE1B1)},
+    {UINT64_C(0x8D590723948A535F), UINT64_C(0x579C487E5A38AD0F)},
+    {UINT64_C(0xB0AF48EC79ACE837), UINT64_C(0x2D835A9DF0C6D852)},
+    {UINT64_C(0xDCDB1B2798182244), UINT64_C(0xF8E431456CF88E66)},
+    {UINT64_C(0x8A08F0F8BF0F156B), UINT64_C(0x1B8E9ECB641B5900)},
+    {UINT64_C(0xAC8B2D36EED2DAC5), UINT64_C(0xE272467E3D222F40)},
+    {UINT64_C(0xD7ADF884AA879177), UINT64_C(0x5B0ED81DCC6ABB10)},
+    {UINT64_C(0x86CCBB52EA94BAEA), UINT64_C(0x98E947129FC2B4EA)},
+    {UINT64_C(0xA87FEA27A539E9A5), UINT64_C(0x3F2398D747B36225)},
+    {UINT64_C(0xD29FE4B18E88640E), UINT64_C(0x8EEC7F0D19A03AAE)},
+    {UINT64_C(0x83A3EEEEF9153E89), UINT64_C(0x1953CF68300424AD)},
+    {UINT64_C(0xA48CEAAAB75A8E2B), UINT64_C(0x5FA8C3423C052DD8)},
+    {UINT64_C(0xCDB02555653131B6), UINT64_C(0x3792F412CB06794E)},
+    {UINT64_C(0x808E17555F3EBF11), UINT64_C(0xE2BBD88BBEE40BD1)},
+    {UINT64_C(0xA0B19D2AB70E6ED6), UINT64_C(0x5B6ACEAEAE9D0EC5)},
+    {UINT64_C(0xC8DE047564D20A8B), UINT64_C(0xF245825A5A445276)},
+    {UINT64_C(0xFB158592BE068D2E), UINT64_C(0xEED6E2F0F0D56713)},
+    {UINT64_C(0x9CED737BB6C4183D), UINT64_C(0x55464DD69685606C)},
+    {UINT64_C(0xC428D05AA4751E4C), UINT64_C(0xAA97E14C3C26B887)},
+    {UINT64_C(0xF53304714D9265DF), UINT64_C(0xD53DD99F4B3066A9)},
+    {UINT64_C(0x993FE2C6D07B7FAB), UINT64_C(0xE546A8038EFE402A)},
+    {UINT64_C(0xBF8FDB78849A5F96), UINT64_C(0xDE98520472BDD034)},
+    {UINT64_C(0xEF73D256A5C0F77C), UINT64_C(0x963E66858F6D4441)},
+    {UINT64_C(0x95A8637627989AAD), UINT64_C(0xDDE7001379A44AA9)},
+    {UINT64_C(0xBB127C53B17EC159), UINT64_C(0x5560C018580D5D53)},
+    {UINT64_C(0xE9D71B689DDE71AF), UINT64_C(0xAAB8F01E6E10B4A7)},
+    {UINT64_C(0x9226712162AB070D), UINT64_C(0xCAB3961304CA70E9)},
+    {UINT64_C(0xB6B00D69BB55C8D1), UINT64_C(0x3D607B97C5FD0D23)},
+    {UINT64_C(0xE45C10C42A2B3B05), UINT64_C(0x8CB89A7DB77C506B)},
+    {UINT64_C(0x8EB98A7A9A5B04E3), UINT64_C(0x77F3608E92ADB243)},
+    {UINT64_C(0xB267ED1940F1C61C), UINT64_C(0x55F038B237591ED4)},
+    {UINT64_C(0xDF01E85F912E37A3), UINT64_C(0x6B6C46DEC52F6689)},
+    {UINT64_C(0x8B61313BBABCE2C6), UINT64_C(0x2323AC4B3B3DA016)},
+    {UINT64_C(0xAE397D8AA96C1B77), UINT64_C(0xABEC975E0A0D081B)},
+    {UINT64_C(0xD9C7DCED53C72255), UINT64_C(0x96E7BD358C904A22)},
+    {UINT64_C(0x881CEA14545C7575), UINT64_C(0x7E50D64177DA2E55)},
+    {UINT64_C(0xAA242499697392D2), UINT64_C(0xDDE50BD1D5D0B9EA)},
+    {UINT64_C(0xD4AD2DBFC3D07787), UINT64_C(0x955E4EC64B44E865)},
+    {UINT64_C(0x84EC3C97DA624AB4), UINT64_C(0xBD5AF13BEF0B113F)},
+    {UINT64_C(0xA6274BBDD0FADD61), UINT64_C(0xECB1AD8AEACDD58F)},
+    {UINT64_C(0xCFB11EAD453994BA), UINT64_C(0x67DE18EDA5814AF3)},
+    {UINT64_C(0x81CEB32C4B43FCF4), UINT64_C(0x80EACF948770CED8)},
+    {UINT64_C(0xA2425FF75E14FC31), UINT64_C(0xA1258379A94D028E)},
+    {UINT64_C(0xCAD2F7F5359A3B3E), UINT64_C(0x096EE45813A04331)},
+    {UINT64_C(0xFD87B5F28300CA0D), UINT64_C(0x8BCA9D6E188853FD)},
+    {UINT64_C(0x9E74D1B791E07E48), UINT64_C(0x775EA264CF55347E)},
+    {UINT64_C(0xC612062576589DDA), UINT64_C(0x95364AFE032A819E)},
+    {UINT64_C(0xF79687AED3EEC551), UINT64_C(0x3A83DDBD83F52205)},
+    {UINT64_C(0x9ABE14CD44753B52), UINT64_C(0xC4926A9672793543)},
+    {UINT64_C(0xC16D9A0095928A27), UINT64_C(0x75B7053C0F178294)},
+    {UINT64_C(0xF1C90080BAF72CB1), UINT64_C(0x5324C68B12DD6339)},
+    {UINT64_C(0x971DA05074DA7BEE), UINT64_C(0xD3F6FC16EBCA5E04)},
+    {UINT64_C(0xBCE5086492111AEA), UINT64_C(0x88F4BB1CA6BCF585)},
+    {UINT64_C(0xEC1E4A7DB69561A5), UINT64_C(0x2B31E9E3D06C32E6)},
+    {UINT64_C(0x9392EE8E921D5D07), UINT64_C(0x3AFF322E62439FD0)},
+    {UINT64_C(0xB877AA3236A4B449), UINT64_C(0x09BEFEB9FAD487C3)},
+    {UINT64_C(0xE69594BEC44DE15B), UINT64_C(0x4C2EBE687989A9B4)},
+    {UINT64_C(0x901D7CF73AB0ACD9), UINT64_C(0x0F9D37014BF60A11)},
+    {UINT64_C(0xB424DC35095CD80F), UINT64_C(0x538484C19EF38C95)},
+    {UINT64_C(0xE12E13424BB40E13), UINT64_C(0x2865A5F206B06FBA)},
+    {UINT64_C(0x8CBCCC096F5088CB), UINT64_C(0xF93F87B7442E45D4)},
+    {UINT64_C(0xAFEBFF0BCB24AAFE), UINT64_C(0xF78F69A51539D749)},
+    {UINT64_C(0xDBE6FECEBDEDD5BE), UINT64_C(0xB573440E5A884D1C)},
+    {UINT64_C(0x89705F4136B4A597), UINT64_C(0x31680A88F8953031)},
+    {UINT64_C(0xABCC77118461CEFC), UINT64_C(0xFDC20D2B36BA7C3E)},
+    {UINT64_C(0xD6BF94D5E57A42BC), UINT64_C(0x3D32907604691B4D)},
+    {UINT64_C(0x8637BD05AF6C69B5), UINT64_C(0xA63F9A49C2C1B110)},
+    {UINT64_C(0xA7C5AC471B478423), UINT64_C(0x0FCF80DC33721D54)},
+    {UINT64_C(0xD1B71758E219652B), UINT64_C(0xD3C36113404EA4A9)},
+    {UINT64_C(0x83126E978D4FDF3B), UINT64_C(0x645A1CAC083126EA)},
+    {UINT64_C(0xA3D70A3D70A3D70A), UINT64_C(0x3D70A3D70A3D70A4)},
+    {UINT64_C(0xCCCCCCCCCCCCCCCC), UINT64_C(0xCCCCCCCCCCCCCCCD)},
+    {UINT64_C(0x8000000000000000), UINT64_C(0x0000000000000001)},
+    {UINT64_C(0xA000000000000000), UINT64_C(0x0000000000000001)},
+    {UINT64_C(0xC800000000000000), UINT64_C(0x0000000000000001)},
+    {UINT64_C(0xFA00000000000000), UINT64_C(0x0000000000000001)},
+    {UINT64_C(0x9C40000000000000), UINT64_C(0x0000000000000001)},
+    {UINT64_C(0xC350000000000000), UINT64_C(0x0000000000000001)},
+    {UINT64_C(0xF424000000000000), UINT64_C(0x0000000000000001)},
+    {UINT64_C(0x9896800000000000), UINT64_C(0x0000000000000001)},
+    {UINT64_C(0xBEBC200000000000), UINT64_C(0x0000000000000001)},
+    {UINT64_C(0xEE6B280000000000), UINT64_C(0x0000000000000001)},
+    {UINT64_C(0x9502F90000000000), UINT64_C(0x0000000000000001)},
+    {UINT64_C(0xBA43B74000000000), UINT64_C(0x0000000000000001)},
+    {UINT64_C(0xE8D4A51000000000), UINT64_C(0x0000000000000001)},
+    {UINT64_C(0x9184E72A00000000), UINT64_C(0x0000000000000001)},
+    {UINT64_C(0xB5E620F480000000), UINT64_C(0x0000000000000001)},
+    {UINT64_C(0xE35FA931A0000000), UINT64_C(0x0000000000000001)},
+    {UINT64_C(0x8E1BC9BF04000000), UINT64_C(0x0000000000000001)},
+    {UINT64_C(0xB1A2BC2EC5000000), UINT64_C(0x0000000000000001)},
+    {UINT64_C(0xDE0B6B3A76400000), UINT64_C(0x0000000000000001)},
+    {UINT64_C(0x8AC7230489E80000), UINT64_C(0x0000000000000001)},
+    {UINT64_C(0xAD78EBC5AC620000), UINT64_C(0x0000000000000001)},
+    {UINT64_C(0xD8D726B7177A8000), UINT64_C(0x0000000000000001)},
+    {UINT64_C(0x878678326EAC9000), UINT64_C(0x0000000000000001)},
+    {UINT64_C(0xA968163F0A57B400), UINT64_C(0x0000000000000001)},
+    {UINT64_C(0xD3C21BCECCEDA100), UINT64_C(0x0000000000000001)},
+    {UINT64_C(0x84595161401484A0), UINT64_C(0x0000000000000001)},
+    {UINT64_C(0xA56FA5B99019A5C8), UINT64_C(0x0000000000000001)},
+    {UINT64_C(0xCECB8F27F4200F3A), UINT64_C(0x0000000000000001)},
+    {UINT64_C(0x813F3978F8940984), UINT64_C(0x4000000000000001)},
+    {UINT64_C(0xA18F07D736B90BE5), UINT64_C(0x5000000000000001)},
+    {UINT64_C(0xC9F2C9CD04674EDE), UINT64_C(0xA400000000000001)},
+    {UINT64_C(0xFC6F7C4045812296), UINT64_C(0x4D00000000000001)},
+    {UINT64_C(0x9DC5ADA82B70B59D), UINT64_C(0xF020000000000001)},
+    {UINT64_C(0xC5371912364CE305), UINT64_C(0x6C28000000000001)},
+    {UINT64_C(0xF684DF56C3E01BC6), UINT64_C(0xC732000000000001)},
+    {UINT64_C(0x9A130B963A6C115C), UINT64_C(0x3C7F400000000001)},
+    {UINT64_C(0xC097CE7BC90715B3), UINT64_C(0x4B9F100000000001)},
+    {UINT64_C(0xF0BDC21ABB48DB20), UINT64_C(0x1E86D40000000001)},
+    {UINT64_C(0x96769950B50D88F4), UINT64_C(0x1314448000000001)},
+    {UINT64_C(0xBC143FA4E250EB31), UINT64_C(0x17D955A000000001)},
+    {UINT64_C(0xEB194F8E1AE525FD), UINT64_C(0x5DCFAB0800000001)},
+    {UINT64_C(0x92EFD1B8D0CF37BE), UINT64_C(0x5AA1CAE500000001)},
+    {UINT64_C(0xB7ABC627050305AD), UINT64_C(0xF14A3D9E40000001)},
+    {UINT64_C(0xE596B7B0C643C719), UINT64_C(0x6D9CCD05D0000001)},
+    {UINT64_C(0x8F7E32CE7BEA5C6F), UINT64_C(0xE4820023A2000001)},
+    {UINT64_C(0xB35DBF821AE4F38B), UINT64_C(0xDDA2802C8A800001)},
+    {UINT64_C(0xE0352F62A19E306E), UINT64_C(0xD50B2037AD200001)},
+    {UINT64_C(0x8C213D9DA502DE45), UINT64_C(0x4526F422CC340001)},
+    {UINT64_C(0xAF298D050E4395D6), UINT64_C(0x9670B12B7F410001)},
+    {UINT64_C(0xDAF3F04651D47B4C), UINT64_C(0x3C0CDD765F114001)},
+    {UINT64_C(0x88D8762BF324CD0F), UINT64_C(0xA5880A69FB6AC801)},
+    {UINT64_C(0xAB0E93B6EFEE0053), UINT64_C(0x8EEA0D047A457A01)},
+    {UINT64_C(0xD5D238A4ABE98068), UINT64_C(0x72A4904598D6D881)},
+    {UINT64_C(0x85A36366EB71F041), UINT64_C(0x47A6DA2B7F864751)},
+    {UINT64_C(0xA70C3C40A64E6C51), UINT64_C(0x999090B65F67D925)},
+    {UINT64_C(0xD0CF4B50CFE20765), UINT64_C(0xFFF4B4E3F741CF6E)},
+    {UINT64_C(0x82818F1281ED449F), UINT64_C(0xBFF8F10E7A8921A5)},
+    {UINT64_C(0xA321F2D7226895C7), UINT64_C(0xAFF72D52192B6A0E)},
+    {UINT64_C(0xCBEA6F8CEB02BB39), UINT64_C(0x9BF4F8A69F764491)},
+    {UINT64_C(0xFEE50B7025C36A08), UINT64_C(0x02F236D04753D5B5)},
+    {UINT64_C(0x9F4F2726179A2245), UINT64_C(0x01D762422C946591)},
+    {UINT64_C(0xC722F0EF9D80AAD6), UINT64_C(0x424D3AD2B7B97EF6)},
+    {UINT64_C(0xF8EBAD2B84E0D58B), UINT64_C(0xD2E0898765A7DEB3)},
+    {UINT64_C(0x9B934C3B330C8577), UINT64_C(0x63CC55F49F88EB30)},
+    {UINT64_C(0xC2781F49FFCFA6D5), UINT64_C(0x3CBF6B71C76B25FC)},
+    {UINT64_C(0xF316271C7FC3908A), UINT64_C(0x8BEF464E3945EF7B)},
+    {UINT64_C(0x97EDD871CFDA3A56), UINT64_C(0x97758BF0E3CBB5AD)},
+    {UINT64_C(0xBDE94E8E43D0C8EC), UINT64_C(0x3D52EEED1CBEA318)},
+    {UINT64_C(0xED63A231D4C4FB27), UINT64_C(0x4CA7AAA863EE4BDE)},
+    {UINT64_C(0x945E455F24FB1CF8), UINT64_C(0x8FE8CAA93E74EF6B)},
+    {UINT64_C(0xB975D6B6EE39E436), UINT64_C(0xB3E2FD538E122B45)},
+    {UINT64_C(0xE7D34C64A9C85D44), UINT64_C(0x60DBBCA87196B617)},
+    {UINT64_C(0x90E40FBEEA1D3A4A), UINT64_C(0xBC8955E946FE31CE)},
+    {UINT64_C(0xB51D13AEA4A488DD), UINT64_C(0x6BABAB6398BDBE42)},
+    {UINT64_C(0xE264589A4DCDAB14), UINT64_C(0xC696963C7EED2DD2)},
+    {UINT64_C(0x8D7EB76070A08AEC), UINT64_C(0xFC1E1DE5CF543CA3)},
+    {UINT64_C(0xB0DE65388CC8ADA8), UINT64_C(0x3B25A55F43294BCC)},
+    {UINT64_C(0xDD15FE86AFFAD912), UINT64_C(0x49EF0EB713F39EBF)},
+    {UINT64_C(0x8A2DBF142DFCC7AB), UINT64_C(0x6E3569326C784338)},
+    {UINT64_C(0xACB92ED9397BF996), UINT64_C(0x49C2C37F07965405)},
+    {UINT64_C(0xD7E77A8F87DAF7FB), UINT64_C(0xDC33745EC97BE907)},
+    {UINT64_C(0x86F0AC99B4E8DAFD), UINT64_C(0x69A028BB3DED71A4)},
+    {UINT64_C(0xA8ACD7C0222311BC), UINT64_C(0xC40832EA0D68CE0D)},
+    {UINT64_C(0xD2D80DB02AABD62B), UINT64_C(0xF50A3FA490C30191)},
+    {UINT64_C(0x83C7088E1AAB65DB), UINT64_C(0x792667C6DA79E0FB)},
+    {UINT64_C(0xA4B8CAB1A1563F52), UINT64_C(0x577001B891185939)},
+    {UINT64_C(0xCDE6FD5E09ABCF26), UINT64_C(0xED4C0226B55E6F87)},
+    {UINT64_C(0x80B05E5AC60B6178), UINT64_C(0x544F8158315B05B5)},
+    {UINT64_C(0xA0DC75F1778E39D6), UINT64_C(0x696361AE3DB1C722)},
+    {UINT64_C(0xC913936DD571C84C), UINT64_C(0x03BC3A19CD1E38EA)},
+    {UINT64_C(0xFB5878494ACE3A5F), UINT64_C(0x04AB48A04065C724)},
+    {UINT64_C(0x9D174B2DCEC0E47B), UINT64_C(0x62EB0D64283F9C77)},
+    {UINT64_C(0xC45D1DF942711D9A), UINT64_C(0x3BA5D0BD324F8395)},
+    {UINT64_C(0xF5746577930D6500), UINT64_C(0xCA8F44EC7EE3647A)},
+    {UINT64_C(0x9968BF6ABBE85F20), UINT64_C(0x7E998B13CF4E1ECC)},
+    {UINT64_C(0xBFC2EF456AE276E8), UINT64_C(0x9E3FEDD8C321A67F)},
+    {UINT64_C(0xEFB3AB16C59B14A2), UINT64_C(0xC5CFE94EF3EA101F)},
+    {UINT64_C(0x95D04AEE3B80ECE5), UINT64_C(0xBBA1F1D158724A13)},
+    {UINT64_C(0xBB445DA9CA61281F), UINT64_C(0x2A8A6E45AE8EDC98)},
+    {UINT64_C(0xEA1575143CF97226), UINT64_C(0xF52D09D71A3293BE)},
+    {UINT64_C(0x924D692CA61BE758), UINT64_C(0x593C2626705F9C57)},
+    {UINT64_C(0xB6E0C377CFA2E12E), UINT64_C(0x6F8B2FB00C77836D)},
+    {UINT64_C(0xE498F455C38B997A), UINT64_C(0x0B6DFB9C0F956448)},
+    {UINT64_C(0x8EDF98B59A373FEC), UINT64_C(0x4724BD4189BD5EAD)},
+    {UINT64_C(0xB2977EE300C50FE7), UINT64_C(0x58EDEC91EC2CB658)},
+    {UINT64_C(0xDF3D5E9BC0F653E1), UINT64_C(0x2F2967B66737E3EE)},
+    {UINT64_C(0x8B865B215899F46C), UINT64_C(0xBD79E0D20082EE75)},
+    {UINT64_C(0xAE67F1E9AEC07187), UINT64_C(0xECD8590680A3AA12)},
+    {UINT64_C(0xDA01EE641A708DE9), UINT64_C(0xE80E6F4820CC9496)},
+    {UINT64_C(0x884134FE908658B2), UINT64_C(0x3109058D147FDCDE)},
+    {UINT64_C(0xAA51823E34A7EEDE), UINT64_C(0xBD4B46F0599FD416)},
+    {UINT64_C(0xD4E5E2CDC1D1EA96), UINT64_C(0x6C9E18AC7007C91B)},
+    {UINT64_C(0x850FADC09923329E), UINT64_C(0x03E2CF6BC604DDB1)},
+    {UINT64_C(0xA6539930BF6BFF45), UINT64_C(0x84DB8346B786151D)},
+    {UINT64_C(0xCFE87F7CEF46FF16), UINT64_C(0xE612641865679A64)},
+    {UINT64_C(0x81F14FAE158C5F6E), UINT64_C(0x4FCB7E8F3F60C07F)},
+    {UINT64_C(0xA26DA3999AEF7749), UINT64_C(0xE3BE5E330F38F09E)},
+    {UINT64_C(0xCB090C8001AB551C), UINT64_C(0x5CADF5BFD3072CC6)},
+    {UINT64_C(0xFDCB4FA002162A63), UINT64_C(0x73D9732FC7C8F7F7)},
+    {UINT64_C(0x9E9F11C4014DDA7E), UINT64_C(0x2867E7FDDCDD9AFB)},
+    {UINT64_C(0xC646D63501A1511D), UINT64_C(0xB281E1FD541501B9)},
+    {UINT64_C(0xF7D88BC24209A565), UINT64_C(0x1F225A7CA91A4227)},
+    {UINT64_C(0x9AE757596946075F), UINT64_C(0x3375788DE9B06959)},
+    {UINT64_C(0xC1A12D2FC3978937), UINT64_C(0x0052D6B1641C83AF)},
+    {UINT64_C(0xF209787BB47D6B84), UINT64_C(0xC0678C5DBD23A49B)},
+    {UINT64_C(0x9745EB4D50CE6332), UINT64_C(0xF840B7BA963646E1)},
+    {UINT64_C(0xBD176620A501FBFF), UINT64_C(0xB650E5A93BC3D899)},
+    {UINT64_C(0xEC5D3FA8CE427AFF), UINT64_C(0xA3E51F138AB4CEBF)},
+    {UINT64_C(0x93BA47C980E98CDF), UINT64_C(0xC66F336C36B10138)},
+    {UINT64_C(0xB8A8D9BBE123F017), UINT64_C(0xB80B0047445D4185)},
+    {UINT64_C(0xE6D3102AD96CEC1D), UINT64_C(0xA60DC059157491E6)},
+    {UINT64_C(0x9043EA1AC7E41392), UINT64_C(0x87C89837AD68DB30)},
+    {UINT64_C(0xB454E4A179DD1877), UINT64_C(0x29BABE4598C311FC)},
+    {UINT64_C(0xE16A1DC9D8545E94), UINT64_C(0xF4296DD6FEF3D67B)},
+    {UINT64_C(0x8CE2529E2734BB1D), UINT64_C(0x1899E4A65F58660D)},
+    {UINT64_C(0xB01AE745B101E9E4), UINT64_C(0x5EC05DCFF72E7F90)},
+    {UINT64_C(0xDC21A1171D42645D), UINT64_C(0x76707543F4FA1F74)},
+    {UINT64_C(0x899504AE72497EBA), UINT64_C(0x6A06494A791C53A9)},
+    {UINT64_C(0xABFA45DA0EDBDE69), UINT64_C(0x0487DB9D17636893)},
+    {UINT64_C(0xD6F8D7509292D603), UINT64_C(0x45A9D2845D3C42B7)},
+    {UINT64_C(0x865B86925B9BC5C2), UINT64_C(0x0B8A2392BA45A9B3)},
+    {UINT64_C(0xA7F26836F282B732), UINT64_C(0x8E6CAC7768D7141F)},
+    {UINT64_C(0xD1EF0244AF2364FF), UINT64_C(0x3207D795430CD927)},
+    {UINT64_C(0x8335616AED761F1F), UINT64_C(0x7F44E6BD49E807B9)},
+    {UINT64_C(0xA402B9C5A8D3A6E7), UINT64_C(0x5F16206C9C6209A7)},
+    {UINT64_C(0xCD036837130890A1), UINT64_C(0x36DBA887C37A8C10)},
+    {UINT64_C(0x802221226BE55A64), UINT64_C(0xC2494954DA2C978A)},
+    {UINT64_C(0xA02AA96B06DEB0FD), UINT64_C(0xF2DB9BAA10B7BD6D)},
+    {UINT64_C(0xC83553C5C8965D3D), UINT64_C(0x6F92829494E5ACC8)},
+    {UINT64_C(0xFA42A8B73ABBF48C), UINT64_C(0xCB772339BA1F17FA)},
+    {UINT64_C(0x9C69A97284B578D7), UINT64_C(0xFF2A760414536EFC)},
+    {UINT64_C(0xC38413CF25E2D70D), UINT64_C(0xFEF5138519684ABB)},
+    {UINT64_C(0xF46518C2EF5B8CD1), UINT64_C(0x7EB258665FC25D6A)},
+    {UINT64_C(0x98BF2F79D5993802), UINT64_C(0xEF2F773FFBD97A62)},
+    {UINT64_C(0xBEEEFB584AFF8603), UINT64_C(0xAAFB550FFACFD8FB)},
+    {UINT64_C(0xEEAABA2E5DBF6784), UINT64_C(0x95BA2A53F983CF39)},
+    {UINT64_C(0x952AB45CFA97A0B2), UINT64_C(0xDD945A747BF26184)},
+    {UINT64_C(0xBA756174393D88DF), UINT64_C(0x94F971119AEEF9E5)},
+    {UINT64_C(0xE912B9D1478CEB17), UINT64_C(0x7A37CD5601AAB85E)},
+    {UINT64_C(0x91ABB422CCB812EE), UINT64_C(0xAC62E055C10AB33B)},
+    {UINT64_C(0xB616A12B7FE617AA), UINT64_C(0x577B986B314D600A)},
+    {UINT64_C(0xE39C49765FDF9D94), UINT64_C(0xED5A7E85FDA0B80C)},
+    {UINT64_C(0x8E41ADE9FBEBC27D), UINT64_C(0x14588F13BE847308)},
+    {UINT64_C(0xB1D219647AE6B31C), UINT64_C(0x596EB2D8AE258FC9)},
+    {UINT64_C(0xDE469FBD99A05FE3), UINT64_C(0x6FCA5F8ED9AEF3BC)},
+    {UINT64_C(0x8AEC23D680043BEE), UINT64_C(0x25DE7BB9480D5855)},
+    {UINT64_C(0xADA72CCC20054AE9), UINT64_C(0xAF561AA79A10AE6B)},
+    {UINT64_C(0xD910F7FF28069DA4), UINT64_C(0x1B2BA1518094DA05)},
+    {UINT64_C(0x87AA9AFF79042286), UINT64_C(0x90FB44D2F05D0843)},
+    {UINT64_C(0xA99541BF57452B28), UINT64_C(0x353A1607AC744A54)},
+    {UINT64_C(0xD3FA922F2D1675F2), UINT64_C(0x42889B8997915CE9)},
+    {UINT64_C(0x847C9B5D7C2E09B7), UINT64_C(0x69956135FEBADA12)},
+    {UINT64_C(0xA59BC234DB398C25), UINT64_C(0x43FAB9837E699096)},
+    {UINT64_C(0xCF02B2C21207EF2E), UINT64_C(0x94F967E45E03F4BC)},
+    {UINT64_C(0x8161AFB94B44F57D), UINT64_C(0x1D1BE0EEBAC278F6)},
+    {UINT64_C(0xA1BA1BA79E1632DC), UINT64_C(0x6462D92A69731733)},
+    {UINT64_C(0xCA28A291859BBF93), UINT64_C(0x7D7B8F7503CFDCFF)},
+    {UINT64_C(0xFCB2CB35E702AF78), UINT64_C(0x5CDA735244C3D43F)},
+    {UINT64_C(0x9DEFBF01B061ADAB), UINT64_C(0x3A0888136AFA64A8)},
+    {UINT64_C(0xC56BAEC21C7A1916), UINT64_C(0x088AAA1845B8FDD1)},
+    {UINT64_C(0xF6C69A72A3989F5B), UINT64_C(0x8AAD549E57273D46)},
+    {UINT64_C(0x9A3C2087A63F6399), UINT64_C(0x36AC54E2F678864C)},
+    {UINT64_C(0xC0CB28A98FCF3C7F), UINT64_C(0x84576A1BB416A7DE)},
+    {UINT64_C(0xF0FDF2D3F3C30B9F), UINT64_C(0x656D44A2A11C51D6)},
+    {UINT64_C(0x969EB7C47859E743), UINT64_C(0x9F644AE5A4B1B326)},
+    {UINT64_C(0xBC4665B596706114), UINT64_C(0x873D5D9F0DDE1FEF)},
+    {UINT64_C(0xEB57FF22FC0C7959), UINT64_C(0xA90CB506D155A7EB)},
+    {UINT64_C(0x9316FF75DD87CBD8), UINT64_C(0x09A7F12442D588F3)},
+    {UINT64_C(0xB7DCBF5354E9BECE), UINT64_C(0x0C11ED6D538AEB30)},
+    {UINT64_C(0xE5D3EF282A242E81), UINT64_C(0x8F1668C8A86DA5FB)},
+    {UINT64_C(0x8FA475791A569D10), UINT64_C(0xF96E017D694487BD)},
+    {UINT64_C(0xB38D92D760EC4455), UINT64_C(0x37C981DCC395A9AD)},
+    {UINT64_C(0xE070F78D3927556A), UINT64_C(0x85BBE253F47B1418)},
+    {UINT64_C(0x8C469AB843B89562), UINT64_C(0x93956D7478CCEC8F)},
+    {UINT64_C(0xAF58416654A6BABB), UINT64_C(0x387AC8D1970027B3)},
+    {UINT64_C(0xDB2E51BFE9D0696A), UINT64_C(0x06997B05FCC0319F)},
+    {UINT64_C(0x88FCF317F22241E2), UINT64_C(0x441FECE3BDF81F04)},
+    {UINT64_C(0xAB3C2FDDEEAAD25A), UINT64_C(0xD527E81CAD7626C4)},
+    {UINT64_C(0xD60B3BD56A5586F1), UINT64_C(0x8A71E223D8D3B075)},
+    {UINT64_C(0x85C7056562757456), UINT64_C(0xF6872D5667844E4A)},
+    {UINT64_C(0xA738C6BEBB12D16C), UINT64_C(0xB428F8AC016561DC)},
+    {UINT64_C(0xD106F86E69D785C7), UINT64_C(0xE13336D701BEBA53)},
+    {UINT64_C(0x82A45B450226B39C), UINT64_C(0xECC0024661173474)},
+    {UINT64_C(0xA34D721642B06084), UINT64_C(0x27F002D7F95D0191)},
+    {UINT64_C(0xCC20CE9BD35C78A5), UINT64_C(0x31EC038DF7B441F5)},
+    {UINT64_C(0xFF290242C83396CE), UINT64_C(0x7E67047175A15272)},
+    {UINT64_C(0x9F79A169BD203E41), UINT64_C(0x0F0062C6E984D387)},
+    {UINT64_C(0xC75809C42C684DD1), UINT64_C(0x52C07B78A3E60869)},
+    {UINT64_C(0xF92E0C3537826145), UINT64_C(0xA7709A56CCDF8A83)},
+    {UINT64_C(0x9BBCC7A142B17CCB), UINT64_C(0x88A66076400BB692)},
+    {UINT64_C(0xC2ABF989935DDBFE), UINT64_C(0x6ACFF893D00EA436)},
+    {UINT64_C(0xF356F7EBF83552FE), UINT64_C(0x0583F6B8C4124D44)},
+    {UINT64_C(0x98165AF37B2153DE), UINT64_C(0xC3727A337A8B704B)},
+    {UINT64_C(0xBE1BF1B059E9A8D6), UINT64_C(0x744F18C0592E4C5D)},
+    {UINT64_C(0xEDA2EE1C7064130C), UINT64_C(0x1162DEF06F79DF74)},
+    {UINT64_C(0x9485D4D1C63E8BE7), UINT64_C(0x8ADDCB5645AC2BA9)},
+    {UINT64_C(0xB9A74A0637CE2EE1), UINT64_C(0x6D953E2BD7173693)},
+    {UINT64_C(0xE8111C87C5C1BA99), UINT64_C(0xC8FA8DB6CCDD0438)},
+    {UINT64_C(0x910AB1D4DB9914A0), UINT64_C(0x1D9C9892400A22A3)},
+    {UINT64_C(0xB54D5E4A127F59C8), UINT64_C(0x2503BEB6D00CAB4C)},
+    {UINT64_C(0xE2A0B5DC971F303A), UINT64_C(0x2E44AE64840FD61E)},
+    {UINT64_C(0x8DA471A9DE737E24), UINT64_C(0x5CEAECFED289E5D3)},
+    {UINT64_C(0xB10D8E1456105DAD), UINT64_C(0x7425A83E872C5F48)},
+    {UINT64_C(0xDD50F1996B947518), UINT64_C(0xD12F124E28F7771A)},
+    {UINT64_C(0x8A5296FFE33CC92F), UINT64_C(0x82BD6B70D99AAA70)},
+    {UINT64_C(0xACE73CBFDC0BFB7B), UINT64_C(0x636CC64D1001550C)},
+    {UINT64_C(0xD8210BEFD30EFA5A), UINT64_C(0x3C47F7E05401AA4F)},
+    {UINT64_C(0x8714A775E3E95C78), UINT64_C(0x65ACFAEC34810A72)},
+    {UINT64_C(0xA8D9D1535CE3B396), UINT64_C(0x7F1839A741A14D0E)},
+    {UINT64_C(0xD31045A8341CA07C), UINT64_C(0x1EDE48111209A051)},
+    {UINT64_C(0x83EA2B892091E44D), UINT64_C(0x934AED0AAB460433)},
+    {UINT64_C(0xA4E4B66B68B65D60), UINT64_C(0xF81DA84D56178540)},
+    {UINT64_C(0xCE1DE40642E3F4B9), UINT64_C(0x36251260AB9D668F)},
+    {UINT64_C(0x80D2AE83E9CE78F3), UINT64_C(0xC1D72B7C6B42601A)},
+    {UINT64_C(0xA1075A24E4421730), UINT64_C(0xB24CF65B8612F820)},
+    {UINT64_C(0xC94930AE1D529CFC), UINT64_C(0xDEE033F26797B628)},
+    {UINT64_C(0xFB9B7CD9A4A7443C), UINT64_C(0x169840EF017DA3B2)},
+    {UINT64_C(0x9D412E0806E88AA5), UINT64_C(0x8E1F289560EE864F)},
+    {UINT64_C(0xC491798A08A2AD4E), UINT64_C(0xF1A6F2BAB92A27E3)},
+    {UINT64_C(0xF5B5D7EC8ACB58A2), UINT64_C(0xAE10AF696774B1DC)},
+    {UINT64_C(0x9991A6F3D6BF1765), UINT64_C(0xACCA6DA1E0A8EF2A)},
+    {UINT64_C(0xBFF610B0CC6EDD3F), UINT64_C(0x17FD090A58D32AF4)},
+    {UINT64_C(0xEFF394DCFF8A948E), UINT64_C(0xDDFC4B4CEF07F5B1)},
+    {UINT64_C(0x95F83D0A1FB69CD9), UINT64_C(0x4ABDAF101564F98F)},
+    {UINT64_C(0xBB764C4CA7A4440F), UINT64_C(0x9D6D1AD41ABE37F2)},
+    {UINT64_C(0xEA53DF5FD18D5513), UINT64_C(0x84C86189216DC5EE)},
+    {UINT64_C(0x92746B9BE2F8552C), UINT64_C(0x32FD3CF5B4E49BB5)},
+    {UINT64_C(0xB7118682DBB66A77), UINT64_C(0x3FBC8C33221DC2A2)},
+    {UINT64_C(0xE4D5E82392A40515), UINT64_C(0x0FABAF3FEAA5334B)},
+    {UINT64_C(0x8F05B1163BA6832D), UINT64_C(0x29CB4D87F2A7400F)},
+    {UINT64_C(0xB2C71D5BCA9023F8), UINT64_C(0x743E20E9EF511013)},
+    {UINT64_C(0xDF78E4B2BD342CF6), UINT64_C(0x914DA9246B255417)},
+    {UINT64_C(0x8BAB8EEFB6409C1A), UINT64_C(0x1AD089B6C2F7548F)},
+    {UINT64_C(0xAE9672ABA3D0C320), UINT64_C(0xA184AC2473B529B2)},
+    {UINT64_C(0xDA3C0F568CC4F3E8), UINT64_C(0xC9E5D72D90A2741F)},
+    {UINT64_C(0x8865899617FB1871), UINT64_C(0x7E2FA67C7A658893)},
+    {UINT64_C(0xAA7EEBFB9DF9DE8D), UINT64_C(0xDDBB901B98FEEAB8)},
+    {UINT64_C(0xD51EA6FA85785631), UINT64_C(0x552A74227F3EA566)},
+    {UINT64_C(0x8533285C936B35DE), UINT64_C(0xD53A88958F872760)},
+    {UINT64_C(0xA67FF273B8460356), UINT64_C(0x8A892ABAF368F138)},
+    {UINT64_C(0xD01FEF10A657842C), UINT64_C(0x2D2B7569B0432D86)},
+    {UINT64_C(0x8213F56A67F6B29B), UINT64_C(0x9C3B29620E29FC74)},
+    {UINT64_C(0xA298F2C501F45F42), UINT64_C(0x8349F3BA91B47B90)},
+    {UINT64_C(0xCB3F2F7642717713), UINT64_C(0x241C70A936219A74)},
+    {UINT64_C(0xFE0EFB53D30DD4D7), UINT64_C(0xED238CD383AA0111)},
+    {UINT64_C(0x9EC95D1463E8A506), UINT64_C(0xF4363804324A40AB)},
+    {UINT64_C(0xC67BB4597CE2CE48), UINT64_C(0xB143C6053EDCD0D6)},
+    {UINT64_C(0xF81AA16FDC1B81DA), UINT64_C(0xDD94B7868E94050B)},
+    {UINT64_C(0x9B10A4E5E9913128), UINT64_C(0xCA7CF2B4191C8327)},
+    {UINT64_C(0xC1D4CE1F63F57D72), UINT64_C(0xFD1C2F611F63A3F1)},
+    {UINT64_C(0xF24A01A73CF2DCCF), UINT64_C(0xBC633B39673C8CED)},
+    {UINT64_C(0x976E41088617CA01), UINT64_C(0xD5BE0503E085D814)},
+    {UINT64_C(0xBD49D14AA79DBC82), UINT64_C(0x4B2D8644D8A74E19)},
+    {UINT64_C(0xEC9C459D51852BA2), UINT64_C(0xDDF8E7D60ED1219F)},
+    {UINT64_C(0x93E1AB8252F33B45), UINT64_C(0xCABB90E5C942B504)},
+    {UINT64_C(0xB8DA1662E7B00A17), UINT64_C(0x3D6A751F3B936244)},
+    {UINT64_C(0xE7109BFBA19C0C9D), UINT64_C(0x0CC512670A783AD5)},
+    {UINT64_C(0x906A617D450187E2), UINT64_C(0x27FB2B80668B24C6)},
+    {UINT64_C(0xB484F9DC9641E9DA), UINT64_C(0xB1F9F660802DEDF7)},
+    {UINT64_C(0xE1A63853BBD26451), UINT64_C(0x5E7873F8A0396974)},
+    {UINT64_C(0x8D07E33455637EB2), UINT64_C(0xDB0B487B6423E1E9)},
+    {UINT64_C(0xB049DC016ABC5E5F), UINT64_C(0x91CE1A9A3D2CDA63)},
+    {UINT64_C(0xDC5C5301C56B75F7), UINT64_C(0x7641A140CC7810FC)},
+    {UINT64_C(0x89B9B3E11B6329BA), UINT64_C(0xA9E904C87FCB0A9E)},
+    {UINT64_C(0xAC2820D9623BF429), UINT64_C(0x546345FA9FBDCD45)},
+    {UINT64_C(0xD732290FBACAF133), UINT64_C(0xA97C177947AD4096)},
+    {UINT64_C(0x867F59A9D4BED6C0), UINT64_C(0x49ED8EABCCCC485E)},
+    {UINT64_C(0xA81F301449EE8C70), UINT64_C(0x5C68F256BFFF5A75)},
+    {UINT64_C(0xD226FC195C6A2F8C), UINT64_C(0x73832EEC6FFF3112)},
+    {UINT64_C(0x83585D8FD9C25DB7), UINT64_C(0xC831FD53C5FF7EAC)},
+    {UINT64_C(0xA42E74F3D032F525), UINT64_C(0xBA3E7CA8B77F5E56)},
+    {UINT64_C(0xCD3A1230C43FB26F), UINT64_C(0x28CE1BD2E55F35EC)},
+    {UINT64_C(0x80444B5E7AA7CF85), UINT64_C(0x7980D163CF5B81B4)},
+    {UINT64_C(0xA0555E361951C366), UINT64_C(0xD7E105BCC3326220)},
+    {UINT64_C(0xC86AB5C39FA63440), UINT64_C(0x8DD9472BF3FEFAA8)},
+    {UINT64_C(0xFA856334878FC150), UINT64_C(0xB14F98F6F0FEB952)},
+    {UINT64_C(0x9C935E00D4B9D8D2), UINT64_C(0x6ED1BF9A569F33D4)},
+    {UINT64_C(0xC3B8358109E84F07), UINT64_C(0x0A862F80EC4700C9)},
+    {UINT64_C(0xF4A642E14C6262C8), UINT64_C(0xCD27BB612758C0FB)},
+    {UINT64_C(0x98E7E9CCCFBD7DBD), UINT64_C(0x8038D51CB897789D)},
+    {UINT64_C(0xBF21E44003ACDD2C), UINT64_C(0xE0470A63E6BD56C4)},
+    {UINT64_C(0xEEEA5D5004981478), UINT64_C(0x1858CCFCE06CAC75)},
+    {UINT64_C(0x95527A5202DF0CCB), UINT64_C(0x0F37801E0C43EBC9)},
+    {UINT64_C(0xBAA718E68396CFFD), UINT64_C(0xD30560258F54E6BB)},
+    {UINT64_C(0xE950DF20247C83FD), UINT64_C(0x47C6B82EF32A206A)},
+    {UINT64_C(0x91D28B7416CDD27E), UINT64_C(0x4CDC331D57FA5442)},
+    {UINT64_C(0xB6472E511C81471D), UINT64_C(0xE0133FE4ADF8E953)},
+    {UINT64_C(0xE3D8F9E563A198E5), UINT64_C(0x58180FDDD97723A7)},
+    {UINT64_C(0x8E679C2F5E44FF8F), UINT64_C(0x570F09EAA7EA7649)},
+    {UINT64_C(0xB201833B35D63F73), UINT64_C(0x2CD2CC6551E513DB)},
+    {UINT64_C(0xDE81E40A034BCF4F), UINT64_C(0xF8077F7EA65E58D2)},
+    {UINT64_C(0x8B112E86420F6191), UINT64_C(0xFB04AFAF27FAF783)},
+    {UINT64_C(0xADD57A27D29339F6), UINT64_C(0x79C5DB9AF1F9B564)},
+    {UINT64_C(0xD94AD8B1C7380874), UINT64_C(0x18375281AE7822BD)},
+    {UINT64_C(0x87CEC76F1C830548), UINT64_C(0x8F2293910D0B15B6)},
+    {UINT64_C(0xA9C2794AE3A3C69A), UINT64_C(0xB2EB3875504DDB23)},
+    {UINT64_C(0xD433179D9C8CB841), UINT64_C(0x5FA60692A46151EC)},
+    {UINT64_C(0x849FEEC281D7F328), UINT64_C(0xDBC7C41BA6BCD334)},
+    {UINT64_C(0xA5C7EA73224DEFF3), UINT64_C(0x12B9B522906C0801)},
+    {UINT64_C(0xCF39E50FEAE16BEF), UINT64_C(0xD768226B34870A01)},
+    {UINT64_C(0x81842F29F2CCE375), UINT64_C(0xE6A1158300D46641)},
+    {UINT64_C(0xA1E53AF46F801C53), UINT64_C(0x60495AE3C1097FD1)},
+    {UINT64_C(0xCA5E89B18B602368), UINT64_C(0x385BB19CB14BDFC5)},
+    {UINT64_C(0xFCF62C1DEE382C42), UINT64_C(0x46729E03DD9ED7B6)},
+    {UINT64_C(0x9E19DB92B4E31BA9), UINT64_C(0x6C07A2C26A8346D2)},
+    {UINT64_C(0xC5A05277621BE293), UINT64_C(0xC7098B7305241886)},
+    {UINT64_C(0xF70867153AA2DB38), UINT64_C(0xB8CBEE4FC66D1EA8)},
+};
+
+constexpr int floor_log2_pow10(int e) noexcept { return (e * 1741647) >> 19; }
+
+constexpr int floor_log10_pow2(int e) noexcept { return (e * 1262611) >> 22; }
+
+constexpr int floor_log10_three_quarters_pow2(int e) noexcept {
+  return (e * 1262611 - 524031) >> 22;
+}
+
+template <typename T> struct float_traits;
+
+template <> struct float_traits<float> {
+  using carrier = uint32_t;
+  static constexpr int significand_bits = 23;
+  static constexpr int exponent_bits = 8;
+  static constexpr int exponent_bias = 127 + significand_bits;
+  // "-1.2345678e-38"
+  static constexpr int max_chars = 15;
+};
+
+template <> struct float_traits<double> {
+  using carrier = uint64_t;
+  static constexpr int significand_bits = 52;
+  static constexpr int exponent_bits = 11;
+  static constexpr int exponent_bias = 1023 + significand_bits;
+  // "-1.2345678901234567e-308"
+  static constexpr int max_chars = 24;
+};
+
+// Returns floor(g * cp / 2^128) with the last bit set if the remainder
+// exceeds 1.
+inline uint64_t round_to_odd(const uint64_t (&g)[2], uint64_t cp) noexcept {
+  const uint128_t x = uint128_t(g[1]) * cp;
+  const uint128_t y = uint128_t(g[0]) * cp + (x >> 64);
+  return uint64_t(y >> 64) | (uint64_t(y) > 1);
+}
+
+// Returns floor(g * cp / 2^64) with the last bit set if the remainder
+// exceeds 2^32.
+inline uint32_t round_to_odd(uint64_t g, uint32_t cp) noexcept {
+  const uint64_t y = uint64_t((uint128_t(g) * cp) >> 32);
+  return uint32_t(y >> 32) | (uint32_t(y) > 1);
+}
+
+template <typename T> struct decimal_fp {
+  T digits;
+  int exponent;
+};
+
+// Computes the shortest decimal digits * 10^exponent that rounds to the
+// finite non-zero binary floating point value given by its IEEE 754 fields,
+// using the Schubfach algorithm by Raffaello Giulietti.
+template <typename T>
+inline decimal_fp<typename float_traits<T>::carrier>
+to_decimal(typename float_traits<T>::carrier ieee_significand,
+           int ieee_exponent) noexcept {
+  using traits = float_traits<T>;
+  using carrier = typename traits::carrier;
+  carrier c;
+  int q;
+  if (ieee_exponent != 0) {
+    c = (carrier(1) << traits::significand_bits) | ieee_significand;
+    q = ieee_exponent - traits::exponent_bias;
+    if (0 <= -q && -q <= traits::significand_bits) {
+      // Small integers
+      const carrier mask = (carrier(1) << -q) - 1;
+      if ((c & mask) == 0) {
+        return {carrier(c >> -q), 0};
+      }
+    }
+  } else {
+    c = ieee_significand;
+    q = 1 - traits::exponent_bias;
+  }
+
+  const bool is_even = c % 2 == 0;
+  const bool lower_boundary_is_closer =
+      ieee_significand == 0 && ieee_exponent > 1;
+
+  const carrier cbl = 4 * c - 2 + lower_boundary_is_closer;
+  const carrier cb = 4 * c;
+  const carrier cbr = 4 * c + 2;
+
+  const int k = lower_boundary_is_closer ? floor_log10_three_quarters_pow2(q)
+                                         : floor_log10_pow2(q);
+  const int h = q + floor_log2_pow10(-k) + 1;
+
+  const auto &g = pow10_128[-k - pow10_128_min];
+  carrier vbl, vb, vbr;
+  if constexpr (sizeof(carrier) == sizeof(uint64_t)) {
+    vbl = round_to_odd(g, cbl << h);
+    vb = round_to_odd(g, cb << h);
+    vbr = round_to_odd(g, cbr << h);
+  } else {
+    vbl = round_to_odd(g[0] + 1, cbl << h);
+    vb = round_to_odd(g[0] + 1, cb << h);
+    vbr = round_to_odd(g[0] + 1, cbr << h);
+  }
+
+  const carrier lower = vbl + !is_even;
+  const carrier upper = vbr - !is_even;
+
+  const carrier s = vb / 4;
+  if (s >= 10) {
+    // Try the largest multiple of 10 in the rounding interval
+    const carrier sp = s / 10;
+    const bool up_inside = lower <= 40 * sp;
+    const bool wp_inside = 40 * sp + 40 <= upper;
+    if (up_inside != wp_inside) {
+      return {carrier(sp + wp_inside), k + 1};
+    }
+  }
+
+  const bool u_inside = lower <= 4 * s;
+  const bool w_inside = 4 * s + 4 <= upper;
+  if (u_inside != w_inside) {
+    return {carrier(s + w_inside), k};
+  }
+
+  // Both s and s + 1 are in the rounding interval, pick the closest one
+  const carrier mid = 4 * s + 2;
+  const bool round_up = vb > mid || (vb == mid && (s & 1) != 0);
+  return {carrier(s + round_up), k};
+}
+
+// Writes the shortest representation of value that round trips, in fixed or
+// scientific notation whichever is shorter, preferring fixed notation. The
+// output is identical to std::to_chars(first, last, value). The buffer must
+// have room for float_traits<T>::max_chars characters.
+template <typename T> inline char *write_shortest(char *p, T value) noexcept {
+  using traits = float_traits<T>;
+  using carrier = typename traits::carrier;
+  carrier bits;
+  static_assert(sizeof(bits) == sizeof(value));
+  std::memcpy(&bits, &value, sizeof(bits));
+  const carrier significand =
+      bits & ((carrier(1) << traits::significand_bits) - 1);
+  const int exponent = int(bits >> traits::significand_bits) &
+                       ((1 << traits::exponent_bits) - 1);
+
+  if (bits >> (traits::significand_bits + traits::exponent_bits)) {
+    *p++ = '-';
+  }
+  if (__builtin_expect(exponent == (1 << traits::exponent_bits) - 1, 0)) {
+    std::memcpy(p, significand ? "nan" : "inf", 3);
+    return p + 3;
+  }
+  if (exponent == 0 && significand == 0) {
+    *p = '0';
+    return p + 1;
+  }
+
+  auto dec = to_decimal<T>(significand, exponent);
+  while (dec.digits % 10 == 0) {
+    dec.digits /= 10;
+    ++dec.exponent;
+  }
+
+  const int len = to_chars_len(dec.digits);
+  const int sci_exponent = dec.exponent + len - 1;
+  const int sci_len = len + (len > 1) + 2 +
+                      (sci_exponent >= 100 || sci_exponent <= -100 ? 3 : 2);
+  int fixed_len;
+  if (dec.exponent >= 0) {
+    fixed_len = len + dec.exponent;
+  } else if (sci_exponent >= 0) {
+    fixed_len = len + 1;
+  } else {
+    fixed_len = len + 1 - sci_exponent;
+  }
+
+  if (fixed_len <= sci_len) {
+    if (dec.exponent > 0) {
+      // 123000: Integers are written exactly, like printf("%.0f")
+      const int e = exponent == 0 ? 1 - traits::exponent_bias
+                                  : exponent - traits::exponent_bias;
+      const uint128_t c =
+          significand | (carrier(exponent != 0) << traits::significand_bits);
+      const uint128_t x = e >= 0 ? c << e : c >> -e;
+      if (x <= std::numeric_limits<uint64_t>::max()) {
+        digit_pair_writer::write(p + fixed_len, uint64_t(x));
+      } else {
+        const uint64_t hi = uint64_t(x / UINT64_C(10000000000000000000));
+        write_fixed_digits<19>(
+            p + fixed_len,
+            uint64_t(x - uint128_t(hi) * UINT64_C(10000000000000000000)));
+        digit_pair_writer::write(p + fixed_len - 19, hi);
+      }
+    } else if (dec.exponent == 0) {
+      // 123
+      digit_pair_writer::write(p + len, dec.digits);
+    } else if (sci_exponent >= 0) {
+      // 123.456
+      const int int_len = sci_exponent + 1;
+      digit_pair_writer::write(p + len + 1, dec.digits);
+      std::memmove(p, p + 1, int_len);
+      p[int_len] = '.';
+    } else {
+      // 0.000123
+      p[0] = '0';
+      p[1] = '.';
+      std::memset(p + 2, '0', -sci_exponent - 1);
+      digit_pair_writer::write(p + fixed_len, dec.digits);
+    }
+    return p + fixed_len;
+  }
+
+  // 1.23e+45
+  digit_pair_writer::write(p + len + 1, dec.digits);
+  p[0] = p[1];
+  if (len > 1) {
+    p[1] = '.';
+    p += len + 1;
+  } else {
+    p += 1;
+  }
+  *p++ = 'e';
+  unsigned e = sci_exponent;
+  if (sci_exponent < 0) {
+    *p++ = '-';
+    e = -sci_exponent;
+  } else {
+    *p++ = '+';
+  }
+  if (e >= 100) {
+    *p++ = char('0' + e / 100);
+    e %= 100;
+  }
+  return write_digit_pair(p + 2, e) + 2;
+}
+
+template <typename T>
+inline to_chars_result to_chars_float(char *first, char *last,
+                                      T value) noexcept {
+  static_assert(std::is_floating_point<T>::value);
+  constexpr int max_chars = float_traits<T>::max_chars;
+  if (__builtin_expect(last - first >= max_chars, 1)) {
+    return {write_shortest(first, value), {}};
+  }
+  char buf[max_chars];
+  const auto len = write_shortest(buf, value) - buf;
+  if (last - first < len) {
+    return {last, std::errc::value_too_large};
+  }
+  std::memcpy(first, buf, len);
+  return {first + len, {}};
+}
+
+// Approximations of 5^q for q in [-342, 308] normalized to [2^127, 2^128) as
+// {high, low} 64-bit words. Positive powers are truncated, negative powers are
+// rounded up before truncation, as required by the Eisel-Lemire algorithm.
+static constexpr int pow5_128_min = -342;
+static constexpr uint64_t pow5_128[][2] = {
+    {UINT64_C(0xEEF453D6923BD65A), UINT64_C(0x113FAA2906A13B3F)},
+    {UINT64_C(0x9558B4661B6565F8), UINT64_C(0x4AC7CA59A424C507)},
+    {UINT64_C(0xBAAEE17FA23EBF76), UINT64_C(0x5D79BCF00D2DF649)},
+    {UINT64_C(0xE95A99DF8ACE6F53), UINT64_C(0xF4D82C2C107973DC)},
+    {UINT64_C(0x91D8A02BB6C10594), UINT64_C(0x79071B9B8A4BE869)},
+    {UINT64_C(0xB64EC836A47146F9), UINT64_C(0x9748E2826CDEE284)},
+    {UINT64_C(0xE3E27A444D8D98B7), UINT64_C(0xFD1B1B2308169B25)},
+    {UINT64_C(0x8E6D8C6AB0787F72), UINT64_C(0xFE30F0F5E50E20F7)},
+    {UINT64_C(0xB208EF855C969F4F), UINT64_C(0xBDBD2D335E51A935)},
+    {UINT64_C(0xDE8B2B66B3BC4723), UINT64_C(0xAD2C788035E61382)},
+    {UINT64_C(0x8B16FB203055AC76), UINT64_C(0x4C3BCB5021AFCC31)},
+    {UINT64_C(0xADDCB9E83C6B1793), UINT64_C(0xDF4ABE242A1BBF3D)},
+    {UINT64_C(0xD953E8624B85DD78), UINT64_C(0xD71D6DAD34A2AF0D)},
+    {UINT64_C(0x87D4713D6F33AA6B), UINT64_C(0x8672648C40E5AD68)},
+    {UINT64_C(0xA9C98D8CCB009506), UINT64_C(0x680EFDAF511F18C2)},
+    {UINT64_C(0xD43BF0EFFDC0BA48), UINT64_C(0x0212BD1B2566DEF2)},
+    {UINT64_C(0x84A57695FE98746D), UINT64_C(0x014BB630F7604B57)},
+    {UINT64_C(0xA5CED43B7E3E9188), UINT64_C(0x419EA3BD35385E2D)},
+    {UINT64_C(0xCF42894A5DCE35EA), UINT64_C(0x52064CAC828675B9)},
+    {UINT64_C(0x818995CE7AA0E1B2), UINT64_C(0x7343EFEBD1940993)},
+    {UINT64_C(0xA1EBFB4219491A1F), UINT64_C(0x1014EBE6C5F90BF8)},
+    {UINT64_C(0xCA66FA129F9B60A6), UINT64_C(0xD41A26E077774EF6)},
+    {UINT64_C(0xFD00B897478238D0), UINT64_C(0x8920B098955522B4)},
+    {UINT64_C(0x9E20735E8CB16382), UINT64_C(0x55B46E5F5D5535B0)},
+    {UINT64_C(0xC5A890362FDDBC62), UINT64_C(0xEB2189F734AA831D)},
+    {UINT64_C(0xF712B443BBD52B7B), UINT64_C(0xA5E9EC7501D523E4)},
+    {UINT64_C(0x9A6BB0AA55653B2D), UINT64_C(0x47B233C92125366E)},
+    {UINT64_C(0xC1069CD4EABE89F8), UINT64_C(0x999EC0BB696E840A)},
+    {UINT64_C(0xF148440A256E2C76), UINT64_C(0xC00670EA43CA250D)},
+    {UINT64_C(0x96CD2A865764DBCA), UINT64_C(0x380406926A5E5728)},
+    {UINT64_C(0xBC807527ED3E12BC), UINT64_C(0xC605083704F5ECF2)},
+    {UINT64_C(0xEBA09271E88D976B), UINT64_C(0xF7864A44C633682E)},
+    {UINT64_C(0x93445B8731587EA3), UINT64_C(0x7AB3EE6AFBE0211D)},
+    {UINT64_C(0xB8157268FDAE9E4C), UINT64_C(0x5960EA05BAD82964)},
+    {UINT64_C(0xE61ACF033D1A45DF), UINT64_C(0x6FB92487298E33BD)},
+    {UINT64_C(0x8FD0C16206306BAB), UINT64_C(0xA5D3B6D479F8E056)},
+    {UINT64_C(0xB3C4F1BA87BC8696), UINT64_C(0x8F48A4899877186C)},
+    {UINT64_C(0xE0B62E2929ABA83C), UINT64_C(0x331ACDABFE94DE87)},
+    {UINT64_C(0x8C71DCD9BA0B4925), UINT64_C(0x9FF0C08B7F1D0B14)},
+    {UINT64_C(0xAF8E5410288E1B6F), UINT64_C(0x07ECF0AE5EE44DD9)},
+    {UINT64_C(0xDB71E91432B1A24A), UINT64_C(0xC9E82CD9F69D6150)},
+    {UINT64_C(0x892731AC9FAF056E), UINT64_C(0xBE311C083A225CD2)},
+    {UINT64_C(0xAB70FE17C79AC6CA), UINT64_C(0x6DBD630A48AAF406)},
+    {UINT64_C(0xD64D3D9DB981787D), UINT64_C(0x092CBBCCDAD5B108)},
+    {UINT64_C(0x85F0468293F0EB4E), UINT64_C(0x25BBF56008C58EA5)},
+    {UINT64_C(0xA76C582338ED2621), UINT64_C(0xAF2AF2B80AF6F24E)},
+    {UINT64_C(0xD1476E2C07286FAA), UINT64_C(0x1AF5AF660DB4AEE1)},
+    {UINT64_C(0x82CCA4DB847945CA), UINT64_C(0x50D98D9FC890ED4D)},
+    {UINT64_C(0xA37FCE126597973C), UINT64_C(0xE50FF107BAB528A0)},
+    {UINT64_C(0xCC5FC196FEFD7D0C), UINT64_C(0x1E53ED49A96272C8)},
+    {UINT64_C(0xFF77B1FCBEBCDC4F), UINT64_C(0x25E8E89C13BB0F7A)},
+    {UINT64_C(0x9FAACF3DF73609B1), UINT64_C(0x77B191618C54E9AC)},
+    {UINT64_C(0xC795830D75038C1D), UINT64_C(0xD59DF5B9EF6A2417)},
+    {UINT64_C(0xF97AE3D0D2446F25), UINT64_C(0x4B0573286B44AD1D)},
+    {UINT64_C(0x9BECCE62836AC577), UINT64_C(0x4EE367F9430AEC32)},
+    {UINT64_C(0xC2E801FB244576D5), UINT64_C(0x229C41F793CDA73F)},
+    {UINT64_C(0xF3A20279ED56D48A), UINT64_C(0x6B43527578C1110F)},
+    {UINT64_C(0x9845418C345644D6), UINT64_C(0x830A13896B78AAA9)},
+    {UINT64_C(0xBE5691EF416BD60C), UINT64_C(0x23CC986BC656D553)},
+    {UINT64_C(0xEDEC366B11C6CB8F), UINT64_C(0x2CBFBE86B7EC8AA8)},
+    {UINT64_C(0x94B3A202EB1C3F39), UINT64_C(0x7BF7D71432F3D6A9)},
+    {UINT64_C(0xB9E08A83A5E34F07), UINT64_C(0xDAF5CCD93FB0CC53)},
+    {UINT64_C(0xE858AD248F5C22C9), UINT64_C(0xD1B3400F8F9CFF68)},
+    {UINT64_C(0x91376C36D99995BE), UINT64_C(0x23100809B9C21FA1)},
+    {UINT64_C(0xB58547448FFFFB2D), UINT64_C(0xABD40A0C2832A78A)},
+    {UINT64_C(0xE2E69915B3FFF9F9), UINT64_C(0x16C90C8F323F516C)},
+    {UINT64_C(0x8DD01FAD907FFC3B), UINT64_C(0xAE3DA7D97F6792E3)},
+    {UINT64_C(0xB1442798F49FFB4A), UINT64_C(0x99CD11CFDF41779C)},
+    {UINT64_C(0xDD95317F31C7FA1D), UINT64_C(0x40405643D711D583)},
+    {UINT64_C(0x8A7D3EEF7F1CFC52), UINT64_C(0x482835EA666B2572)},
+    {UINT64_C(0xAD1C8EAB5EE43B66), UINT64_C(0xDA3243650005EECF)},
+    {UINT64_C(0xD863B256369D4A40), UINT64_C(0x90BED43E40076A82)},
+    {UINT64_C(0x873E4F75E2224E68), UINT64_C(0x5A7744A6E804A291)},
+    {UINT64_C(0xA90DE3535AAAE202), UINT64_C(0x711515D0A205CB36)},
+    {UINT64_C(0xD3515C2831559A83), UINT64_C(0x0D5A5B44CA873E03)},
+    {UINT64_C(0x8412D9991ED58091), UINT64_C(0xE858790AFE9486C2)},
+    {UINT64_C(0xA5178FFF668AE0B6), UINT64_C(0x626E974DBE39A872)},
+    {UINT64_C(0xCE5D73FF402D98E3), UINT64_C(0xFB0A3D212DC8128F)},
+    {UINT64_C(0x80FA687F881C7F8E), UINT64_C(0x7CE66634BC9D0B99)},
+    {UINT64_C(0xA139029F6A239F72), UINT64_C(0x1C1FFFC1EBC44E80)},
+    {UINT64_C(0xC987434744AC874E), UINT64_C(0xA327FFB266B56220)},
+    {UINT64_C(0xFBE9141915D7A922), UINT64_C(0x4BF1FF9F0062BAA8)},
+    {UINT64_C(0x9D71AC8FADA6C9B5), UINT64_C(0x6F773FC3603DB4A9)},
+    {UINT64_C(0xC4CE17B399107C22), UINT64_C(0xCB550FB4384D21D3)},
+    {UINT64_C(0xF6019DA07F549B2B), UINT64_C(0x7E2A53A146606A48)},
+    {UINT64_C(0x99C102844F94E0FB), UINT64_C(0x2EDA7444CBFC426D)},
+    {UINT64_C(0xC0314325637A1939), UINT64_C(0xFA911155FEFB5308)},
+    {UINT64_C(0xF03D93EEBC589F88), UINT64_C(0x793555AB7EBA27CA)},
+    {UINT64_C(0x96267C7535B763B5), UINT64_C(0x4BC1558B2F3458DE)},
+    {UINT64_C(0xBBB01B9283253CA2), UINT64_C(0x9EB1AAEDFB016F16)},
+    {UINT64_C(0xEA9C227723EE8BCB), UINT64_C(0x465E15A979C1CADC)},
+    {UINT64_C(0x92A1958A7675175F), UINT64_C(0x0BFACD89EC191EC9)},
+    {UINT64_C(0xB749FAED14125D36), UINT64_C(0xCEF980EC671F667B)},
+    {UINT64_C(0xE51C79A85916F484), UINT64_C(0x82B7E12780E7401A)},
+    {UINT64_C(0x8F31CC0937AE58D2), UINT64_C(0xD1B2ECB8B0908810)},
+    {UINT64_C(0xB2FE3F0B8599EF07), UINT64_C(0x861FA7E6DCB4AA15)},
+    {UINT64_C(0xDFBDCECE67006AC9), UINT64_C(0x67A791E093E1D49A)},
+    {UINT64_C(0x8BD6A141006042BD), UINT64_C(0xE0C8BB2C5C6D24E0)},
+    {UINT64_C(0xAECC49914078536D), UINT64_C(0x58FAE9F773886E18)},
+    {UINT64_C(0xDA7F5BF590966848), UINT64_C(0xAF39A475506A899E)},
+    {UINT64_C(0x888F99797A5E012D), UINT64_C(0x6D8406C952429603)},
+    {UINT64_C(0xAAB37FD7D8F58178), UINT64_C(0xC8E5087BA6D33B83)},
+    {UINT64_C(0xD5605FCDCF32E1D6), UINT64_C(0xFB1E4A9A90880A64)},
+    {UINT64_C(0x855C3BE0A17FCD26), UINT64_C(0x5CF2EEA09A55067F)},
+    {UINT64_C(0xA6B34AD8C9DFC06F), UINT64_C(0xF42FAA48C0EA481E)},
+    {UINT64_C(0xD0601D8EFC57B08B), UINT64_C(0xF13B94DAF124DA26)},
+    {UINT64_C(0x823C12795DB6CE57), UINT64_C(0x76C53D08D6B70858)},
+    {UINT64_C(0xA2CB1717B52481ED), UINT64_C(0x54768C4B0C64CA6E)},
+    {UINT64_C(0xCB7DDCDDA26DA268), UINT64_C(0xA9942F5DCF7DFD09)},
+    {UINT64_C(0xFE5D54150B090B02), UINT64_C(0xD3F93B35435D7C4C)},
+    {UINT64_C(0x9EFA548D26E5A6E1), UINT64_C(0xC47BC5014A1A6DAF)},
+    {UINT64_C(0xC6B8E9B0709F109A), UINT64_C(0x359AB6419CA1091B)},
+    {UINT64_C(0xF867241C8CC6D4C0), UINT64_C(0xC30163D203C94B62)},
+    {UINT64_C(0x9B407691D7FC44F8), UINT64_C(0x79E0DE63425DCF1D)},
+    {UINT64_C(0xC21094364DFB5636), UINT64_C(0x985915FC12F542E4)},
+    {UINT64_C(0xF294B943E17A2BC4), UINT64_C(0x3E6F5B7B17B2939D)},
+    {UINT64_C(0x979CF3CA6CEC5B5A), UINT64_C(0xA705992CEECF9C42)},
+    {UINT64_C(0xBD8430BD08277231), UINT64_C(0x50C6FF782A838353)},
+    {UINT64_C(0xECE53CEC4A314EBD), UINT64_C(0xA4F8BF5635246428)},
+    {UINT64_C(0x940F4613AE5ED136), UINT64_C(0x871B7795E136BE99)},
+    {UINT64_C(0xB913179899F68584), UINT64_C(0x28E2557B59846E3F)},
+    {UINT64_C(0xE757DD7EC07426E5), UINT64_C(0x331AEADA2FE589CF)},
+    {UINT64_C(0x9096EA6F3848984F), UINT64_C(0x3FF0D2C85DEF7621)},
+    {UINT64_C(0xB4BCA50B065ABE63), UINT64_C(0x0FED077A756B53A9)},
+    {UINT64_C(0xE1EBCE4DC7F16DFB), UINT64_C(0xD3E8495912C62894)},
+    {UINT64_C(0x8D3360F09CF6E4BD), UINT64_C(0x64712DD7ABBBD95C)},
+    {UINT64_C(0xB080392CC4349DEC), UINT64_C(0xBD8D794D96AACFB3)},
+    {UINT64_C(0xDCA04777F541C567), UINT64_C(0xECF0D7A0FC5583A0)},
+    {UINT64_C(0x89E42CAAF9491B60), UINT64_C(0xF41686C49DB57244)},
+    {UINT64_C(0xAC5D37D5B79B6239), UINT64_C(0x311C2875C522CED5)},
+    {UINT64_C(0xD77485CB25823AC7), UINT64_C(0x7D633293366B828B)},
+    {UINT64_C(0x86A8D39EF77164BC), UINT64_C(0xAE5DFF9C02033197)},
+    {UINT64_C(0xA8530886B54DBDEB), UINT64_C(0xD9F57F830283FDFC)},
+    {UINT64_C(0xD267CAA862A12D66), UINT64_C(0xD072DF63C324FD7B)},
+    {UINT64_C(0x8380DEA93DA4BC60), UINT64_C(0x4247CB9E59F71E6D)},
+    {UINT64_C(0xA46116538D0DEB78), UINT64_C(0x52D9BE85F074E608)},
+    {UINT64_C(0xCD795BE870516656), UINT64_C(0x67902E276C921F8B)},
+    {UINT64_C(0x806BD9714632DFF6), UINT64_C(0x00BA1CD8A3DB53B6)},
+    {UINT64_C(0xA086CFCD97BF97F3), UINT64_C(0x80E8A40ECCD228A4)},
+    {UINT64_C(0xC8A883C0FDAF7DF0), UINT64_C(0x6122CD128006B2CD)},
+    {UINT64_C(0xFAD2A4B13D1B5D6C), UINT64_C(0x796B805720085F81)},
+    {UINT64_C(0x9CC3A6EEC6311A63), UINT64_C(0xCBE3303674053BB0)},
+    {UINT64_C(0xC3F490AA77BD60FC), UINT64_C(0xBEDBFC4411068A9C)},
+    {UINT64_C(0xF4F1B4D515ACB93B), UINT64_C(0xEE92FB5515482D44)},
+    {UINT64_C(0x991711052D8BF3C5), UINT64_C(0x751BDD152D4D1C4A)},
+    {UINT64_C(0xBF5CD54678EEF0B6), UINT64_C(0xD262D45A78A0635D)},
+    {UINT64_C(0xEF340A98172AACE4), UINT64_C(0x86FB897116C87C34)},
+    {UINT64_C(0x9580869F0E7AAC0E), UINT64_C(0xD45D35E6AE3D4DA0)},
+    {UINT64_C(0xBAE0A846D2195712), UINT64_C(0x8974836059CCA109)},
+    {UINT64_C(0xE998D258869FACD7), UINT64_C(0x2BD1A438703FC94B)},
+    {UINT64_C(0x91FF83775423CC06), UINT64_C(0x7B6306A34627DDCF)},
+    {UINT64_C(0xB67F6455292CBF08), UINT64_C(0x1A3BC84C17B1D542)},
+    {UINT64_C(0xE41F3D6A7377EECA), UINT64_C(0x20CABA5F1D9E4A93)},
+    {UINT64_C(0x8E938662882AF53E), UINT64_C(0x547EB47B7282EE9C)},
+    {UINT64_C(0xB23867FB2A35B28D), UINT64_C(0xE99E619A4F23AA43)},
+    {UINT64_C(0xDEC681F9F4C31F31), UINT64_C(0x6405FA00E2EC94D4)},
+    {UINT64_C(0x8B3C113C38F9F37E), UINT64_C(0xDE83BC408DD3DD04)},
+    {UINT64_C(0xAE0B158B4738705E), UINT64_C(0x9624AB50B148D445)},
+    {UINT64_C(0xD98DDAEE19068C76), UINT64_C(0x3BADD624DD9B0957)},
+    {UINT64_C(0x87F8A8D4CFA417C9), UINT64_C(0xE54CA5D70A80E5D6)},
+    {UINT64_C(0xA9F6D30A038D1DBC), UINT64_C(0x5E9FCF4CCD211F4C)},
+    {UINT64_C(0xD47487CC8470652B), UINT64_C(0x7647C3200069671F)},
+    {UINT64_C(0x84C8D4DFD2C63F3B), UINT64_C(0x29ECD9F40041E073)},
+    {UINT64_C(0xA5FB0A17C777CF09), UINT64_C(0xF468107100525890)},
+    {UINT64_C(0xCF79CC9DB955C2CC), UINT64_C(0x7182148D4066EEB4)},
+    {UINT64_C(0x81AC1FE293D599BF), UINT64_C(0xC6F14CD848405530)},
+    {UINT64_C(0xA21727DB38CB002F), UINT64_C(0xB8ADA00E5A506A7C)},
+    {UINT64_C(0xCA9CF1D206FDC03B), UINT64_C(0xA6D90811F0E4851C)},
+    {UINT64_C(0xFD442E4688BD304A), UINT64_C(0x908F4A166D1DA663)},
+    {UINT64_C(0x9E4A9CEC15763E2E), UINT64_C(0x9A598E4E043287FE)},
+    {UINT64_C(0xC5DD44271AD3CDBA), UINT64_C(0x40EFF1E1853F29FD)},
+    {UINT64_C(0xF7549530E188C128), UINT64_C(0xD12BEE59E68EF47C)},
+    {UINT64_C(0x9A94DD3E8CF578B9), UINT64_C(0x82BB74F8301958CE)},
+    {UINT64_C(0xC13A148E3032D6E7), UINT64_C(0xE36A52363C1FAF01)},
+    {UINT64_C(0xF18899B1BC3F8CA1), UINT64_C(0xDC44E6C3CB279AC1)},
+    {UINT64_C(0x96F5600F15A7B7E5), UINT64_C(0x29AB103A5EF8C0B9)},
+    {UINT64_C(0xBCB2B812DB11A5DE), UINT64_C(0x7415D448F6B6F0E7)},
+    {UINT64_C(0xEBDF661791D60F56), UINT64_C(0x111B495B3464AD21)},
+    {UINT64_C(0x936B9FCEBB25C995), UINT64_C(0xCAB10DD900BEEC34)},
+    {UINT64_C(0xB84687C269EF3BFB), UINT64_C(0x3D5D514F40EEA742)},
+    {UINT64_C(0xE65829B3046B0AFA), UINT64_C(0x0CB4A5A3112A5112)},
+    {UINT64_C(0x8FF71A0FE2C2E6DC), UINT64_C(0x47F0E785EABA72AB)},
+    {UINT64_C(0xB3F4E093DB73A093), UINT64_C(0x59ED216765690F56)},
+    {UINT64_C(0xE0F218B8D25088B8), UINT64_C(0x306869C13EC3532C)},
+    {UINT64_C(0x8C974F7383725573), UINT64_C(0x1E414218C73A13FB)},
+    {UINT64_C(0xAFBD2350644EEACF), UINT64_C(0xE5D1929EF90898FA)},
+    {UINT64_C(0xDBAC6C247D62A583), UINT64_C(0xDF45F746B74ABF39)},
+    {UINT64_C(0x894BC396CE5DA772), UINT64_C(0x6B8BBA8C328EB783)},
+    {UINT64_C(0xAB9EB47C81F5114F), UINT64_C(0x066EA92F3F326564)},
+    {UINT64_C(0xD686619BA27255A2), UINT64_C(0xC80A537B0EFEFEBD)},
+    {UINT64_C(0x8613FD0145877585), UINT64_C(0xBD06742CE95F5F36)},
+    {UINT64_C(0xA798FC4196E952E7), UINT64_C(0x2C48113823B73704)},
+    {UINT64_C(0xD17F3B51FCA3A7A0), UINT64_C(0xF75A15862CA504C5)},
+    {UINT64_C(0x82EF85133DE648C4), UINT64_C(0x9A984D73DBE722FB)},
+    {UINT64_C(0xA3AB66580D5FDAF5), UINT64_C(0xC13E60D0D2E0EBBA)},
+    {UINT64_C(0xCC963FEE10B7D1B3), UINT64_C(0x318DF905079926A8)},
+    {UINT64_C(0xFFBBCFE994E5C61F), UINT64_C(0xFDF17746497F7052)},
+    {UINT64_C(0x9FD561F1FD0F9BD3), UINT64_C(0xFEB6EA8BEDEFA633)},
+    {UINT64_C(0xC7CABA6E7C5382C8), UINT64_C(0xFE64A52EE96B8FC0)},
+    {UINT64_C(0xF9BD690A1B68637B), UINT64_C(0x3DFDCE7AA3C673B0)},
+    {UINT64_C(0x9C1661A651213E2D), UINT64_C(0x06BEA10CA65C084E)},
+    {UINT64_C(0xC31BFA0FE5698DB8), UINT64_C(0x486E494FCFF30A62)},
+    {UINT64_C(0xF3E2F893DEC3F126), UINT64_C(0x5A89DBA3C3EFCCFA)},
+    {UINT64_C(0x986DDB5C6B3A76B7), UINT64_C(0xF89629465A75E01C)},
+    {UINT64_C(0xBE89523386091465), UINT64_C(0xF6BBB397F1135823)},
+    {UINT64_C(0xEE2BA6C0678B597F), UINT64_C(0x746AA07DED582E2C)},
+    {UINT64_C(0x94DB483840B717EF), UINT64_C(0xA8C2A44EB4571CDC)},
+    {UINT64_C(0xBA121A4650E4DDEB), UINT64_C(0x92F34D62616CE413)},
+    {UINT64_C(0xE896A0D7E51E1566), UINT64_C(0x77B020BAF9C81D17)},
+    {UINT64_C(0x915E2486EF32CD60), UINT64_C(0x0ACE1474DC1D122E)},
+    {UINT64_C(0xB5B5ADA8AAFF80B8), UINT64_C(0x0D819992132456BA)},
+    {UINT64_C(0xE3231912D5BF60E6), UINT64_C(0x10E1FFF697ED6C69)},
+    {UINT64_C(0x8DF5EFABC5979C8F), UINT64_C(0xCA8D3FFA1EF463C1)},
+    {UINT64_C(0xB1736B96B6FD83B3), UINT64_C(0xBD308FF8A6B17CB2)},
+    {UINT64_C(0xDDD0467C64BCE4A0), UINT64_C(0xAC7CB3F6D05DDBDE)},
+    {UINT64_C(0x8AA22C0DBEF60EE4), UINT64_C(0x6BCDF07A423AA96B)},
+    {UINT64_C(0xAD4AB7112EB3929D), UINT64_C(0x86C16C98D2C953C6)},
+    {UINT64_C(0xD89D64D57A607744), UINT64_C(0xE871C7BF077BA8B7)},
+    {UINT64_C(0x87625F056C7C4A8B), UINT64_C(0x11471CD764AD4972)},
+    {UINT64_C(0xA93AF6C6C79B5D2D), UINT64_C(0xD598E40D3DD89BCF)},
+    {UINT64_C(0xD389B47879823479), UINT64_C(0x4AFF1D108D4EC2C3)},
+    {UINT64_C(0x843610CB4BF160CB), UINT64_C(0xCEDF722A585139BA)},
+    {UINT64_C(0xA54394FE1EEDB8FE), UINT64_C(0xC2974EB4EE658828)},
+    {UINT64_C(0xCE947A3DA6A9273E), UINT64_C(0x733D226229FEEA32)},
+    {UINT64_C(0x811CCC668829B887), UINT64_C(0x0806357D5A3F525F)},
+    {UINT64_C(0xA163FF802A3426A8), UINT64_C(0xCA07C2DCB0CF26F7)},
+    {UINT64_C(0xC9BCFF6034C13052), UINT64_C(0xFC89B393DD02F0B5)},
+    {UINT64_C(0xFC2C3F3841F17C67), UINT64_C(0xBBAC2078D443ACE2)},
+    {UINT64_C(0x9D9BA7832936EDC0), UINT64_C(0xD54B944B84AA4C0D)},
+    {UINT64_C(0xC5029163F384A931), UINT64_C(0x0A9E795E65D4DF11)},
+    {UINT64_C(0xF64335BCF065D37D), UINT64_C(0x4D4617B5FF4A16D5)},
+    {UINT64_C(0x99EA0196163FA42E), UINT64_C(0x504BCED1BF8E4E45)},
+    {UINT64_C(0xC06481FB9BCF8D39), UINT64_C(0xE45EC2862F71E1D6)},
+    {UINT64_C(0xF07DA27A82C37088), UINT64_C(0x5D767327BB4E5A4C)},
+    {UINT64_C(0x964E858C91BA2655), UINT64_C(0x3A6A07F8D510F86F)},
+    {UINT64_C(0xBBE226EFB628AFEA), UINT64_C(0x890489F70A55368B)},
+    {UINT64_C(0xEADAB0ABA3B2DBE5), UINT64_C(0x2B45AC74CCEA842E)},
+    {UINT64_C(0x92C8AE6B464FC96F), UINT64_C(0x3B0B8BC90012929D)},
+    {UINT64_C(0xB77ADA0617E3BBCB), UINT64_C(0x09CE6EBB40173744)},
+    {UINT64_C(0xE55990879DDCAABD), UINT64_C(0xCC420A6A101D0515)},
+    {UINT64_C(0x8F57FA54C2A9EAB6), UINT64_C(0x9FA946824A12232D)},
+    {UINT64_C(0xB32DF8E9F3546564), UINT64_C(0x47939822DC96ABF9)},
+    {UINT64_C(0xDFF9772470297EBD), UINT64_C(0x59787E2B93BC56F7)},
+    {UINT64_C(0x8BFBEA76C619EF36), UINT64_C(0x57EB4EDB3C55B65A)},
+    {UINT64_C(0xAEFAE51477A06B03), UINT64_C(0xEDE622920B6B23F1)},
+    {UINT64_C(0xDAB99E59958885C4), UINT64_C(0xE95FAB368E45ECED)},
+    {UINT64_C(0x88B402F7FD75539B), UINT64_C(0x11DBCB0218EBB414)},
+    {UINT64_C(0xAAE103B5FCD2A881), UINT64_C(0xD652BDC29F26A119)},
+    {UINT64_C(0xD59944A37C0752A2), UINT64_C(0x4BE76D3346F0495F)},
+    {UINT64_C(0x857FCAE62D8493A5), UINT64_C(0x6F70A4400C562DDB)},
+    {UINT64_C(0xA6DFBD9FB8E5B88E), UINT64_C(0xCB4CCD500F6BB952)},
+    {UINT64_C(0xD097AD07A71F26B2), UINT64_C(0x7E2000A41346A7A7)},
+    {UINT64_C(0x825ECC24C873782F), UINT64_C(0x8ED400668C0C28C8)},
+    {UINT64_C(0xA2F67F2DFA90563B), UINT64_C(0x728900802F0F32FA)},
+    {UINT64_C(0xCBB41EF979346BCA), UINT64_C(0x4F2B40A03AD2FFB9)},
+    {UINT64_C(0xFEA126B7D78186BC), UINT64_C(0xE2F610C84987BFA8)},
+    {UINT64_C(0x9F24B832E6B0F436), UINT64_C(0x0DD9CA7D2DF4D7C9)},
+    {UINT64_C(0xC6EDE63FA05D3143), UINT64_C(0x91503D1C79720DBB)},
+    {UINT64_C(0xF8A95FCF88747D94), UINT64_C(0x75A44C6397CE912A)},
+    {UINT64_C(0x9B69DBE1B548CE7C), UINT64_C(0xC986AFBE3EE11ABA)},
+    {UINT64_C(0xC24452DA229B021B), UINT64_C(0xFBE85BADCE996168)},
+    {UINT64_C(0xF2D56790AB41C2A2), UINT64_C(0xFAE27299423FB9C3)},
+    {UINT64_C(0x97C560BA6B0919A5), UINT64_C(0xDCCD879FC967D41A)},
+    {UINT64_C(0xBDB6B8E905CB600F), UINT64_C(0x5400E987BBC1C920)},
+    {UINT64_C(0xED246723473E3813), UINT64_C(0x290123E9AAB23B68)},
+    {UINT64_C(0x9436C0760C86E30B), UINT64_C(0xF9A0B6720AAF6521)},
+    {UINT64_C(0xB94470938FA89BCE), UINT64_C(0xF808E40E8D5B3E69)},
+    {UINT64_C(0xE7958CB87392C2C2), UINT64_C(0xB60B1D1230B20E04)},
+    {UINT64_C(0x90BD77F3483BB9B9), UINT64_C(0xB1C6F22B5E6F48C2)},
+    {UINT64_C(0xB4ECD5F01A4AA828), UINT64_C(0x1E38AEB6360B1AF3)},
+    {UINT64_C(0xE2280B6C20DD5232), UINT64_C(0x25C6DA63C38DE1B0)},
+    {UINT64_C(0x8D590723948A535F), UINT64_C(0x579C487E5A38AD0E)},
+    {UINT64_C(0xB0AF48EC79ACE837), UINT64_C(0x2D835A9DF0C6D851)},
+    {UINT64_C(0xDCDB1B2798182244), UINT64_C(0xF8E431456CF88E65)},
+    {UINT64_C(0x8A08F0F8BF0F156B), UINT64_C(0x1B8E9ECB641B58FF)},
+    {UINT64_C(0xAC8B2D36EED2DAC5), UINT64_C(0xE272467E3D222F3F)},
+    {UINT64_C(0xD7ADF884AA879177), UINT64_C(0x5B0ED81DCC6ABB0F)},
+    {UINT64_C(0x86CCBB52EA94BAEA), UINT64_C(0x98E947129FC2B4E9)},
+    {UINT64_C(0xA87FEA27A539E9A5), UINT64_C(0x3F2398D747B36224)},
+    {UINT64_C(0xD29FE4B18E88640E), UINT64_C(0x8EEC7F0D19A03AAD)},
+    {UINT64_C(0x83A3EEEEF9153E89), UINT64_C(0x1953CF68300424AC)},
+    {UINT64_C(0xA48CEAAAB75A8E2B), UINT64_C(0x5FA8C3423C052DD7)},
+    {UINT64_C(0xCDB02555653131B6), UINT64_C(0x3792F412CB06794D)},
+    {UINT64_C(0x808E17555F3EBF11), UINT64_C(0xE2BBD88BBEE40BD0)},
+    {UINT64_C(0xA0B19D2AB70E6ED6), UINT64_C(0x5B6ACEAEAE9D0EC4)},
+    {UINT64_C(0xC8DE047564D20A8B), UINT64_C(0xF245825A5A445275)},
+    {UINT64_C(0xFB158592BE068D2E), UINT64_C(0xEED6E2F0F0D56712)},
+    {UINT64_C(0x9CED737BB6C4183D), UINT64_C(0x55464DD69685606B)},
+    {UINT64_C(0xC428D05AA4751E4C), UINT64_C(0xAA97E14C3C26B886)},
+    {UINT64_C(0xF53304714D9265DF), UINT64_C(0xD53DD99F4B3066A8)},
+    {UINT64_C(0x993FE2C6D07B7FAB), UINT64_C(0xE546A8038EFE4029)},
+    {UINT64_C(0xBF8FDB78849A5F96), UINT64_C(0xDE98520472BDD033)},
+    {UINT64_C(0xEF73D256A5C0F77C), UINT64_C(0x963E66858F6D4440)},
+    {UINT64_C(0x95A8637627989AAD), UINT64_C(0xDDE7001379A44AA8)},
+    {UINT64_C(0xBB127C53B17EC159), UINT64_C(0x5560C018580D5D52)},
+    {UINT64_C(0xE9D71B689DDE71AF), UINT64_C(0xAAB8F01E6E10B4A6)},
+    {UINT64_C(0x9226712162AB070D), UINT64_C(0xCAB3961304CA70E8)},
+    {UINT64_C(0xB6B00D69BB55C8D1), UINT64_C(0x3D607B97C5FD0D22)},
+    {UINT64_C(0xE45C10C42A2B3B05), UINT64_C(0x8CB89A7DB77C506A)},
+    {UINT64_C(0x8EB98A7A9A5B04E3), UINT64_C(0x77F3608E92ADB242)},
+    {UINT64_C(0xB267ED1940F1C61C), UINT64_C(0x55F038B237591ED3)},
+    {UINT64_C(0xDF01E85F912E37A3), UINT64_C(0x6B6C46DEC52F6688)},
+    {UINT64_C(0x8B61313BBABCE2C6), UINT64_C(0x2323AC4B3B3DA015)},
+    {UINT64_C(0xAE397D8AA96C1B77), UINT64_C(0xABEC975E0A0D081A)},
+    {UINT64_C(0xD9C7DCED53C72255), UINT64_C(0x96E7BD358C904A21)},
+    {UINT64_C(0x881CEA14545C7575), UINT64_C(0x7E50D64177DA2E54)},
+    {UINT64_C(0xAA242499697392D2), UINT64_C(0xDDE50BD1D5D0B9E9)},
+    {UINT64_C(0xD4AD2DBFC3D07787), UINT64_C(0x955E4EC64B44E864)},
+    {UINT64_C(0x84EC3C97DA624AB4), UINT64_C(0xBD5AF13BEF0B113E)},
+    {UINT64_C(0xA6274BBDD0FADD61), UINT64_C(0xECB1AD8AEACDD58E)},
+    {UINT64_C(0xCFB11EAD453994BA), UINT64_C(0x67DE18EDA5814AF2)},
+    {UINT64_C(0x81CEB32C4B43FCF4), UINT64_C(0x80EACF948770CED7)},
+    {UINT64_C(0xA2425FF75E14FC31), UINT64_C(0xA1258379A94D028D)},
+    {UINT64_C(0xCAD2F7F5359A3B3E), UINT64_C(0x096EE45813A04330)},
+    {UINT64_C(0xFD87B5F28300CA0D), UINT64_C(0x8BCA9D6E188853FC)},
+    {UINT64_C(0x9E74D1B791E07E48), UINT64_C(0x775EA264CF55347E)},
+    {UINT64_C(0xC612062576589DDA), UINT64_C(0x95364AFE032A819E)},
+    {UINT64_C(0xF79687AED3EEC551), UINT64_C(0x3A83DDBD83F52205)},
+    {UINT64_C(0x9ABE14CD44753B52), UINT64_C(0xC4926A9672793543)},
+    {UINT64_C(0xC16D9A0095928A27), UINT64_C(0x75B7053C0F178294)},
+    {UINT64_C(0xF1C90080BAF72CB1), UINT64_C(0x5324C68B12DD6339)},
+    {UINT64_C(0x971DA05074DA7BEE), UINT64_C(0xD3F6FC16EBCA5E04)},
+    {UINT64_C(0xBCE5086492111AEA), UINT64_C(0x88F4BB1CA6BCF585)},
+    {UINT64_C(0xEC1E4A7DB69561A5), UINT64_C(0x2B31E9E3D06C32E6)},
+    {UINT64_C(0x9392EE8E921D5D07), UINT64_C(0x3AFF322E62439FD0)},
+    {UINT64_C(0xB877AA3236A4B449), UINT64_C(0x09BEFEB9FAD487C3)},
+    {UINT64_C(0xE69594BEC44DE15B), UINT64_C(0x4C2EBE687989A9B4)},
+    {UINT64_C(0x901D7CF73AB0ACD9), UINT64_C(0x0F9D37014BF60A11)},
+    {UINT64_C(0xB424DC35095CD80F), UINT64_C(0x538484C19EF38C95)},
+    {UINT64_C(0xE12E13424BB40E13), UINT64_C(0x2865A5F206B06FBA)},
+    {UINT64_C(0x8CBCCC096F5088CB), UINT64_C(0xF93F87B7442E45D4)},
+    {UINT64_C(0xAFEBFF0BCB24AAFE), UINT64_C(0xF78F69A51539D749)},
+    {UINT64_C(0xDBE6FECEBDEDD5BE), UINT64_C(0xB573440E5A884D1C)},
+    {UINT64_C(0x89705F4136B4A597), UINT64_C(0x31680A88F8953031)},
+    {UINT64_C(0xABCC77118461CEFC), UINT64_C(0xFDC20D2B36BA7C3E)},
+    {UINT64_C(0xD6BF94D5E57A42BC), UINT64_C(0x3D32907604691B4D)},
+    {UINT64_C(0x8637BD05AF6C69B5), UINT64_C(0xA63F9A49C2C1B110)},
+    {UINT64_C(0xA7C5AC471B478423), UINT64_C(0x0FCF80DC33721D54)},
+    {UINT64_C(0xD1B71758E219652B), UINT64_C(0xD3C36113404EA4A9)},
+    {UINT64_C(0x83126E978D4FDF3B), UINT64_C(0x645A1CAC083126EA)},
+    {UINT64_C(0xA3D70A3D70A3D70A), UINT64_C(0x3D70A3D70A3D70A4)},
+    {UINT64_C(0xCCCCCCCCCCCCCCCC), UINT64_C(0xCCCCCCCCCCCCCCCD)},
+    {UINT64_C(0x8000000000000000), UINT64_C(0x0000000000000000)},
+    {UINT64_C(0xA000000000000000), UINT64_C(0x0000000000000000)},
+    {UINT64_C(0xC800000000000000), UINT64_C(0x0000000000000000)},
+    {UINT64_C(0xFA00000000000000), UINT64_C(0x0000000000000000)},
+    {UINT64_C(0x9C40000000000000), UINT64_C(0x0000000000000000)},
+    {UINT64_C(0xC350000000000000), UINT64_C(0x0000000000000000)},
+    {UINT64_C(0xF424000000000000), UINT64_C(0x0000000000000000)},
+    {UINT64_C(0x9896800000000000), UINT64_C(0x0000000000000000)},
+    {UINT64_C(0xBEBC200000000000), UINT64_C(0x0000000000000000)},
+    {UINT64_C(0xEE6B280000000000), UINT64_C(0x0000000000000000)},
+    {UINT64_C(0x9502F90000000000), UINT64_C(0x0000000000000000)},
+    {UINT64_C(0xBA43B74000000000), UINT64_C(0x0000000000000000)},
+    {UINT64_C(0xE8D4A51000000000), UINT64_C(0x0000000000000000)},
+    {UINT64_C(0x9184E72A00000000), UINT64_C(0x0000000000000000)},
+    {UINT64_C(0xB5E620F480000000), UINT64_C(0x0000000000000000)},
+    {UINT64_C(0xE35FA931A0000000), UINT64_C(0x0000000000000000)},
+    {UINT64_C(0x8E1BC9BF04000000), UINT64_C(0x0000000000000000)},
+    {UINT64_C(0xB1A2BC2EC5000000), UINT64_C(0x0000000000000000)},
+    {UINT64_C(0xDE0B6B3A76400000), UINT64_C(0x0000000000000000)},
+    {UINT64_C(0x8AC7230489E80000), UINT64_C(0x0000000000000000)},
+    {UINT64_C(0xAD78EBC5AC620000), UINT64_C(0x0000000000000000)},
+    {UINT64_C(0xD8D726B7177A8000), UINT64_C(0x0000000000000000)},
+    {UINT64_C(0x878678326EAC9000), UINT64_C(0x0000000000000000)},
+    {UINT64_C(0xA968163F0A57B400), UINT64_C(0x0000000000000000)},
+    {UINT64_C(0xD3C21BCECCEDA100), UINT64_C(0x0000000000000000)},
+    {UINT64_C(0x84595161401484A0), UINT64_C(0x0000000000000000)},
+    {UINT64_C(0xA56FA5B99019A5C8), UINT64_C(0x0000000000000000)},
+    {UINT64_C(0xCECB8F27F4200F3A), UINT64_C(0x0000000000000000)},
+    {UINT64_C(0x813F3978F8940984), UINT64_C(0x4000000000000000)},
+    {UINT64_C(0xA18F07D736B90BE5), UINT64_C(0x5000000000000000)},
+    {UINT64_C(0xC9F2C9CD04674EDE), UINT64_C(0xA400000000000000)},
+    {UINT64_C(0xFC6F7C4045812296), UINT64_C(0x4D00000000000000)},
+    {UINT64_C(0x9DC5ADA82B70B59D), UINT64_C(0xF020000000000000)},
+    {UINT64_C(0xC5371912364CE305), UINT64_C(0x6C28000000000000)},
+    {UINT64_C(0xF684DF56C3E01BC6), UINT64_C(0xC732000000000000)},
+    {UINT64_C(0x9A130B963A6C115C), UINT64_C(0x3C7F400000000000)},
+    {UINT64_C(0xC097CE7BC90715B3), UINT64_C(0x4B9F100000000000)},
+    {UINT64_C(0xF0BDC21ABB48DB20), UINT64_C(0x1E86D40000000000)},
+    {UINT64_C(0x96769950B50D88F4), UINT64_C(0x1314448000000000)},
+    {UINT64_C(0xBC143FA4E250EB31), UINT64_C(0x17D955A000000000)},
+    {UINT64_C(0xEB194F8E1AE525FD), UINT64_C(0x5DCFAB0800000000)},
+    {UINT64_C(0x92EFD1B8D0CF37BE), UINT64_C(0x5AA1CAE500000000)},
+    {UINT64_C(0xB7ABC627050305AD), UINT64_C(0xF14A3D9E40000000)},
+    {UINT64_C(0xE596B7B0C643C719), UINT64_C(0x6D9CCD05D0000000)},
+    {UINT64_C(0x8F7E32CE7BEA5C6F), UINT64_C(0xE4820023A2000000)},
+    {UINT64_C(0xB35DBF821AE4F38B), UINT64_C(0xDDA2802C8A800000)},
+    {UINT64_C(0xE0352F62A19E306E), UINT64_C(0xD50B2037AD200000)},
+    {UINT64_C(0x8C213D9DA502DE45), UINT64_C(0x4526F422CC340000)},
+    {UINT64_C(0xAF298D050E4395D6), UINT64_C(0x9670B12B7F410000)},
+    {UINT64_C(0xDAF3F04651D47B4C), UINT64_C(0x3C0CDD765F114000)},
+    {UINT64_C(0x88D8762BF324CD0F), UINT64_C(0xA5880A69FB6AC800)},
+    {UINT64_C(0xAB0E93B6EFEE0053), UINT64_C(0x8EEA0D047A457A00)},
+    {UINT64_C(0xD5D238A4ABE98068), UINT64_C(0x72A4904598D6D880)},
+    {UINT64_C(0x85A36366EB71F041), UINT64_C(0x47A6DA2B7F864750)},
+    {UINT64_C(0xA70C3C40A64E6C51), UINT64_C(0x999090B65F67D924)},
+    {UINT64_C(0xD0CF4B50CFE20765), UINT64_C(0xFFF4B4E3F741CF6D)},
+    {UINT64_C(0x82818F1281ED449F), UINT64_C(0xBFF8F10E7A8921A4)},
+    {UINT64_C(0xA321F2D7226895C7), UINT64_C(0xAFF72D52192B6A0D)},
+    {UINT64_C(0xCBEA6F8CEB02BB39), UINT64_C(0x9BF4F8A69F764490)},
+    {UINT64_C(0xFEE50B7025C36A08), UINT64_C(0x02F236D04753D5B4)},
+    {UINT64_C(0x9F4F2726179A2245), UINT64_C(0x01D762422C946590)},
+    {UINT64_C(0xC722F0EF9D80AAD6), UINT64_C(0x424D3AD2B7B97EF5)},
+    {UINT64_C(0xF8EBAD2B84E0D58B), UINT64_C(0xD2E0898765A7DEB2)},
+    {UINT64_C(0x9B934C3B330C8577), UINT64_C(0x63CC55F49F88EB2F)},
+    {UINT64_C(0xC2781F49FFCFA6D5), UINT64_C(0x3CBF6B71C76B25FB)},
+    {UINT64_C(0xF316271C7FC3908A), UINT64_C(0x8BEF464E3945EF7A)},
+    {UINT64_C(0x97EDD871CFDA3A56), UINT64_C(0x97758BF0E3CBB5AC)},
+    {UINT64_C(0xBDE94E8E43D0C8EC), UINT64_C(0x3D52EEED1CBEA317)},
+    {UINT64_C(0xED63A231D4C4FB27), UINT64_C(0x4CA7AAA863EE4BDD)},
+    {UINT64_C(0x945E455F24FB1CF8), UINT64_C(0x8FE8CAA93E74EF6A)},
+    {UINT64_C(0xB975D6B6EE39E436), UINT64_C(0xB3E2FD538E122B44)},
+    {UINT64_C(0xE7D34C64A9C85D44), UINT64_C(0x60DBBCA87196B616)},
+    {UINT64_C(0x90E40FBEEA1D3A4A), UINT64_C(0xBC8955E946FE31CD)},
+    {UINT64_C(0xB51D13AEA4A488DD), UINT64_C(0x6BABAB6398BDBE41)},
+    {UINT64_C(0xE264589A4DCDAB14), UINT64_C(0xC696963C7EED2DD1)},
+    {UINT64_C(0x8D7EB76070A08AEC), UINT64_C(0xFC1E1DE5CF543CA2)},
+    {UINT64_C(0xB0DE65388CC8ADA8), UINT64_C(0x3B25A55F43294BCB)},
+    {UINT64_C(0xDD15FE86AFFAD912), UINT64_C(0x49EF0EB713F39EBE)},
+    {UINT64_C(0x8A2DBF142DFCC7AB), UINT64_C(0x6E3569326C784337)},
+    {UINT64_C(0xACB92ED9397BF996), UINT64_C(0x49C2C37F07965404)},
+    {UINT64_C(0xD7E77A8F87DAF7FB), UINT64_C(0xDC33745EC97BE906)},
+    {UINT64_C(0x86F0AC99B4E8DAFD), UINT64_C(0x69A028BB3DED71A3)},
+    {UINT64_C(0xA8ACD7C0222311BC), UINT64_C(0xC40832EA0D68CE0C)},
+    {UINT64_C(0xD2D80DB02AABD62B), UINT64_C(0xF50A3FA490C30190)},
+    {UINT64_C(0x83C7088E1AAB65DB), UINT64_C(0x792667C6DA79E0FA)},
+    {UINT64_C(0xA4B8CAB1A1563F52), UINT64_C(0x577001B891185938)},
+    {UINT64_C(0xCDE6FD5E09ABCF26), UINT64_C(0xED4C0226B55E6F86)},
+    {UINT64_C(0x80B05E5AC60B6178), UINT64_C(0x544F8158315B05B4)},
+    {UINT64_C(0xA0DC75F1778E39D6), UINT64_C(0x696361AE3DB1C721)},
+    {UINT64_C(0xC913936DD571C84C), UINT64_C(0x03BC3A19CD1E38E9)},
+    {UINT64_C(0xFB5878494ACE3A5F), UINT64_C(0x04AB48A04065C723)},
+    {UINT64_C(0x9D174B2DCEC0E47B), UINT64_C(0x62EB0D64283F9C76)},
+    {UINT64_C(0xC45D1DF942711D9A), UINT64_C(0x3BA5D0BD324F8394)},
+    {UINT64_C(0xF5746577930D6500), UINT64_C(0xCA8F44EC7EE36479)},
+    {UINT64_C(0x9968BF6ABBE85F20), UINT64_C(0x7E998B13CF4E1ECB)},
+    {UINT64_C(0xBFC2EF456AE276E8), UINT64_C(0x9E3FEDD8C321A67E)},
+    {UINT64_C(0xEFB3AB16C59B14A2), UINT64_C(0xC5CFE94EF3EA101E)},
+    {UINT64_C(0x95D04AEE3B80ECE5), UINT64_C(0xBBA1F1D158724A12)},
+    {UINT64_C(0xBB445DA9CA61281F), UINT64_C(0x2A8A6E45AE8EDC97)},
+    {UINT64_C(0xEA1575143CF97226), UINT64_C(0xF52D09D71A3293BD)},
+    {UINT64_C(0x924D692CA61BE758), UINT64_C(0x593C2626705F9C56)},
+    {UINT64_C(0xB6E0C377CFA2E12E), UINT64_C(0x6F8B2FB00C77836C)},
+    {UINT64_C(0xE498F455C38B997A), UINT64_C(0x0B6DFB9C0F956447)},
+    {UINT64_C(0x8EDF98B59A373FEC), UINT64_C(0x4724BD4189BD5EAC)},
+    {UINT64_C(0xB2977EE300C50FE7), UINT64_C(0x58EDEC91EC2CB657)},
+    {UINT64_C(0xDF3D5E9BC0F653E1), UINT64_C(0x2F2967B66737E3ED)},
+    {UINT64_C(0x8B865B215899F46C), UINT64_C(0xBD79E0D20082EE74)},
+    {UINT64_C(0xAE67F1E9AEC07187), UINT64_C(0xECD8590680A3AA11)},
+    {UINT64_C(0xDA01EE641A708DE9), UINT64_C(0xE80E6F4820CC9495)},
+    {UINT64_C(0x884134FE908658B2), UINT64_C(0x3109058D147FDCDD)},
+    {UINT64_C(0xAA51823E34A7EEDE), UINT64_C(0xBD4B46F0599FD415)},
+    {UINT64_C(0xD4E5E2CDC1D1EA96), UINT64_C(0x6C9E18AC7007C91A)},
+    {UINT64_C(0x850FADC09923329E), UINT64_C(0x03E2CF6BC604DDB0)},
+    {UINT64_C(0xA6539930BF6BFF45), UINT64_C(0x84DB8346B786151C)},
+    {UINT64_C(0xCFE87F7CEF46FF16), UINT64_C(0xE612641865679A63)},
+    {UINT64_C(0x81F14FAE158C5F6E), UINT64_C(0x4FCB7E8F3F60C07E)},
+    {UINT64_C(0xA26DA3999AEF7749), UINT64_C(0xE3BE5E330F38F09D)},
+    {UINT64_C(0xCB090C8001AB551C), UINT64_C(0x5CADF5BFD3072CC5)},
+    {UINT64_C(0xFDCB4FA002162A63), UINT64_C(0x73D9732FC7C8F7F6)},
+    {UINT64_C(0x9E9F11C4014DDA7E), UINT64_C(0x2867E7FDDCDD9AFA)},
+    {UINT64_C(0xC646D63501A1511D), UINT64_C(0xB281E1FD541501B8)},
+    {UINT64_C(0xF7D88BC24209A565), UINT64_C(0x1F225A7CA91A4226)},
+    {UINT64_C(0x9AE757596946075F), UINT64_C(0x3375788DE9B06958)},
+    {UINT64_C(0xC1A12D2FC3978937), UINT64_C(0x0052D6B1641C83AE)},
+    {UINT64_C(0xF209787BB47D6B84), UINT64_C(0xC0678C5DBD23A49A)},
+    {UINT64_C(0x9745EB4D50CE6332), UINT64_C(0xF840B7BA963646E0)},
+    {UINT64_C(0xBD176620A501FBFF), UINT64_C(0xB650E5A93BC3D898)},
+    {UINT64_C(0xEC5D3FA8CE427AFF), UINT64_C(0xA3E51F138AB4CEBE)},
+    {UINT64_C(0x93BA47C980E98CDF), UINT64_C(0xC66F336C36B10137)},
+    {UINT64_C(0xB8A8D9BBE123F017), UINT64_C(0xB80B0047445D4184)},
+    {UINT64_C(0xE6D3102AD96CEC1D), UINT64_C(0xA60DC059157491E5)},
+    {UINT64_C(0x9043EA1AC7E41392), UINT64_C(0x87C89837AD68DB2F)},
+    {UINT64_C(0xB454E4A179DD1877), UINT64_C(0x29BABE4598C311FB)},
+    {UINT64_C(0xE16A1DC9D8545E94), UINT64_C(0xF4296DD6FEF3D67A)},
+    {UINT64_C(0x8CE2529E2734BB1D), UINT64_C(0x1899E4A65F58660C)},
+    {UINT64_C(0xB01AE745B101E9E4), UINT64_C(0x5EC05DCFF72E7F8F)},
+    {UINT64_C(0xDC21A1171D42645D), UINT64_C(0x76707543F4FA1F73)},
+    {UINT64_C(0x899504AE72497EBA), UINT64_C(0x6A06494A791C53A8)},
+    {UINT64_C(0xABFA45DA0EDBDE69), UINT64_C(0x0487DB9D17636892)},
+    {UINT64_C(0xD6F8D7509292D603), UINT64_C(0x45A9D2845D3C42B6)},
+    {UINT64_C(0x865B86925B9BC5C2), UINT64_C(0x0B8A2392BA45A9B2)},
+    {UINT64_C(0xA7F26836F282B732), UINT64_C(0x8E6CAC7768D7141E)},
+    {UINT64_C(0xD1EF0244AF2364FF), UINT64_C(0x3207D795430CD926)},
+    {UINT64_C(0x8335616AED761F1F), UINT64_C(0x7F44E6BD49E807B8)},
+    {UINT64_C(0xA402B9C5A8D3A6E7), UINT64_C(0x5F16206C9C6209A6)},
+    {UINT64_C(0xCD036837130890A1), UINT64_C(0x36DBA887C37A8C0F)},
+    {UINT64_C(0x802221226BE55A64), UINT64_C(0xC2494954DA2C9789)},
+    {UINT64_C(0xA02AA96B06DEB0FD), UINT64_C(0xF2DB9BAA10B7BD6C)},
+    {UINT64_C(0xC83553C5C8965D3D), UINT64_C(0x6F92829494E5ACC7)},
+    {UINT64_C(0xFA42A8B73ABBF48C), UINT64_C(0xCB772339BA1F17F9)},
+    {UINT64_C(0x9C69A97284B578D7), UINT64_C(0xFF2A760414536EFB)},
+    {UINT64_C(0xC38413CF25E2D70D), UINT64_C(0xFEF5138519684ABA)},
+    {UINT64_C(0xF46518C2EF5B8CD1), UINT64_C(0x7EB258665FC25D69)},
+    {UINT64_C(0x98BF2F79D5993802), UINT64_C(0xEF2F773FFBD97A61)},
+    {UINT64_C(0xBEEEFB584AFF8603), UINT64_C(0xAAFB550FFACFD8FA)},
+    {UINT64_C(0xEEAABA2E5DBF6784), UINT64_C(0x95BA2A53F983CF38)},
+    {UINT64_C(0x952AB45CFA97A0B2), UINT64_C(0xDD945A747BF26183)},
+    {UINT64_C(0xBA756174393D88DF), UINT64_C(0x94F971119AEEF9E4)},
+    {UINT64_C(0xE912B9D1478CEB17), UINT64_C(0x7A37CD5601AAB85D)},
+    {UINT64_C(0x91ABB422CCB812EE), UINT64_C(0xAC62E055C10AB33A)},
+    {UINT64_C(0xB616A12B7FE617AA), UINT64_C(0x577B986B314D6009)},
+    {UINT64_C(0xE39C49765FDF9D94), UINT64_C(0xED5A7E85FDA0B80B)},
+    {UINT64_C(0x8E41ADE9FBEBC27D), UINT64_C(0x14588F13BE847307)},
+    {UINT64_C(0xB1D219647AE6B31C), UINT64_C(0x596EB2D8AE258FC8)},
+    {UINT64_C(0xDE469FBD99A05FE3), UINT64_C(0x6FCA5F8ED9AEF3BB)},
+    {UINT64_C(0x8AEC23D680043BEE), UINT64_C(0x25DE7BB9480D5854)},
+    {UINT64_C(0xADA72CCC20054AE9), UINT64_C(0xAF561AA79A10AE6A)},
+    {UINT64_C(0xD910F7FF28069DA4), UINT64_C(0x1B2BA1518094DA04)},
+    {UINT64_C(0x87AA9AFF79042286), UINT64_C(0x90FB44D2F05D0842)},
+    {UINT64_C(0xA99541BF57452B28), UINT64_C(0x353A1607AC744A53)},
+    {UINT64_C(0xD3FA922F2D1675F2), UINT64_C(0x42889B8997915CE8)},
+    {UINT64_C(0x847C9B5D7C2E09B7), UINT64_C(0x69956135FEBADA11)},
+    {UINT64_C(0xA59BC234DB398C25), UINT64_C(0x43FAB9837E699095)},
+    {UINT64_C(0xCF02B2C21207EF2E), UINT64_C(0x94F967E45E03F4BB)},
+    {UINT64_C(0x8161AFB94B44F57D), UINT64_C(0x1D1BE0EEBAC278F5)},
+    {UINT64_C(0xA1BA1BA79E1632DC), UINT64_C(0x6462D92A69731732)},
+    {UINT64_C(0xCA28A291859BBF93), UINT64_C(0x7D7B8F7503CFDCFE)},
+    {UINT64_C(0xFCB2CB35E702AF78), UINT64_C(0x5CDA735244C3D43E)},
+    {UINT64_C(0x9DEFBF01B061ADAB), UINT64_C(0x3A0888136AFA64A7)},
+    {UINT64_C(0xC56BAEC21C7A1916), UINT64_C(0x088AAA1845B8FDD0)},
+    {UINT64_C(0xF6C69A72A3989F5B), UINT64_C(0x8AAD549E57273D45)},
+    {UINT64_C(0x9A3C2087A63F6399), UINT64_C(0x36AC54E2F678864B)},
+    {UINT64_C(0xC0CB28A98FCF3C7F), UINT64_C(0x84576A1BB416A7DD)},
+    {UINT64_C(0xF0FDF2D3F3C30B9F), UINT64_C(0x656D44A2A11C51D5)},
+    {UINT64_C(0x969EB7C47859E743), UINT64_C(0x9F644AE5A4B1B325)},
+    {UINT64_C(0xBC4665B596706114), UINT64_C(0x873D5D9F0DDE1FEE)},
+    {UINT64_C(0xEB57FF22FC0C7959), UINT64_C(0xA90CB506D155A7EA)},
+    {UINT64_C(0x9316FF75DD87CBD8), UINT64_C(0x09A7F12442D588F2)},
+    {UINT64_C(0xB7DCBF5354E9BECE), UINT64_C(0x0C11ED6D538AEB2F)},
+    {UINT64_C(0xE5D3EF282A242E81), UINT64_C(0x8F1668C8A86DA5FA)},
+    {UINT64_C(0x8FA475791A569D10), UINT64_C(0xF96E017D694487BC)},
+    {UINT64_C(0xB38D92D760EC4455), UINT64_C(0x37C981DCC395A9AC)},
+    {UINT64_C(0xE070F78D3927556A), UINT64_C(0x85BBE253F47B1417)},
+    {UINT64_C(0x8C469AB843B89562), UINT64_C(0x93956D7478CCEC8E)},
+    {UINT64_C(0xAF58416654A6BABB), UINT64_C(0x387AC8D1970027B2)},
+    {UINT64_C(0xDB2E51BFE9D0696A), UINT64_C(0x06997B05FCC0319E)},
+    {UINT64_C(0x88FCF317F22241E2), UINT64_C(0x441FECE3BDF81F03)},
+    {UINT64_C(0xAB3C2FDDEEAAD25A), UINT64_C(0xD527E81CAD7626C3)},
+    {UINT64_C(0xD60B3BD56A5586F1), UINT64_C(0x8A71E223D8D3B074)},
+    {UINT64_C(0x85C7056562757456), UINT64_C(0xF6872D5667844E49)},
+    {UINT64_C(0xA738C6BEBB12D16C), UINT64_C(0xB428F8AC016561DB)},
+    {UINT64_C(0xD106F86E69D785C7), UINT64_C(0xE13336D701BEBA52)},
+    {UINT64_C(0x82A45B450226B39C), UINT64_C(0xECC0024661173473)},
+    {UINT64_C(0xA34D721642B06084), UINT64_C(0x27F002D7F95D0190)},
+    {UINT64_C(0xCC20CE9BD35C78A5), UINT64_C(0x31EC038DF7B441F4)},
+    {UINT64_C(0xFF290242C83396CE), UINT64_C(0x7E67047175A15271)},
+    {UINT64_C(0x9F79A169BD203E41), UINT64_C(0x0F0062C6E984D386)},
+    {UINT64_C(0xC75809C42C684DD1), UINT64_C(0x52C07B78A3E60868)},
+    {UINT64_C(0xF92E0C3537826145), UINT64_C(0xA7709A56CCDF8A82)},
+    {UINT64_C(0x9BBCC7A142B17CCB), UINT64_C(0x88A66076400BB691)},
+    {UINT64_C(0xC2ABF989935DDBFE), UINT64_C(0x6ACFF893D00EA435)},
+    {UINT64_C(0xF356F7EBF83552FE), UINT64_C(0x0583F6B8C4124D43)},
+    {UINT64_C(0x98165AF37B2153DE), UINT64_C(0xC3727A337A8B704A)},
+    {UINT64_C(0xBE1BF1B059E9A8D6), UINT64_C(0x744F18C0592E4C5C)},
+    {UINT64_C(0xEDA2EE1C7064130C), UINT64_C(0x1162DEF06F79DF73)},
+    {UINT64_C(0x9485D4D1C63E8BE7), UINT64_C(0x8ADDCB5645AC2BA8)},
+    {UINT64_C(0xB9A74A0637CE2EE1), UINT64_C(0x6D953E2BD7173692)},
+    {UINT64_C(0xE8111C87C5C1BA99), UINT64_C(0xC8FA8DB6CCDD0437)},
+    {UINT64_C(0x910AB1D4DB9914A0), UINT64_C(0x1D9C9892400A22A2)},
+    {UINT64_C(0xB54D5E4A127F59C8), UINT64_C(0x2503BEB6D00CAB4B)},
+    {UINT64_C(0xE2A0B5DC971F303A), UINT64_C(0x2E44AE64840FD61D)},
+    {UINT64_C(0x8DA471A9DE737E24), UINT64_C(0x5CEAECFED289E5D2)},
+    {UINT64_C(0xB10D8E1456105DAD), UINT64_C(0x7425A83E872C5F47)},
+    {UINT64_C(0xDD50F1996B947518), UINT64_C(0xD12F124E28F77719)},
+    {UINT64_C(0x8A5296FFE33CC92F), UINT64_C(0x82BD6B70D99AAA6F)},
+    {UINT64_C(0xACE73CBFDC0BFB7B), UINT64_C(0x636CC64D1001550B)},
+    {UINT64_C(0xD8210BEFD30EFA5A), UINT64_C(0x3C47F7E05401AA4E)},
+    {UINT64_C(0x8714A775E3E95C78), UINT64_C(0x65ACFAEC34810A71)},
+    {UINT64_C(0xA8D9D1535CE3B396), UINT64_C(0x7F1839A741A14D0D)},
+    {UINT64_C(0xD31045A8341CA07C), UINT64_C(0x1EDE48111209A050)},
+    {UINT64_C(0x83EA2B892091E44D), UINT64_C(0x934AED0AAB460432)},
+    {UINT64_C(0xA4E4B66B68B65D60), UINT64_C(0xF81DA84D5617853F)},
+    {UINT64_C(0xCE1DE40642E3F4B9), UINT64_C(0x36251260AB9D668E)},
+    {UINT64_C(0x80D2AE83E9CE78F3), UINT64_C(0xC1D72B7C6B426019)},
+    {UINT64_C(0xA1075A24E4421730), UINT64_C(0xB24CF65B8612F81F)},
+    {UINT64_C(0xC94930AE1D529CFC), UINT64_C(0xDEE033F26797B627)},
+    {UINT64_C(0xFB9B7CD9A4A7443C), UINT64_C(0x169840EF017DA3B1)},
+    {UINT64_C(0x9D412E0806E88AA5), UINT64_C(0x8E1F289560EE864E)},
+    {UINT64_C(0xC491798A08A2AD4E), UINT64_C(0xF1A6F2BAB92A27E2)},
+    {UINT64_C(0xF5B5D7EC8ACB58A2), UINT64_C(0xAE10AF696774B1DB)},
+    {UINT64_C(0x9991A6F3D6BF1765), UINT64_C(0xACCA6DA1E0A8EF29)},
+    {UINT64_C(0xBFF610B0CC6EDD3F), UINT64_C(0x17FD090A58D32AF3)},
+    {UINT64_C(0xEFF394DCFF8A948E), UINT64_C(0xDDFC4B4CEF07F5B0)},
+    {UINT64_C(0x95F83D0A1FB69CD9), UINT64_C(0x4ABDAF101564F98E)},
+    {UINT64_C(0xBB764C4CA7A4440F), UINT64_C(0x9D6D1AD41ABE37F1)},
+    {UINT64_C(0xEA53DF5FD18D5513), UINT64_C(0x84C86189216DC5ED)},
+    {UINT64_C(0x92746B9BE2F8552C), UINT64_C(0x32FD3CF5B4E49BB4)},
+    {UINT64_C(0xB7118682DBB66A77), UINT64_C(0x3FBC8C33221DC2A1)},
+    {UINT64_C(0xE4D5E82392A40515), UINT64_C(0x0FABAF3FEAA5334A)},
+    {UINT64_C(0x8F05B1163BA6832D), UINT64_C(0x29CB4D87F2A7400E)},
+    {UINT64_C(0xB2C71D5BCA9023F8), UINT64_C(0x743E20E9EF511012)},
+    {UINT64_C(0xDF78E4B2BD342CF6), UINT64_C(0x914DA9246B255416)},
+    {UINT64_C(0x8BAB8EEFB6409C1A), UINT64_C(0x1AD089B6C2F7548E)},
+    {UINT64_C(0xAE9672ABA3D0C320), UINT64_C(0xA184AC2473B529B1)},
+    {UINT64_C(0xDA3C0F568CC4F3E8), UINT64_C(0xC9E5D72D90A2741E)},
+    {UINT64_C(0x8865899617FB1871), UINT64_C(0x7E2FA67C7A658892)},
+    {UINT64_C(0xAA7EEBFB9DF9DE8D), UINT64_C(0xDDBB901B98FEEAB7)},
+    {UINT64_C(0xD51EA6FA85785631), UINT64_C(0x552A74227F3EA565)},
+    {UINT64_C(0x8533285C936B35DE), UINT64_C(0xD53A88958F87275F)},
+    {UINT64_C(0xA67FF273B8460356), UINT64_C(0x8A892ABAF368F137)},
+    {UINT64_C(0xD01FEF10A657842C), UINT64_C(0x2D2B7569B0432D85)},
+    {UINT64_C(0x8213F56A67F6B29B), UINT64_C(0x9C3B29620E29FC73)},
+    {UINT64_C(0xA298F2C501F45F42), UINT64_C(0x8349F3BA91B47B8F)},
+    {UINT64_C(0xCB3F2F7642717713), UINT64_C(0x241C70A936219A73)},
+    {UINT64_C(0xFE0EFB53D30DD4D7), UINT64_C(0xED238CD383AA0110)},
+    {UINT64_C(0x9EC95D1463E8A506), UINT64_C(0xF4363804324A40AA)},
+    {UINT64_C(0xC67BB4597CE2CE48), UINT64_C(0xB143C6053EDCD0D5)},
+    {UINT64_C(0xF81AA16FDC1B81DA), UINT64_C(0xDD94B7868E94050A)},
+    {UINT64_C(0x9B10A4E5E9913128), UINT64_C(0xCA7CF2B4191C8326)},
+    {UINT64_C(0xC1D4CE1F63F57D72), UINT64_C(0xFD1C2F611F63A3F0)},
+    {UINT64_C(0xF24A01A73CF2DCCF), UINT64_C(0xBC633B39673C8CEC)},
+    {UINT64_C(0x976E41088617CA01), UINT64_C(0xD5BE0503E085D813)},
+    {UINT64_C(0xBD49D14AA79DBC82), UINT64_C(0x4B2D8644D8A74E18)},
+    {UINT64_C(0xEC9C459D51852BA2), UINT64_C(0xDDF8E7D60ED1219E)},
+    {UINT64_C(0x93E1AB8252F33B45), UINT64_C(0xCABB90E5C942B503)},
+    {UINT64_C(0xB8DA1662E7B00A17), UINT64_C(0x3D6A751F3B936243)},
+    {UINT64_C(0xE7109BFBA19C0C9D), UINT64_C(0x0CC512670A783AD4)},
+    {UINT64_C(0x906A617D450187E2), UINT64_C(0x27FB2B80668B24C5)},
+    {UINT64_C(0xB484F9DC9641E9DA), UINT64_C(0xB1F9F660802DEDF6)},
+    {UINT64_C(0xE1A63853BBD26451), UINT64_C(0x5E7873F8A0396973)},
+    {UINT64_C(0x8D07E33455637EB2), UINT64_C(0xDB0B487B6423E1E8)},
+    {UINT64_C(0xB049DC016ABC5E5F), UINT64_C(0x91CE1A9A3D2CDA62)},
+    {UINT64_C(0xDC5C5301C56B75F7), UINT64_C(0x7641A140CC7810FB)},
+    {UINT64_C(0x89B9B3E11B6329BA), UINT64_C(0xA9E904C87FCB0A9D)},
+    {UINT64_C(0xAC2820D9623BF429), UINT64_C(0x546345FA9FBDCD44)},
+    {UINT64_C(0xD732290FBACAF133), UINT64_C(0xA97C177947AD4095)},
+    {UINT64_C(0x867F59A9D4BED6C0), UINT64_C(0x49ED8EABCCCC485D)},
+    {UINT64_C(0xA81F301449EE8C70), UINT64_C(0x5C68F256BFFF5A74)},
+    {UINT64_C(0xD226FC195C6A2F8C), UINT64_C(0x73832EEC6FFF3111)},
+    {UINT64_C(0x83585D8FD9C25DB7), UINT64_C(0xC831FD53C5FF7EAB)},
+    {UINT64_C(0xA42E74F3D032F525), UINT64_C(0xBA3E7CA8B77F5E55)},
+    {UINT64_C(0xCD3A1230C43FB26F), UINT64_C(0x28CE1BD2E55F35EB)},
+    {UINT64_C(0x80444B5E7AA7CF85), UINT64_C(0x7980D163CF5B81B3)},
+    {UINT64_C(0xA0555E361951C366), UINT64_C(0xD7E105BCC332621F)},
+    {UINT64_C(0xC86AB5C39FA63440), UINT64_C(0x8DD9472BF3FEFAA7)},
+    {UINT64_C(0xFA856334878FC150), UINT64_C(0xB14F98F6F0FEB951)},
+    {UINT64_C(0x9C935E00D4B9D8D2), UINT64_C(0x6ED1BF9A569F33D3)},
+    {UINT64_C(0xC3B8358109E84F07), UINT64_C(0x0A862F80EC4700C8)},
+    {UINT64_C(0xF4A642E14C6262C8), UINT64_C(0xCD27BB612758C0FA)},
+    {UINT64_C(0x98E7E9CCCFBD7DBD), UINT64_C(0x8038D51CB897789C)},
+    {UINT64_C(0xBF21E44003ACDD2C), UINT64_C(0xE0470A63E6BD56C3)},
+    {UINT64_C(0xEEEA5D5004981478), UINT64_C(0x1858CCFCE06CAC74)},
+    {UINT64_C(0x95527A5202DF0CCB), UINT64_C(0x0F37801E0C43EBC8)},
+    {UINT64_C(0xBAA718E68396CFFD), UINT64_C(0xD30560258F54E6BA)},
+    {UINT64_C(0xE950DF20247C83FD), UINT64_C(0x47C6B82EF32A2069)},
+    {UINT64_C(0x91D28B7416CDD27E), UINT64_C(0x4CDC331D57FA5441)},
+    {UINT64_C(0xB6472E511C81471D), UINT64_C(0xE0133FE4ADF8E952)},
+    {UINT64_C(0xE3D8F9E563A198E5), UINT64_C(0x58180FDDD97723A6)},
+    {UINT64_C(0x8E679C2F5E44FF8F), UINT64_C(0x570F09EAA7EA7648)},
+};
+
+// Accumulates the digits starting at first into value, ignoring overflow, and
+// returns a pointer to the first character that is not a digit.
+inline const char *scan_digits(const char *first, const char *last,
+                               uint64_t &value) noexcept {
+  uint64_t res = value;
+  while (last - first >= 8) {
+    const uint64_t chunk = load_8_chars(first);
+    if (!is_8_digits(chunk)) {
+      break;
+    }
+    res = res * 100000000 + parse_8_digits(chunk);
+    first += 8;
+  }
+  while (first != last && uint8_t(*first - '0') <= 9) {
+    res = res * 10 + uint8_t(*first - '0');
+    ++first;
+  }
+  value = res;
+  return first;
+}
+
+// Binary significand without the implicit bit and biased binary exponent.
+struct adjusted_mantissa {
+  uint64_t mantissa;
+  int power2;
+  bool operator==(const adjusted_mantissa &o) const noexcept {
+    return mantissa == o.mantissa && power2 == o.power2;
+  }
+  bool operator!=(const adjusted_mantissa &o) const noexcept {
+    return !(*this == o);
+  }
+};
+
+template <typename T> struct parse_traits;
+
+template <> struct parse_traits<float> {
+  static constexpr int min_exponent_fast_path = -10;
+  static constexpr int max_exponent_fast_path = 10;
+  static constexpr uint64_t max_mantissa_fast_path = UINT64_C(1) << 24;
+  static constexpr int min_exponent_round_to_even = -17;
+  static constexpr int max_exponent_round_to_even = 10;
+  static constexpr int smallest_power_of_ten = -64;
+  static constexpr int largest_power_of_ten = 38;
+};
+
+template <> struct parse_traits<double> {
+  static constexpr int min_exponent_fast_path = -22;
+  static constexpr int max_exponent_fast_path = 22;
+  static constexpr uint64_t max_mantissa_fast_path = UINT64_C(1) << 53;
+  static constexpr int min_exponent_round_to_even = -4;
+  static constexpr int max_exponent_round_to_even = 23;
+  static constexpr int smallest_power_of_ten = -342;
+  static constexpr int largest_power_of_ten = 308;
+};
+
+// Computes the correctly rounded binary value of w * 10^q using the
+// Eisel-Lemire algorithm. The result is exact for all w and q, but w must be
+// the complete decimal significand.
+template <typename T>
+inline adjusted_mantissa compute_float(int64_t q, uint64_t w) noexcept {
+  using traits = float_traits<T>;
+  using ptraits = parse_traits<T>;
+  constexpr int mantissa_bits = traits::significand_bits;
+  constexpr int infinite_power = (1 << traits::exponent_bits) - 1;
+  constexpr int minimum_exponent = -(1 << (traits::exponent_bits - 1)) + 1;
+
+  if (w == 0 || q < ptraits::smallest_power_of_ten) {
+    return {0, 0};
+  }
+  if (q > ptraits::largest_power_of_ten) {
+    return {0, infinite_power};
+  }
+
+  const int lz = __builtin_clzll(w);
+  w <<= lz;
+
+  // Compute enough of w * 5^q to determine the significand and rounding
+  const auto &g = pow5_128[q - pow5_128_min];
+  constexpr uint64_t precision_mask = ~uint64_t(0) >> (mantissa_bits + 3);
+  uint128_t product = uint128_t(w) * g[0];
+  if ((uint64_t(product >> 64) & precision_mask) == precision_mask) {
+    product += (uint128_t(w) * g[1]) >> 64;
+  }
+  const uint64_t hi = uint64_t(product >> 64);
+  const uint64_t lo = uint64_t(product);
+
+  const int upperbit = int(hi >> 63);
+  const int shift = upperbit + 64 - mantissa_bits - 3;
+  uint64_t mantissa = hi >> shift;
+  int power2 = int((((152170 + 65536) * q) >> 16) + 63) + upperbit - lz -
+               minimum_exponent;
+
+  if (power2 <= 0) {
+    // Subnormal
+    if (-power2 + 1 >= 64) {
+      return {0, 0};
+    }
+    mantissa >>= -power2 + 1;
+    mantissa += mantissa & 1;
+    mantissa >>= 1;
+    power2 = mantissa < (uint64_t(1) << mantissa_bits) ? 0 : 1;
+    return {mantissa, power2};
+  }
+
+  // Exactly halfway between two floating point values, round to even
+  if (lo <= 1 && q >= ptraits::min_exponent_round_to_even &&
+      q <= ptraits::max_exponent_round_to_even && (mantissa & 3) == 1 &&
+      (mantissa << shift) == hi) {
+    mantissa &= ~uint64_t(1);
+  }
+
+  mantissa += mantissa & 1;
+  mantissa >>= 1;
+  if (mantissa >= (uint64_t(2) << mantissa_bits)) {
+    mantissa = uint64_t(1) << mantissa_bits;
+    ++power2;
+  }
+  mantissa &= ~(uint64_t(1) << mantissa_bits);
+  if (power2 >= infinite_power) {
+    return {0, infinite_power};
+  }
+  return {mantissa, power2};
+}
+
+// Fixed capacity unsigned big integer used to resolve ambiguous rounding.
+struct bigint {
+  static constexpr int max_limbs = 80;
+  uint64_t limbs[max_limbs];
+  int size = 0;
+
+  void mul_add(uint64_t m, uint64_t a) noexcept {
+    for (int i = 0; i < size; ++i) {
+      const uint128_t x = uint128_t(limbs[i]) * m + a;
+      limbs[i] = uint64_t(x);
+      a = uint64_t(x >> 64);
+    }
+    if (a != 0) {
+      limbs[size++] = a;
+    }
+  }
+
+  void mul_pow5(int e) noexcept {
+    constexpr uint64_t pow5_27 = UINT64_C(7450580596923828125);
+    for (; e >= 27; e -= 27) {
+      mul_add(pow5_27, 0);
+    }
+    uint64_t m = 1;
+    for (; e > 0; --e) {
+      m *= 5;
+    }
+    mul_add(m, 0);
+  }
+
+  void shl(int n) noexcept {
+    if (size == 0) {
+      return;
+    }
+    const int limb_shift = n / 64;
+    const int bit_shift = n % 64;
+    if (bit_shift != 0) {
+      uint64_t carry = 0;
+      for (int i = 0; i < size; ++i) {
+        const uint64_t x = limbs[i];
+        limbs[i] = (x << bit_shift) | carry;
+        carry = x >> (64 - bit_shift);
+      }
+      if (carry != 0) {
+        limbs[size++] = carry;
+      }
+    }
+    if (limb_shift != 0) {
+      std::memmove(limbs + limb_shift, limbs, size * sizeof(uint64_t));
+      std::memset(limbs, 0, limb_shift * sizeof(uint64_t));
+      size += limb_shift;
+    }
+  }
+
+  int compare(const bigint &o) const noexcept {
+    if (size != o.size) {
+      return size < o.size ? -1 : 1;
+    }
+    for (int i = size - 1; i >= 0; --i) {
+      if (limbs[i] != o.limbs[i]) {
+        return limbs[i] < o.limbs[i] ? -1 : 1;
+      }
+    }
+    return 0;
+  }
+};
+
+// Decimal number split into its parts by parse_decimal.
+struct decimal_parts {
+  const char *int_first;
+  const char *int_last;
+  const char *frac_first;
+  const char *frac_last;
+  int64_t exponent;
+};
+
+// Chooses between am and the next larger floating point value by comparing
+// the exact decimal value against their midpoint. Digits beyond the first
+// max_digits only matter when the value would otherwise be exactly halfway.
+template <typename T>
+__attribute__((noinline, cold)) adjusted_mantissa
+digit_comp(adjusted_mantissa am, const decimal_parts &d) noexcept {
+  using traits = float_traits<T>;
+  constexpr int max_digits = 800;
+  constexpr int mantissa_bits = traits::significand_bits;
+
+  bigint lhs, rhs;
+  int digits = 0;
+  int64_t e10 = d.exponent + (d.int_last - d.int_first) +
+                (d.frac_last - d.frac_first);
+  bool sticky = false;
+  const auto add_digits = [&](const char *first, const char *last) {
+    for (; first != last; ++first) {
+      if (digits == max_digits) {
+        sticky |= *first != '0';
+        continue;
+      }
+      if (lhs.size == 0 && *first == '0') {
+        --e10;
+        continue;
+      }
+      lhs.mul_add(10, *first - '0');
+      ++digits;
+      --e10;
+    }
+  };
+  add_digits(d.int_first, d.int_last);
+  add_digits(d.frac_first, d.frac_last);
+
+  // value = lhs * 10^e10, midpoint = (2 * m + 1) * 2^(e2 - 1)
+  const uint64_t m = am.power2 == 0
+                         ? am.mantissa
+                         : am.mantissa | (uint64_t(1) << mantissa_bits);
+  const int e2 = (am.power2 == 0 ? 1 : am.power2) - traits::exponent_bias;
+  rhs.mul_add(1, 2 * m + 1);
+  int64_t pow2 = e2 - 1 - e10;
+  if (e10 >= 0) {
+    lhs.mul_pow5(int(e10));
+  } else {
+    rhs.mul_pow5(int(-e10));
+  }
+  if (pow2 >= 0) {
+    rhs.shl(int(pow2));
+  } else {
+    lhs.shl(int(-pow2));
+  }
+
+  int cmp = lhs.compare(rhs);
+  if (cmp == 0 && sticky) {
+    cmp = 1;
+  }
+  if (cmp > 0 || (cmp == 0 && (m & 1) != 0)) {
+    ++am.mantissa;
+    if (am.mantissa == (uint64_t(1) << mantissa_bits)) {
+      am.mantissa = 0;
+      ++am.power2;
+    }
+  }
+  return am;
+}
+
+// Case insensitive match of [first, last) against the lower case word.
+inline bool match_word(const char *first, const char *last,
+                       const char *word) noexcept {
+  for (; first != last; ++first, ++word) {
+    if (*word == 0 || (*first | 0x20) != *word) {
+      return false;
+    }
+  }
+  return *word == 0;
+}
+
+template <typename T>
+inline from_chars_result from_chars_float(const char *first, const char *last,
+                                          T &value) noexcept {
+  static_assert(std::is_floating_point<T>::value);
+  using traits = float_traits<T>;
+  using ptraits = parse_traits<T>;
+  using carrier = typename traits::carrier;
+
+  bool negative = false;
+  if (first != last && *first == '-') {
+    negative = true;
+    ++first;
+  }
+  if (__builtin_expect(first == last, 0)) {
+    return {first, std::errc::invalid_argument};
+  }
+
+  carrier bits;
+  const carrier sign = carrier(negative)
+                       << (traits::significand_bits + traits::exponent_bits);
+  if (__builtin_expect(uint8_t(*first - '0') > 9 && *first != '.', 0)) {
+    constexpr carrier exponent_mask =
+        ((carrier(1) << traits::exponent_bits) - 1) << traits::significand_bits;
+    if (match_word(first, last, "inf") ||
+        match_word(first, last, "infinity")) {
+      bits = sign | exponent_mask;
+    } else if (match_word(first, last, "nan")) {
+      bits = sign | exponent_mask |
+             (carrier(1) << (traits::significand_bits - 1));
+    } else {
+      return {first, std::errc::invalid_argument};
+    }
+    std::memcpy(&value, &bits, sizeof(value));
+    return {last, {}};
+  }
+
+  decimal_parts d;
+  uint64_t w = 0;
+  d.int_first = first;
+  const char *p = scan_digits(first, last, w);
+  d.int_last = p;
+  d.frac_first = d.frac_last = p;
+  if (p != last && *p == '.') {
+    d.frac_first = ++p;
+    p = scan_digits(p, last, w);
+    d.frac_last = p;
+  }
+  int64_t digit_count =
+      (d.int_last - d.int_first) + (d.frac_last - d.frac_first);
+  if (__builtin_expect(digit_count == 0, 0)) {
+    return {p, std::errc::invalid_argument};
+  }
+  d.exponent = d.frac_first - d.frac_last;
+
+  if (p != last && (*p | 0x20) == 'e') {
+    ++p;
+    bool negative_exponent = false;
+    if (p != last && (*p == '-' || *p == '+')) {
+      negative_exponent = *p == '-';
+      ++p;
+    }
+    if (__builtin_expect(p == last, 0)) {
+      return {p, std::errc::invalid_argument};
+    }
+    int64_t exp = 0;
+    for (; p != last && uint8_t(*p - '0') <= 9; ++p) {
+      if (exp < 0x10000000) {
+        exp = exp * 10 + (*p - '0');
+      }
+    }
+    d.exponent += negative_exponent ? -exp : exp;
+  }
+  if (__builtin_expect(p != last, 0)) {
+    return {p, std::errc::invalid_argument};
+  }
+
+  // More than 19 significant digits, keep the first 19 in w
+  int64_t q = d.exponent;
+  bool truncated = false;
+  if (digit_count > 19) {
+    for (const char *s = d.int_first;
+         s != d.frac_last && (*s == '0' || *s == '.'); ++s) {
+      digit_count -= *s == '0';
+    }
+    if (digit_count > 19) {
+      truncated = true;
+      constexpr uint64_t min_19_digits = UINT64_C(1000000000000000000);
+      w = 0;
+      const char *s = d.int_first;
+      for (; w < min_19_digits && s != d.int_last; ++s) {
+        w = w * 10 + uint8_t(*s - '0');
+      }
+      if (w >= min_19_digits) {
+        q = (d.int_last - s) + d.exponent + (d.frac_last - d.frac_first);
+      } else {
+        for (s = d.frac_first; w < min_19_digits && s != d.frac_last; ++s) {
+          w = w * 10 + uint8_t(*s - '0');
+        }
+        q = (d.frac_first - s) + d.exponent + (d.frac_last - d.frac_first);
+      }
+    }
+  }
+
+  if (!truncated && q >= ptraits::min_exponent_fast_path &&
+      q <= ptraits::max_exponent_fast_path &&
+      w <= ptraits::max_mantissa_fast_path) {
+    // Exact significand and power of ten, the result is correctly rounded
+    constexpr double powers[] = {1e0,  1e1,  1e2,  1e3,  1e4,  1e5,
+                                 1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+                                 1e12, 1e13, 1e14, 1e15, 1e16, 1e17,
+                                 1e18, 1e19, 1e20, 1e21, 1e22};
+    T res = T(w);
+    res = q < 0 ? res / T(powers[-q]) : res * T(powers[q]);
+    value = negative ? -res : res;
+    return {last, {}};
+  }
+
+  adjusted_mantissa am = compute_float<T>(q, w);
+  if (truncated && am != compute_float<T>(q, w + 1)) {
+    am = digit_comp<T>(am, d);
+  }
+  if (__builtin_expect(am.power2 == (1 << traits::exponent_bits) - 1, 0) ||
+      __builtin_expect(am.power2 == 0 && am.mantissa == 0 && w != 0, 0)) {
+    return {last, std::errc::result_out_of_range};
+  }
+  bits = sign | carrier(am.mantissa) |
+         (carrier(am.power2) << traits::significand_bits);
+  std::memcpy(&value, &bits, sizeof(value));
+  return {last, {}};
+}
+} // namespace detail
+
+constexpr inline to_chars_result to_chars(char *first, char *last,
+                                          uint32_t value) noexcept {
+  return detail::to_chars(first, last, value);
+}
+
+constexpr inline to_chars_result to_chars(char *first, char *last,
+                                          int32_t value) noexcept {
+  return detail::to_chars(first, last, value);
+}
+
+constexpr inline to_chars_result to_chars(char *first, char *last,
+                                          uint64_t value) noexcept {
+  return detail::to_chars(first, last, value);
+}
+
+constexpr inline to_chars_result to_chars(char *first, char *last,
+                                          int64_t value) noexcept {
+  return detail::to_chars(first, last, value);
+}
+
+__extension__ constexpr inline to_chars_result
+to_chars(char *first, char *last, unsigned __int128 value) noexcept {
+  return detail::to_chars(first, last, value);
+}
+
+__extension__ constexpr inline to_chars_result
+to_chars(char *first, char *last, __int128 value) noexcept {
+  return detail::to_chars(first, last, value);
+}
+
+// Digit writer policies for to_chars<Writer>. digit_pair_writer is the
+// default and uses a table of digit pairs and a table of powers of 10 to
+// find the length. multiply_shift_writer uses no tables and is faster when
+// the tables would miss the cache.
+using detail::digit_pair_writer;
+using detail::multiply_shift_writer;
+
+template <typename Writer>
+constexpr inline to_chars_result to_chars(char *first, char *last,
+                                          uint32_t value) noexcept {
+  return detail::to_chars<uint32_t, Writer>(first, last, value);
+}
+
+template <typename Writer>
+constexpr inline to_chars_result to_chars(char *first, char *last,
+                                          int32_t value) noexcept {
+  return detail::to_chars<int32_t, Writer>(first, last, value);
+}
+
+template <typename Writer>
+constexpr inline to_chars_result to_chars(char *first, char *last,
+                                          uint64_t value) noexcept {
+  return detail::to_chars<uint64_t, Writer>(first, last, value);
+}
+
+template <typename Writer>
+constexpr inline to_chars_result to_chars(char *first, char *last,
+                                          int64_t value) noexcept {
+  return detail::to_chars<int64_t, Writer>(first, last, value);
+}
+
+__extension__ template <typename Writer>
+constexpr inline to_chars_result to_chars(char *first, char *last,
+                                          unsigned __int128 value) noexcept {
+  return detail::to_chars<unsigned __int128, Writer>(first, last, value);
+}
+
+__extension__ template <typename Writer>
+constexpr inline to_chars_result to_chars(char *first, char *last,
+                                          __int128 value) noexcept {
+  return detail::to_chars<__int128, Writer>(first, last, value);
+}
+
+// Conversions for char16_t, char32_t, wchar_t and char8_t buffers.
+template <typename CharT, typename = detail::enable_if_code_unit_t<CharT>>
+inline basic_to_chars_result<CharT> to_chars(CharT *first, CharT *last,
+                                             int32_t value) noexcept {
+  return detail::to_chars_code_units(first, last, value);
+}
+
+template <typename CharT, typename = detail::enable_if_code_unit_t<CharT>>
+inline basic_to_chars_result<CharT> to_chars(CharT *first, CharT *last,
+                                             uint32_t value) noexcept {
+  return detail::to_chars_code_units(first, last, value);
+}
+
+template <typename CharT, typename = detail::enable_if_code_unit_t<CharT>>
+inline basic_to_chars_result<CharT> to_chars(CharT *first, CharT *last,
+                                             int64_t value) noexcept {
+  return detail::to_chars_code_units(first, last, value);
+}
+
+template <typename CharT, typename = detail::enable_if_code_unit_t<CharT>>
+inline basic_to_chars_result<CharT> to_chars(CharT *first, CharT *last,
+                                             uint64_t value) noexcept {
+  return detail::to_chars_code_units(first, last, value);
+}
+
+__extension__ template <typename CharT,
+                        typename = detail::enable_if_code_unit_t<CharT>>
+inline basic_to_chars_result<CharT>
+to_chars(CharT *first, CharT *last, unsigned __int128 value) noexcept {
+  return detail::to_chars_code_units(first, last, value);
+}
+
+__extension__ template <typename CharT,
+                        typename = detail::enable_if_code_unit_t<CharT>>
+inline basic_to_chars_result<CharT>
+to_chars(CharT *first, CharT *last, __int128 value) noexcept {
+  return detail::to_chars_code_units(first, last, value);
+}
+
+constexpr inline char *to_chars_backward(char *last, uint32_t value) noexcept {
+  return detail::to_chars_backward(last, value);
+}
+
+constexpr inline char *to_chars_backward(char *last, int32_t value) noexcept {
+  return detail::to_chars_backward(last, value);
+}
+
+constexpr inline char *to_chars_backward(char *last, uint64_t value) noexcept {
+  return detail::to_chars_backward(last, value);
+}
+
+constexpr inline char *to_chars_backward(char *last, int64_t value) noexcept {
+  return detail::to_chars_backward(last, value);
+}
+
+__extension__ constexpr inline char *
+to_chars_backward(char *last, unsigned __int128 value) noexcept {
+  return detail::to_chars_backward(last, value);
+}
+
+__extension__ constexpr inline char *
+to_chars_backward(char *last, __int128 value) noexcept {
+  return detail::to_chars_backward(last, value);
+}
+
+inline to_chars_result to_chars(char *first, char *last, float value) noexcept {
+  return detail::to_chars_float(first, last, value);
+}
+
+inline to_chars_result to_chars(char *first, char *last,
+                                double value) noexcept {
+  return detail::to_chars_float(first, last, value);
+}
+
+// Writes value as exactly N zero padded digits starting at first. A negative
+// value is preceded by '-', so N + 1 characters are written and there must
+// be room for them. If value has more than N digits ec is
+// std::errc::value_too_large and the buffer holds its N least significant
+// digits.
+template <unsigned N>
+constexpr inline to_chars_result to_chars_fixed(char *first,
+                                                uint32_t value) noexcept {
+  return detail::to_chars_fixed<N>(first, value);
+}
+
+template <unsigned N>
+constexpr inline to_chars_result to_chars_fixed(char *first,
+                                                int32_t value) noexcept {
+  return detail::to_chars_fixed<N>(first, value);
+}
+
+template <unsigned N>
+constexpr inline to_chars_result to_chars_fixed(char *first,
+                                                uint64_t value) noexcept {
+  return detail::to_chars_fixed<N>(first, value);
+}
+
+template <unsigned N>
+constexpr inline to_chars_result to_chars_fixed(char *first,
+                                                int64_t value) noexcept {
+  return detail::to_chars_fixed<N>(first, value);
+}
+
+constexpr inline to_chars_result to_chars(char *first, char *last,
+                                          uint32_t value, int base) noexcept {
+  return detail::to_chars_base(first, last, value, base);
+}
+
+constexpr inline to_chars_result to_chars(char *first, char *last,
+                                          int32_t value, int base) noexcept {
+  return detail::to_chars_base(first, last, value, base);
+}
+
+constexpr inline to_chars_result to_chars(char *first, char *last,
+                                          uint64_t value, int base) noexcept {
+  return detail::to_chars_base(first, last, value, base);
+}
+
+constexpr inline to_chars_result to_chars(char *first, char *last,
+                                          int64_t value, int base) noexcept {
+  return detail::to_chars_base(first, last, value, base);
+}
+
+template <unsigned Scale>
+constexpr inline to_chars_result to_chars_decimal(char *first, char *last,
+                                                  uint32_t value) noexcept {
+  return detail::to_chars_decimal<Scale>(first, last, value);
+}
+
+template <unsigned Scale>
+constexpr inline to_chars_result to_chars_decimal(char *first, char *last,
+                                                  int32_t value) noexcept {
+  return detail::to_chars_decimal<Scale>(first, last, value);
+}
+
+template <unsigned Scale>
+constexpr inline to_chars_result to_chars_decimal(char *first, char *last,
+                                                  uint64_t value) noexcept {
+  return detail::to_chars_decimal<Scale>(first, last, value);
+}
+
+template <unsigned Scale>
+constexpr inline to_chars_result to_chars_decimal(char *first, char *last,
+                                                  int64_t value) noexcept {
+  return detail::to_chars_decimal<Scale>(first, last, value);
+}
+
+constexpr inline from_chars_result
+from_chars(const char *first, const char *last, uint32_t &value) noexcept {
+  return detail::from_chars(first, last, value);
+}
+
+constexpr inline from_chars_result
+from_chars(const char *first, const char *last, int32_t &value) noexcept {
+  return detail::from_chars(first, last, value);
+}
+
+constexpr inline from_chars_result
+from_chars(const char *first, const char *last, uint64_t &value) noexcept {
+  return detail::from_chars(first, last, value);
 }
 
 constexpr inline from_chars_result
 from_chars(const char *first, const char *last, int64_t &value) noexcept {
   return detail::from_chars(first, last, value);
 }
-} // namespace rigtorp
\ No newline at end of file
+
+__extension__ constexpr inline from_chars_result
+from_chars(const char *first, const char *last,
+           unsigned __int128 &value) noexcept {
+  return detail::from_chars(first, last, value);
+}
+
+__extension__ constexpr inline from_chars_result
+from_chars(const char *first, const char *last, __int128 &value) noexcept {
+  return detail::from_chars(first, last, value);
+}
+
+template <typename CharT, typename = detail::enable_if_code_unit_t<CharT>>
+constexpr inline basic_from_chars_result<CharT>
+from_chars(const CharT *first, const CharT *last, int32_t &value) noexcept {
+  return detail::from_chars(first, last, value);
+}
+
+template <typename CharT, typename = detail::enable_if_code_unit_t<CharT>>
+constexpr inline basic_from_chars_result<CharT>
+from_chars(const CharT *first, const CharT *last, uint32_t &value) noexcept {
+  return detail::from_chars(first, last, value);
+}
+
+template <typename CharT, typename = detail::enable_if_code_unit_t<CharT>>
+constexpr inline basic_from_chars_result<CharT>
+from_chars(const CharT *first, const CharT *last, int64_t &value) noexcept {
+  return detail::from_chars(first, last, value);
+}
+
+template <typename CharT, typename = detail::enable_if_code_unit_t<CharT>>
+constexpr inline basic_from_chars_result<CharT>
+from_chars(const CharT *first, const CharT *last, uint64_t &value) noexcept {
+  return detail::from_chars(first, last, value);
+}
+
+__extension__ template <typename CharT,
+                        typename = detail::enable_if_code_unit_t<CharT>>
+constexpr inline basic_from_chars_result<CharT>
+from_chars(const CharT *first, const CharT *last,
+           unsigned __int128 &value) noexcept {
+  return detail::from_chars(first, last, value);
+}
+
+__extension__ template <typename CharT,
+                        typename = detail::enable_if_code_unit_t<CharT>>
+constexpr inline basic_from_chars_result<CharT>
+from_chars(const CharT *first, const CharT *last, __int128 &value) noexcept {
+  return detail::from_chars(first, last, value);
+}
+
+template <unsigned Options = 0>
+constexpr inline from_chars_result from_chars_prefix(const char *first,
+                                                     const char *last,
+                                                     uint32_t &value) noexcept {
+  return detail::from_chars_prefix<Options>(first, last, value);
+}
+
+template <unsigned Options = 0>
+constexpr inline from_chars_result from_chars_prefix(const char *first,
+                                                     const char *last,
+                                                     int32_t &value) noexcept {
+  return detail::from_chars_prefix<Options>(first, last, value);
+}
+
+template <unsigned Options = 0>
+constexpr inline from_chars_result from_chars_prefix(const char *first,
+                                                     const char *last,
+                                                     uint64_t &value) noexcept {
+  return detail::from_chars_prefix<Options>(first, last, value);
+}
+
+template <unsigned Options = 0>
+constexpr inline from_chars_result from_chars_prefix(const char *first,
+                                                     const char *last,
+                                                     int64_t &value) noexcept {
+  return detail::from_chars_prefix<Options>(first, last, value);
+}
+
+__extension__ template <unsigned Options = 0>
+constexpr inline from_chars_result
+from_chars_prefix(const char *first, const char *last,
+                  unsigned __int128 &value) noexcept {
+  return detail::from_chars_prefix<Options>(first, last, value);
+}
+
+__extension__ template <unsigned Options = 0>
+constexpr inline from_chars_result
+from_chars_prefix(const char *first, const char *last,
+                  __int128 &value) noexcept {
+  return detail::from_chars_prefix<Options>(first, last, value);
+}
+
+inline from_chars_result from_chars(const char *first, const char *last,
+                                    float &value) noexcept {
+  return detail::from_chars_float(first, last, value);
+}
+
+inline from_chars_result from_chars(const char *first, const char *last,
+                                    double &value) noexcept {
+  return detail::from_chars_float(first, last, value);
+}
+
+constexpr inline from_chars_result from_chars(const char *first,
+                                              const char *last, uint32_t &value,
+                                              int base) noexcept {
+  return detail::from_chars_base(first, last, value, base);
+}
+
+constexpr inline from_chars_result from_chars(const char *first,
+                                              const char *last, int32_t &value,
+                                              int base) noexcept {
+  return detail::from_chars_base(first, last, value, base);
+}
+
+constexpr inline from_chars_result from_chars(const char *first,
+                                              const char *last, uint64_t &value,
+                                              int base) noexcept {
+  return detail::from_chars_base(first, last, value, base);
+}
+
+constexpr inline from_chars_result from_chars(const char *first,
+                                              const char *last, int64_t &value,
+                                              int base) noexcept {
+  return detail::from_chars_base(first, last, value, base);
+}
+
+template <unsigned Scale, typename Rounding = round_toward_zero>
+constexpr inline from_chars_result
+from_chars_decimal(const char *first, const char *last,
+                   uint32_t &value) noexcept {
+  return detail::from_chars_decimal<Scale, Rounding>(first, last, value);
+}
+
+template <unsigned Scale, typename Rounding = round_toward_zero>
+constexpr inline from_chars_result
+from_chars_decimal(const char *first, const char *last,
+                   int32_t &value) noexcept {
+  return detail::from_chars_decimal<Scale, Rounding>(first, last, value);
+}
+
+template <unsigned Scale, typename Rounding = round_toward_zero>
+constexpr inline from_chars_result
+from_chars_decimal(const char *first, const char *last,
+                   uint64_t &value) noexcept {
+  return detail::from_chars_decimal<Scale, Rounding>(first, last, value);
+}
+
+template <unsigned Scale, typename Rounding = round_toward_zero>
+constexpr inline from_chars_result
+from_chars_decimal(const char *first, const char *last,
+                   int64_t &value) noexcept {
+  return detail::from_chars_decimal<Scale, Rounding>(first, last, value);
+}
+
+template <unsigned N>
+constexpr inline from_chars_result from_chars_fixed(const char *first,
+                                                    uint32_t &value) noexcept {
+  return detail::from_chars_fixed<N>(first, value);
+}
+
+template <unsigned N>
+constexpr inline from_chars_result from_chars_fixed(const char *first,
+                                                    int32_t &value) noexcept {
+  return detail::from_chars_fixed<N>(first, value);
+}
+
+template <unsigned N>
+constexpr inline from_chars_result from_chars_fixed(const char *first,
+                                                    uint64_t &value) noexcept {
+  return detail::from_chars_fixed<N>(first, value);
+}
+
+template <unsigned N>
+constexpr inline from_chars_result from_chars_fixed(const char *first,
+                                                    int64_t &value) noexcept {
+  return detail::from_chars_fixed<N>(first, value);
+}
+
+constexpr inline to_chars_result
+to_chars_timestamp(char *first, char *last, int64_t value) noexcept {
+  return detail::to_chars_timestamp(first, last, value);
+}
+
+inline from_chars_result from_chars_timestamp(const char *first,
+                                              const char *last,
+                                              int64_t &value) noexcept {
+  return detail::from_chars_timestamp(first, last, value);
+}
+
+inline to_chars_result to_chars_many(char *first, char *last,
+                                     const uint32_t *values_first,
+                                     const uint32_t *values_last,
+                                     char delimiter,
+                                     size_t *offsets = nullptr) noexcept {
+  return detail::to_chars_many(first, last, values_first, values_last,
+                               delimiter, offsets);
+}
+
+inline to_chars_result to_chars_many(char *first, char *last,
+                                     const int32_t *values_first,
+                                     const int32_t *values_last, char delimiter,
+                                     size_t *offsets = nullptr) noexcept {
+  return detail::to_chars_many(first, last, values_first, values_last,
+                               delimiter, offsets);
+}
+
+inline to_chars_result to_chars_many(char *first, char *last,
+                                     const uint64_t *values_first,
+                                     const uint64_t *values_last,
+                                     char delimiter,
+                                     size_t *offsets = nullptr) noexcept {
+  return detail::to_chars_many(first, last, values_first, values_last,
+                               delimiter, offsets);
+}
+
+inline to_chars_result to_chars_many(char *first, char *last,
+                                     const int64_t *values_first,
+                                     const int64_t *values_last, char delimiter,
+                                     size_t *offsets = nullptr) noexcept {
+  return detail::to_chars_many(first, last, values_first, values_last,
+                               delimiter, offsets);
+}
+
+// Parses the numbers in [first, last) separated by one or more delimiters
+// (',', ' ', '\t', '\r' or '\n') into [values_first, values_last). Empty
+// fields are skipped, so "1,,2" yields 1 and 2. On error ptr points to the
+// offending character.
+inline from_chars_many_result from_chars_many(const char *first,
+                                              const char *last,
+                                              uint32_t *values_first,
+                                              uint32_t *values_last) noexcept {
+  return detail::from_chars_many(first, last, values_first, values_last);
+}
+
+inline from_chars_many_result from_chars_many(const char *first,
+                                              const char *last,
+                                              int32_t *values_first,
+                                              int32_t *values_last) noexcept {
+  return detail::from_chars_many(first, last, values_first, values_last);
+}
+
+inline from_chars_many_result from_chars_many(const char *first,
+                                              const char *last,
+                                              uint64_t *values_first,
+                                              uint64_t *values_last) noexcept {
+  return detail::from_chars_many(first, last, values_first, values_last);
+}
+
+inline from_chars_many_result from_chars_many(const char *first,
+                                              const char *last,
+                                              int64_t *values_first,
+                                              int64_t *values_last) noexcept {
+  return detail::from_chars_many(first, last, values_first, values_last);
+}
+
+// Parses delimiter separated integers from input that arrives in chunks. A
+// number split across chunks is carried over in the parser state (sign,
+// accumulated value and digit count) instead of being copied, so chunks can
+// be fed directly from read buffers or a memory mapped file.
+// Complete numbers within a chunk are parsed by Parser, see
+// detail::from_chars_many_parser.
+template <typename T, typename Parser = detail::from_chars_many_parser>
+class from_chars_stream {
+  static_assert(detail::is_integral<T>::value);
+
+public:
+  // Parses the chunk [first, last) like from_chars_many. A number at the end
+  // of the chunk is held back until a delimiter, or finish, completes it. If
+  // the output is full ptr points past the last number parsed and the rest
+  // of the chunk should be fed again. After an error the parser must be
+  // reset before it is used again.
+  from_chars_many_result feed(const char *first, const char *last,
+                              T *values_first, T *values_last) noexcept {
+    T *out = values_first;
+    if (out == values_last) {
+      return {first, {}, 0};
+    }
+    if (pending()) {
+      const char *p = first;
+      while (p != last && !detail::is_delimiter(*p)) {
+        ++p;
+      }
+      auto res = accumulate(first, p);
+      if (res.ec == std::errc{} && p != last) {
+        res = complete(p, *out++);
+      }
+      if (__builtin_expect(res.ec != std::errc{}, 0)) {
+        return {res.ptr, res.ec, 0};
+      }
+      if (p == last || out == values_last) {
+        return {p, {}, size_t(out - values_first)};
+      }
+      first = p;
+    }
+    const char *tail = last;
+    while (tail != first && !detail::is_delimiter(tail[-1])) {
+      --tail;
+    }
+    const auto res = Parser::parse(first, tail, out, values_last);
+    out += res.count;
+    if (res.ec != std::errc{} || res.ptr != tail) {
+      return {res.ptr, res.ec, size_t(out - values_first)};
+    }
+    if (tail != last) {
+      const auto r = accumulate(tail, last);
+      if (__builtin_expect(r.ec != std::errc{}, 0)) {
+        return {r.ptr, r.ec, size_t(out - values_first)};
+      }
+    }
+    return {last, {}, size_t(out - values_first)};
+  }
+
+  // Parses the chunk [first, last) and calls f(value) for each completed
+  // number.
+  template <typename F>
+  from_chars_result feed(const char *first, const char *last,
+                         F &&f) noexcept(noexcept(f(std::declval<T>()))) {
+    T values[64];
+    for (;;) {
+      const auto res = feed(first, last, values, values + 64);
+      for (size_t i = 0; i < res.count; ++i) {
+        f(values[i]);
+      }
+      if (res.ec != std::errc{} || res.ptr == last) {
+        return {res.ptr, res.ec};
+      }
+      first = res.ptr;
+    }
+  }
+
+  // Completes the number at the end of the input, if any, and stores it in
+  // values_first. On error ptr is nullptr since the number ended with the
+  // input.
+  from_chars_many_result finish(T *values_first, T *values_last) noexcept {
+    if (!pending() || values_first == values_last) {
+      return {nullptr, {}, 0};
+    }
+    const auto res = complete(nullptr, *values_first);
+    return {nullptr, res.ec, res.ec == std::errc{} ? 1u : 0u};
+  }
+
+  // Completes the number at the end of the input, if any, and calls f(value)
+  // with it.
+  template <typename F>
+  from_chars_result finish(F &&f) noexcept(noexcept(f(std::declval<T>()))) {
+    T value = 0;
+    const auto res = finish(&value, &value + 1);
+    if (res.count != 0) {
+      f(value);
+    }
+    return {res.ptr, res.ec};
+  }
+
+  // Returns true if a number is held back waiting for more input.
+  constexpr bool pending() const noexcept { return negative_ || digits_ != 0; }
+
+  constexpr void reset() noexcept {
+    value_ = 0;
+    digits_ = 0;
+    negative_ = false;
+  }
+
+private:
+  // Accumulates the characters [first, last) of the current number.
+  from_chars_result accumulate(const char *first, const char *last) noexcept {
+    if constexpr (detail::is_signed<T>::value) {
+      if (!pending() && first != last && *first == '-') {
+        negative_ = true;
+        ++first;
+      }
+    }
+    const auto res = detail::swar_digit_parser::parse(first, last, value_);
+    digits_ += last - first;
+    return res;
+  }
+
+  // Completes the current number ending at last and stores it in value.
+  from_chars_result complete(const char *last, T &value) noexcept {
+    if (__builtin_expect(digits_ == 0, 0)) {
+      return {last, std::errc::invalid_argument};
+    }
+    if constexpr (detail::is_signed<T>::value) {
+      T tmp = 0;
+      if (__builtin_expect(
+              __builtin_mul_overflow(value_, negative_ ? -1 : 1, &tmp), 0)) {
+        return {last, std::errc::result_out_of_range};
+      }
+      value = tmp;
+    } else {
+      value = value_;
+    }
+    reset();
+    return {last, {}};
+  }
+
+  detail::make_unsigned_t<T> value_ = 0;
+  size_t digits_ = 0;
+  bool negative_ = false;
+};
+} // namespace RIGTORP_CHARCONV_ISA_NAMESPACE
+} // namespace rigtorp
@@ -0,0 +1,588 @@
+/*
+Copyright (c) 2018 Erik Rigtorp <erik@rigtorp.se>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+ */
+
+
+#pragma once
+
+#include <rigtorp/CharConv.h>
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace rigtorp {
+
+inline namespace RIGTORP_CHARCONV_ISA_NAMESPACE {
+
+namespace detail {
+
+// Arbitrary-precision unsigned integers are little-endian arrays of 64-bit
+// limbs. Sizes passed with a limb pointer exclude leading zero limbs unless
+// noted otherwise.
+
+// Products where both operands have at least this many limbs use
+// Karatsuba multiplication.
+static constexpr size_t bigint_karatsuba_threshold = 32;
+
+// Values with more limbs than these are converted by divide-and-conquer,
+// smaller values 19 digits at a time. Parsing 19 digits costs a
+// multiply-add per limb instead of a division, so it switches later. The
+// to_chars threshold must be at least 2.
+static constexpr size_t bigint_to_chars_dc_threshold = 24;
+static constexpr size_t bigint_from_chars_dc_threshold = 64;
+
+inline size_t bigint_size(const uint64_t *a, size_t n) noexcept {
+  while (n != 0 && a[n - 1] == 0) {
+    --n;
+  }
+  return n;
+}
+
+inline int bigint_compare(const uint64_t *a, size_t na, const uint64_t *b,
+                          size_t nb) noexcept {
+  if (na != nb) {
+    return na < nb ? -1 : 1;
+  }
+  while (na-- != 0) {
+    if (a[na] != b[na]) {
+      return a[na] < b[na] ? -1 : 1;
+    }
+  }
+  return 0;
+}
+
+// r[0, na) = a[0, na) + b[0, nb) for na >= nb, returning the carry. r may
+// alias a.
+inline uint64_t bigint_add(uint64_t *r, const uint64_t *a, size_t na,
+                           const uint64_t *b, size_t nb) noexcept {
+  uint64_t carry = 0;
+  size_t i = 0;
+  for (; i < nb; ++i) {
+    uint64_t s;
+    const bool c1 = __builtin_add_overflow(a[i], b[i], &s);
+    const bool c2 = __builtin_add_overflow(s, carry, &r[i]);
+    carry = c1 | c2;
+  }
+  for (; i < na; ++i) {
+    carry = __builtin_add_overflow(a[i], carry, &r[i]);
+  }
+  return carry;
+}
+
+// r[0, na) = a[0, na) - b[0, nb) for na >= nb, returning the borrow. r may
+// alias a.
+inline uint64_t bigint_sub(uint64_t *r, const uint64_t *a, size_t na,
+                           const uint64_t *b, size_t nb) noexcept {
+  uint64_t borrow = 0;
+  size_t i = 0;
+  for (; i < nb; ++i) {
+    uint64_t d;
+    const bool b1 = __builtin_sub_overflow(a[i], b[i], &d);
+    const bool b2 = __builtin_sub_overflow(d, borrow, &r[i]);
+    borrow = b1 | b2;
+  }
+  for (; i < na; ++i) {
+    borrow = __builtin_sub_overflow(a[i], borrow, &r[i]);
+  }
+  return borrow;
+}
+
+inline void bigint_mul(uint64_t *r, const uint64_t *a, size_t na,
+                       const uint64_t *b, size_t nb);
+
+// r[0, 2n) = a[0, n) * b[0, n) using three half size products.
+inline void bigint_mul_karatsuba(uint64_t *r, const uint64_t *a,
+                                 const uint64_t *b, size_t n) {
+  const size_t h = n / 2;
+  const size_t n1 = n - h;
+  bigint_mul(r, a, h, b, h);
+  bigint_mul(r + 2 * h, a + h, n1, b + h, n1);
+  std::vector<uint64_t> t(4 * n1 + 4);
+  uint64_t *sa = t.data();
+  uint64_t *sb = sa + n1 + 1;
+  uint64_t *z1 = sb + n1 + 1;
+  sa[n1] = bigint_add(sa, a + h, n1, a, h);
+  sb[n1] = bigint_add(sb, b + h, n1, b, h);
+  bigint_mul(z1, sa, n1 + 1, sb, n1 + 1);
+  bigint_sub(z1, z1, 2 * n1 + 2, r, 2 * h);
+  bigint_sub(z1, z1, 2 * n1 + 2, r + 2 * h, 2 * n1);
+  bigint_add(r + h, r + h, 2 * n - h, z1, bigint_size(z1, 2 * n1 + 2));
+}
+
+// r[0, na + nb) = a[0, na) * b[0, nb), with leading zero limbs. r must not
+// alias a or b.
+inline void bigint_mul(uint64_t *r, const uint64_t *a, size_t na,
+                       const uint64_t *b, size_t nb) {
+  if (na < nb) {
+    std::swap(a, b);
+    std::swap(na, nb);
+  }
+  if (nb == 0) {
+    std::fill(r, r + na, 0);
+  } else if (nb < bigint_karatsuba_threshold) {
+    // Each column of the product is summed in a 192-bit accumulator,
+    // which avoids loading and storing r for every limb product.
+    uint128_t acc = 0;
+    for (size_t k = 0; k < na + nb - 1; ++k) {
+      const size_t lo_i = k < nb ? 0 : k - nb + 1;
+      const size_t hi_i = std::min(k, na - 1);
+      uint64_t hi = 0;
+      for (size_t i = lo_i; i <= hi_i; ++i) {
+        const uint128_t p = uint128_t(a[i]) * b[k - i];
+        acc += p;
+        hi += acc < p;
+      }
+      r[k] = static_cast<uint64_t>(acc);
+      acc = (acc >> 64) | (uint128_t(hi) << 64);
+    }
+    r[na + nb - 1] = static_cast<uint64_t>(acc);
+  } else if (na == nb) {
+    bigint_mul_karatsuba(r, a, b, na);
+  } else {
+    // The longer operand is multiplied in pieces of nb limbs.
+    std::fill(r, r + na + nb, 0);
+    std::vector<uint64_t> t(2 * nb);
+    for (size_t i = 0; i < na; i += nb) {
+      const size_t n = std::min(nb, na - i);
+      bigint_mul(t.data(), a + i, n, b, nb);
+      bigint_add(r + i, r + i, na + nb - i, t.data(), n + nb);
+    }
+  }
+}
+
+// q[0, nu - nv + 1) = u[0, nu) / v[0, nv) for nu >= nv using Knuth's
+// algorithm D. It is quadratic and only used for the reciprocals of the
+// small powers.
+inline void bigint_div(uint64_t *q, const uint64_t *u, size_t nu,
+                       const uint64_t *v, size_t nv) {
+  if (nv == 1) {
+    uint64_t rem = 0;
+    for (size_t i = nu; i-- != 0;) {
+      const uint128_t t = (uint128_t(rem) << 64) | u[i];
+      q[i] = static_cast<uint64_t>(t / v[0]);
+      rem = static_cast<uint64_t>(t % v[0]);
+    }
+    return;
+  }
+  // Normalize so that the top bit of the divisor is set.
+  const unsigned s = __builtin_clzll(v[nv - 1]);
+  const auto shl = [s](const uint64_t *p, size_t i) {
+    return s == 0 ? p[i]
+                  : (p[i] << s) | (i == 0 ? 0 : p[i - 1] >> (64 - s));
+  };
+  std::vector<uint64_t> vn(nv), un(nu + 1);
+  for (size_t i = 0; i < nv; ++i) {
+    vn[i] = shl(v, i);
+  }
+  for (size_t i = 0; i < nu; ++i) {
+    un[i] = shl(u, i);
+  }
+  un[nu] = s == 0 ? 0 : u[nu - 1] >> (64 - s);
+  for (size_t j = nu - nv + 1; j-- != 0;) {
+    const uint128_t num = (uint128_t(un[j + nv]) << 64) | un[j + nv - 1];
+    uint128_t qhat = num / vn[nv - 1];
+    uint128_t rhat = num % vn[nv - 1];
+    while ((qhat >> 64) != 0 ||
+           qhat * vn[nv - 2] > ((rhat << 64) | un[j + nv - 2])) {
+      --qhat;
+      rhat += vn[nv - 1];
+      if ((rhat >> 64) != 0) {
+        break;
+      }
+    }
+    uint64_t carry = 0;
+    uint64_t borrow = 0;
+    for (size_t i = 0; i < nv; ++i) {
+      const uint128_t p = qhat * vn[i] + carry;
+      carry = static_cast<uint64_t>(p >> 64);
+      uint64_t d;
+      const bool b1 =
+          __builtin_sub_overflow(un[i + j], static_cast<uint64_t>(p), &d);
+      const bool b2 = __builtin_sub_overflow(d, borrow, &un[i + j]);
+      borrow = b1 | b2;
+    }
+    const uint128_t top = uint128_t(carry) + borrow;
+    const bool negative = un[j + nv] < top;
+    un[j + nv] -= static_cast<uint64_t>(top);
+    if (negative) {
+      --qhat;
+      un[j + nv] += bigint_add(&un[j], &un[j], nv, vn.data(), nv);
+    }
+    q[j] = static_cast<uint64_t>(qhat);
+  }
+}
+
+// 10^(19 * 2^k) and its Barrett reciprocal floor(2^(128 m) / 10^(19 * 2^k)),
+// where m is the number of limbs of the power.
+struct bigint_power {
+  std::vector<uint64_t> value;
+  std::vector<uint64_t> inverse;
+};
+
+// Powers with fewer limbs than this get their reciprocal by long division.
+static constexpr size_t bigint_newton_threshold = 32;
+
+// Returns floor(2^(128 m) / v) for the m limb power v = prev.value^2. The
+// square of the reciprocal of prev has about half the precision and is
+// never too large. One Newton step x + x (2^(128 m) - v x) / 2^(128 m)
+// doubles the precision and stays at or below the reciprocal, which is
+// then reached by incrementing x a few times.
+inline std::vector<uint64_t>
+bigint_power_inverse(const std::vector<uint64_t> &v, const bigint_power &prev) {
+  const size_t m = v.size();
+  const auto &pi = prev.inverse;
+  std::vector<uint64_t> x(2 * pi.size());
+  bigint_mul(x.data(), pi.data(), pi.size(), pi.data(), pi.size());
+  x.erase(x.begin(), x.begin() + (4 * prev.value.size() - 2 * m));
+  x.resize(bigint_size(x.data(), x.size()));
+  // Sets e = 2^(128 m) - v x.
+  std::vector<uint64_t> t, e;
+  const auto residual = [&] {
+    t.resize(m + x.size());
+    bigint_mul(t.data(), v.data(), m, x.data(), x.size());
+    e.assign(2 * m + 1, 0);
+    e[2 * m] = 1;
+    bigint_sub(e.data(), e.data(), e.size(), t.data(),
+               bigint_size(t.data(), t.size()));
+    e.resize(bigint_size(e.data(), e.size()));
+  };
+  residual();
+  t.resize(x.size() + e.size());
+  bigint_mul(t.data(), x.data(), x.size(), e.data(), e.size());
+  if (t.size() > 2 * m) {
+    x.push_back(0);
+    bigint_add(x.data(), x.data(), x.size(), t.data() + 2 * m,
+               bigint_size(t.data() + 2 * m, t.size() - 2 * m));
+    x.resize(bigint_size(x.data(), x.size()));
+  }
+  residual();
+  const uint64_t one = 1;
+  while (bigint_compare(e.data(), e.size(), v.data(), m) >= 0) {
+    bigint_sub(e.data(), e.data(), e.size(), v.data(), m);
+    e.resize(bigint_size(e.data(), e.size()));
+    x.push_back(0);
+    bigint_add(x.data(), x.data(), x.size(), &one, 1);
+    x.resize(bigint_size(x.data(), x.size()));
+  }
+  return x;
+}
+
+// Returns the powers for k in [0, n). Each power is the square of the
+// previous one. They are computed on first use and shared by all threads
+// for the lifetime of the program. Entries never move once added.
+inline std::vector<const bigint_power *> bigint_powers(size_t n) {
+  static std::mutex mutex;
+  static std::vector<std::unique_ptr<bigint_power>> table;
+  std::lock_guard<std::mutex> lock(mutex);
+  while (table.size() < n) {
+    auto p = std::make_unique<bigint_power>();
+    if (table.empty()) {
+      p->value = {powers_of_10_64[19]};
+    } else {
+      const auto &prev = table.back()->value;
+      p->value.resize(2 * prev.size());
+      bigint_mul(p->value.data(), prev.data(), prev.size(), prev.data(),
+                 prev.size());
+      p->value.resize(bigint_size(p->value.data(), p->value.size()));
+    }
+    const size_t m = p->value.size();
+    if (m >= bigint_newton_threshold) {
+      p->inverse = bigint_power_inverse(p->value, *table.back());
+    } else {
+      std::vector<uint64_t> u(2 * m + 1);
+      u[2 * m] = 1;
+      p->inverse.resize(m + 2);
+      bigint_div(p->inverse.data(), u.data(), u.size(), p->value.data(), m);
+      p->inverse.resize(bigint_size(p->inverse.data(), p->inverse.size()));
+    }
+    table.push_back(std::move(p));
+  }
+  std::vector<const bigint_power *> res(n);
+  for (size_t i = 0; i < n; ++i) {
+    res[i] = table[i].get();
+  }
+  return res;
+}
+
+// Splits x[0, n) < p^2 into q = x / p and r = x % p with two products
+// using the reciprocal of p. The estimated quotient is at most 2 too small.
+inline void bigint_divmod(const uint64_t *x, size_t n, const bigint_power &p,
+                          std::vector<uint64_t> &q, std::vector<uint64_t> &r) {
+  const size_t m = p.value.size();
+  r.assign(x, x + n);
+  q.clear();
+  if (n < m) {
+    return;
+  }
+  const size_t n1 = n - (m - 1);
+  std::vector<uint64_t> t(n1 + p.inverse.size());
+  bigint_mul(t.data(), x + m - 1, n1, p.inverse.data(), p.inverse.size());
+  if (t.size() > m + 1) {
+    q.assign(t.begin() + m + 1, t.end());
+    q.resize(bigint_size(q.data(), q.size()));
+  }
+  if (!q.empty()) {
+    t.resize(q.size() + m);
+    bigint_mul(t.data(), q.data(), q.size(), p.value.data(), m);
+    bigint_sub(r.data(), r.data(), n, t.data(),
+               bigint_size(t.data(), t.size()));
+  }
+  r.resize(bigint_size(r.data(), n));
+  while (bigint_compare(r.data(), r.size(), p.value.data(), m) >= 0) {
+    bigint_sub(r.data(), r.data(), r.size(), p.value.data(), m);
+    r.resize(bigint_size(r.data(), r.size()));
+    const uint64_t one = 1;
+    q.push_back(0);
+    bigint_add(q.data(), q.data(), q.size(), &one, 1);
+    q.resize(bigint_size(q.data(), q.size()));
+  }
+}
+
+// Writes x[0, n), which is destroyed, at first and returns the end. Each
+// pass divides x by 10^19 and the 19 digit remainders are written with the
+// 64-bit digit writer. If width is not 0 exactly width digits are written,
+// padded with leading zeros; it must be a multiple of 19.
+inline char *bigint_write_chunked(char *first, uint64_t *x, size_t n,
+                                  size_t width) {
+  std::vector<uint64_t> chunks;
+  chunks.reserve(n + n / 63 + 1);
+  while (n != 0) {
+    uint64_t rem = 0;
+    for (size_t i = n; i-- != 0;) {
+      x[i] = static_cast<uint64_t>(
+          divmod_10_19((uint128_t(rem) << 64) | x[i], rem));
+    }
+    chunks.push_back(rem);
+    n = bigint_size(x, n);
+  }
+  size_t i = chunks.size();
+  if (width != 0) {
+    const size_t zeros = width - 19 * i;
+    std::memset(first, '0', zeros);
+    first += zeros;
+  } else if (i != 0) {
+    --i;
+    first = to_chars(first, first + 20, chunks[i]).ptr;
+  }
+  while (i-- != 0) {
+    write_fixed_digits<19>(first + 19, chunks[i]);
+    first += 19;
+  }
+  return first;
+}
+
+// Writes x[0, n) < 10^(19 * 2^(k + 1)) at first and returns the end. Above
+// the threshold x is split into the quotient and remainder of 10^(19 * 2^k),
+// which are written recursively, the remainder padded to 19 * 2^k digits.
+// If padded exactly 19 * 2^(k + 1) digits are written.
+inline char *bigint_write(char *first, const uint64_t *x, size_t n,
+                          const bigint_power *const *powers, size_t k,
+                          bool padded, size_t threshold) {
+  if (n <= threshold) {
+    std::vector<uint64_t> t(x, x + n);
+    return bigint_write_chunked(first, t.data(), n,
+                                padded ? size_t(38) << k : 0);
+  }
+  std::vector<uint64_t> q, r;
+  bigint_divmod(x, n, *powers[k], q, r);
+  if (padded || !q.empty()) {
+    first = bigint_write(first, q.data(), q.size(), powers, k - 1, padded,
+                         threshold);
+    padded = true;
+  }
+  return bigint_write(first, r.data(), r.size(), powers, k - 1, padded,
+                      threshold);
+}
+
+inline to_chars_result to_chars_bigint(char *first, char *last,
+                                       const uint64_t *x, size_t n,
+                                       size_t threshold =
+                                           bigint_to_chars_dc_threshold) {
+  n = bigint_size(x, n);
+  if (n == 0) {
+    if (__builtin_expect(first == last, 0)) {
+      return {last, std::errc::value_too_large};
+    }
+    *first = '0';
+    return {first + 1, {}};
+  }
+  // A limb holds less than 20 digits. If the buffer may be too small the
+  // digits are written to a temporary buffer first.
+  const size_t max_len = 20 * n;
+  std::string tmp;
+  char *p = first;
+  if (size_t(last - first) < max_len) {
+    tmp.resize(max_len);
+    p = &tmp[0];
+  }
+  char *end;
+  if (n <= threshold) {
+    std::vector<uint64_t> t(x, x + n);
+    end = bigint_write_chunked(p, t.data(), n, 0);
+  } else {
+    size_t k = 0;
+    auto powers = bigint_powers(2);
+    while (bigint_compare(x, n, powers[k + 1]->value.data(),
+                          powers[k + 1]->value.size()) >= 0) {
+      ++k;
+      powers = bigint_powers(k + 2);
+    }
+    end = bigint_write(p, x, n, powers.data(), k, false, threshold);
+  }
+  if (p != first) {
+    const size_t len = end - p;
+    if (size_t(last - first) < len) {
+      return {last, std::errc::value_too_large};
+    }
+    std::memcpy(first, p, len);
+    return {first + len, {}};
+  }
+  return {end, {}};
+}
+
+// Parses the digits in [first, last) into x, 19 digits at a time.
+inline void bigint_parse_chunked(const char *first, const char *last,
+                                 std::vector<uint64_t> &x) {
+  x.clear();
+  size_t len = size_t(last - first) % 19;
+  len = len == 0 ? 19 : len;
+  while (first != last) {
+    uint64_t carry = 0;
+    swar_digit_parser::parse(first, first + len, carry);
+    for (auto &limb : x) {
+      const uint128_t t = uint128_t(limb) * powers_of_10_64[len] + carry;
+      limb = static_cast<uint64_t>(t);
+      carry = static_cast<uint64_t>(t >> 64);
+    }
+    if (carry != 0) {
+      x.push_back(carry);
+    }
+    first += len;
+    len = 19;
+  }
+}
+
+// Parses the digits in [first, last) into x. Above the threshold the last
+// 19 * 2^k digits, for the largest such k less than the number of digits,
+// and the digits before them are parsed recursively and combined with one
+// multiplication by 10^(19 * 2^k).
+inline void bigint_parse(const char *first, const char *last,
+                         const bigint_power *const *powers,
+                         std::vector<uint64_t> &x, size_t threshold) {
+  const size_t len = last - first;
+  if ((len + 18) / 19 <= threshold) {
+    bigint_parse_chunked(first, last, x);
+    return;
+  }
+  size_t k = 0;
+  while ((size_t(38) << k) < len) {
+    ++k;
+  }
+  const char *mid = last - (size_t(19) << k);
+  std::vector<uint64_t> hi, lo;
+  bigint_parse(first, mid, powers, hi, threshold);
+  bigint_parse(mid, last, powers, lo, threshold);
+  const auto &p = powers[k]->value;
+  x.assign(hi.size() + p.size() + 1, 0);
+  if (!hi.empty()) {
+    bigint_mul(x.data(), hi.data(), hi.size(), p.data(), p.size());
+  }
+  bigint_add(x.data(), x.data(), x.size(), lo.data(), lo.size());
+  x.resize(bigint_size(x.data(), x.size()));
+}
+
+inline from_chars_result
+from_chars_bigint(const char *first, const char *last, uint64_t *x, size_t n,
+                  size_t threshold = bigint_from_chars_dc_threshold) {
+  if (__builtin_expect(first == last, 0)) {
+    return {first, std::errc::invalid_argument};
+  }
+  const char *p = first;
+  while (last - p >= 8 && is_8_digits(load_8_chars(p))) {
+    p += 8;
+  }
+  while (p != last && uint8_t(*p - '0') <= 9) {
+    ++p;
+  }
+  if (__builtin_expect(p != last, 0)) {
+    return {p, std::errc::invalid_argument};
+  }
+  while (first != last && *first == '0') {
+    ++first;
+  }
+  const size_t len = last - first;
+  // 20 * n digits are at least 10^(20 n - 1) >= 2^(64 n) for n >= 2.
+  if (__builtin_expect(len > 20 * n, 0)) {
+    return {last, std::errc::result_out_of_range};
+  }
+  std::vector<uint64_t> v;
+  if ((len + 18) / 19 <= threshold) {
+    bigint_parse_chunked(first, last, v);
+  } else {
+    size_t k = 0;
+    while ((size_t(38) << k) < len) {
+      ++k;
+    }
+    const auto powers = bigint_powers(k + 1);
+    bigint_parse(first, last, powers.data(), v, threshold);
+  }
+  if (__builtin_expect(v.size() > n, 0)) {
+    return {last, std::errc::result_out_of_range};
+  }
+  std::copy(v.begin(), v.end(), x);
+  std::fill(x + v.size(), x + n, 0);
+  return {last, {}};
+}
+
+} // namespace detail
+
+// Converts the unsigned integer stored in the little-endian 64-bit limbs
+// [limbs_first, limbs_last) to base 10. Values of up to
+// detail::bigint_to_chars_dc_threshold limbs are divided by 10^19
+// repeatedly, larger values are split recursively by cached powers
+// 10^(19 * 2^k) in O(M(n) log n) time, where M(n) is the cost of a Karatsuba
+// multiplication. Allocates memory.
+inline to_chars_result to_chars(char *first, char *last,
+                                const uint64_t *limbs_first,
+                                const uint64_t *limbs_last) {
+  return detail::to_chars_bigint(first, last, limbs_first,
+                                 limbs_last - limbs_first);
+}
+
+// Parses the base 10 number in [first, last) into the little-endian 64-bit
+// limbs [limbs_first, limbs_last), setting unused high limbs to zero. Long
+// inputs are split recursively and the halves combined with Karatsuba
+// multiplications. The limbs are not modified on error. If the value does
+// not fit ptr is last and ec is std::errc::result_out_of_range. Allocates
+// memory.
+inline from_chars_result from_chars(const char *first, const char *last,
+                                    uint64_t *limbs_first,
+                                    uint64_t *limbs_last) {
+  return detail::from_chars_bigint(first, last, limbs_first,
+                                   limbs_last - limbs_first);
+}
+
+} // namespace RIGTORP_CHARCONV_ISA_NAMESPACE
+} // namespace rigtorp
@@ -0,0 +1,147 @@
+/*
+Copyright (c) 2018 Erik Rigtorp <erik@rigtorp.se>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+ */
+
+
+#pragma once
+
+#include <rigtorp/CharConv.h>
+
+#include <cstring>
+#include <memory>
+
+namespace rigtorp {
+
+inline namespace RIGTORP_CHARCONV_ISA_NAMESPACE {
+
+namespace detail {
+
+// The characters of each value below 10^4 padded to 7 characters and
+// followed by the length, so that a value is written with one 8 byte copy.
+static constexpr uint32_t small_chars_limit = 10000;
+
+struct alignas(64) small_chars_table {
+  char entries[small_chars_limit][8];
+};
+
+constexpr small_chars_table make_small_chars() noexcept {
+  small_chars_table t = {};
+  for (uint32_t i = 0; i < small_chars_limit; ++i) {
+    const unsigned len = to_chars_len(i);
+    for (uint32_t j = len, v = i; j > 0; --j, v /= 10) {
+      t.entries[i][j - 1] = char('0' + v % 10);
+    }
+    t.entries[i][7] = char(len);
+  }
+  return t;
+}
+
+static constexpr small_chars_table small_chars = make_small_chars();
+
+} // namespace detail
+
+// Formats integers like to_chars, remembering the characters of recently
+// formatted values. Values in [0, 10^4) are copied from a precomputed
+// table. Other values are looked up in a direct-mapped cache of Size
+// entries indexed by a multiplicative hash of the value; a hit is a single
+// fixed size copy of the stored characters, and a miss formats the value
+// with to_chars and replaces the entry. The cache pays off when a small set
+// of values makes up most conversions, which hits() and misses() measure.
+// Characters in [ptr, last) may be overwritten. It is not thread safe.
+template <typename T, size_t Size = 4096> class to_chars_cache {
+  static_assert(std::is_same<T, int32_t>::value ||
+                std::is_same<T, uint32_t>::value ||
+                std::is_same<T, int64_t>::value ||
+                std::is_same<T, uint64_t>::value);
+  static_assert(Size >= 2 && (Size & (Size - 1)) == 0,
+                "Size must be a power of 2");
+
+public:
+  to_chars_cache() : entries_(new entry[Size]()) {}
+
+  to_chars_result to_chars(char *first, char *last, T value) noexcept {
+    if (uint64_t(value) < detail::small_chars_limit) {
+      ++small_hits_;
+      const auto &e = detail::small_chars.entries[size_t(value)];
+      return copy(first, last, e, uint8_t(e[7]));
+    }
+    entry &e = entries_[index(value)];
+    if (__builtin_expect(e.len != 0 && e.value == value, 1)) {
+      ++hits_;
+    } else {
+      ++misses_;
+      e.value = value;
+      e.len = uint8_t(
+          detail::to_chars(e.chars, e.chars + sizeof(e.chars), value).ptr -
+          e.chars);
+    }
+    return copy(first, last, e.chars, e.len);
+  }
+
+  // Number of conversions served by the table of small values.
+  uint64_t small_hits() const noexcept { return small_hits_; }
+
+  // Number of conversions found in and missing from the cache.
+  uint64_t hits() const noexcept { return hits_; }
+  uint64_t misses() const noexcept { return misses_; }
+
+  void reset_counters() noexcept { small_hits_ = hits_ = misses_ = 0; }
+
+private:
+  static constexpr size_t max_len = detail::to_chars_max_len<T>;
+
+  // 32 bytes for 64-bit and 16 bytes for 32-bit values, so that an entry
+  // never straddles a cache line.
+  struct alignas(sizeof(T) == 8 ? 32 : 16) entry {
+    T value;
+    uint8_t len;
+    char chars[max_len];
+  };
+
+  static size_t index(T value) noexcept {
+    constexpr unsigned bits = __builtin_ctzll(Size);
+    return size_t((uint64_t(value) * UINT64_C(0x9E3779B97F4A7C15)) >>
+                  (64 - bits));
+  }
+
+  // Copies all N characters of src when there is room so that the copy has
+  // a constant size.
+  template <size_t N>
+  static to_chars_result copy(char *first, char *last, const char (&src)[N],
+                              uint8_t len) noexcept {
+    if (__builtin_expect(size_t(last - first) >= N, 1)) {
+      std::memcpy(first, src, N);
+    } else if (size_t(last - first) >= len) {
+      std::memcpy(first, src, len);
+    } else {
+      return {last, std::errc::value_too_large};
+    }
+    return {first + len, {}};
+  }
+
+  std::unique_ptr<entry[]> entries_;
+  uint64_t small_hits_ = 0;
+  uint64_t hits_ = 0;
+  uint64_t misses_ = 0;
+};
+
+} // namespace RIGTORP_CHARCONV_ISA_NAMESPACE
+} // namespace rigtorp
@@ -0,0 +1,137 @@
+/*
+Copyright (c) 2018 Erik Rigtorp <erik@rigtorp.se>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+ */
+
+#pragma once
+
+#include <rigtorp/CharConv.h>
+
+#include <vector>
+
+// The batch conversions compiled into the CharConvDispatch library once for
+// each supported instruction set. The bulk parsers from_chars_parallel,
+// from_chars_file and from_chars_stream parse with the same kernels. The
+// kernels for the best instruction set supported by the CPU are selected on
+// first use, so a binary built without -m flags still runs the SIMD
+// kernels. Setting the environment variable RIGTORP_CHARCONV_ISA to
+// generic, sse4.1 or avx2 limits the selection to that level, which is
+// useful for testing and benchmarking. Any other value is ignored, so check
+// selected_isa() when testing a particular level. The generic kernels are
+// compiled for the baseline instruction set of the target.
+
+namespace rigtorp {
+namespace dispatch {
+
+enum class isa { generic, sse41, avx2 };
+
+// Returns the instruction set of the selected kernels.
+isa selected_isa() noexcept;
+
+to_chars_result to_chars_many(char *first, char *last,
+                              const uint32_t *values_first,
+                              const uint32_t *values_last, char delimiter,
+                              size_t *offsets = nullptr) noexcept;
+
+to_chars_result to_chars_many(char *first, char *last,
+                              const int32_t *values_first,
+                              const int32_t *values_last, char delimiter,
+                              size_t *offsets = nullptr) noexcept;
+
+to_chars_result to_chars_many(char *first, char *last,
+                              const uint64_t *values_first,
+                              const uint64_t *values_last, char delimiter,
+                              size_t *offsets = nullptr) noexcept;
+
+to_chars_result to_chars_many(char *first, char *last,
+                              const int64_t *values_first,
+                              const int64_t *values_last, char delimiter,
+                              size_t *offsets = nullptr) noexcept;
+
+from_chars_many_result from_chars_many(const char *first, const char *last,
+                                       uint32_t *values_first,
+                                       uint32_t *values_last) noexcept;
+
+from_chars_many_result from_chars_many(const char *first, const char *last,
+                                       int32_t *values_first,
+                                       int32_t *values_last) noexcept;
+
+from_chars_many_result from_chars_many(const char *first, const char *last,
+                                       uint64_t *values_first,
+                                       uint64_t *values_last) noexcept;
+
+from_chars_many_result from_chars_many(const char *first, const char *last,
+                                       int64_t *values_first,
+                                       int64_t *values_last) noexcept;
+
+// Calls the selected from_chars_many kernels, for use as the Parser of the
+// bulk parsers.
+struct from_chars_many_parser {
+  template <typename T>
+  static from_chars_many_result parse(const char *first, const char *last,
+                                      T *values_first,
+                                      T *values_last) noexcept {
+    return from_chars_many(first, last, values_first, values_last);
+  }
+};
+
+from_chars_many_result from_chars_parallel(const char *first, const char *last,
+                                           std::vector<uint32_t> &values,
+                                           unsigned threads = 0,
+                                           size_t block_size = 1 << 20);
+
+from_chars_many_result from_chars_parallel(const char *first, const char *last,
+                                           std::vector<int32_t> &values,
+                                           unsigned threads = 0,
+                                           size_t block_size = 1 << 20);
+
+from_chars_many_result from_chars_parallel(const char *first, const char *last,
+                                           std::vector<uint64_t> &values,
+                                           unsigned threads = 0,
+                                           size_t block_size = 1 << 20);
+
+from_chars_many_result from_chars_parallel(const char *first, const char *last,
+                                           std::vector<int64_t> &values,
+                                           unsigned threads = 0,
+                                           size_t block_size = 1 << 20);
+
+from_chars_file_result from_chars_file(const char *path,
+                                       std::vector<uint32_t> &values,
+                                       unsigned threads = 0);
+
+from_chars_file_result from_chars_file(const char *path,
+                                       std::vector<int32_t> &values,
+                                       unsigned threads = 0);
+
+from_chars_file_result from_chars_file(const char *path,
+                                       std::vector<uint64_t> &values,
+                                       unsigned threads = 0);
+
+from_chars_file_result from_chars_file(const char *path,
+                                       std::vector<int64_t> &values,
+                                       unsigned threads = 0);
+
+// The stream parser is header-only, only the complete numbers within each
+// chunk are parsed by the selected kernels.
+template <typename T>
+using from_chars_stream = rigtorp::from_chars_stream<T, from_chars_many_parser>;
+
+} // namespace dispatch
+} // namespace rigtorp
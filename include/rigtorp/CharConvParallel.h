@@ -0,0 +1,185 @@
+/*
+Copyright (c) 2018 Erik Rigtorp <erik@rigtorp.se>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+ */
+
+#pragma once
+
+#include <rigtorp/CharConv.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <thread>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace rigtorp {
+
+inline namespace RIGTORP_CHARCONV_ISA_NAMESPACE {
+
+namespace detail {
+
+// Returns the first delimiter at or after p. Blocks split at aligned
+// positions never cut a number in two.
+inline const char *align_to_delimiter(const char *p,
+                                      const char *last) noexcept {
+  while (p != last && !is_delimiter(*p)) {
+    ++p;
+  }
+  return p;
+}
+
+template <typename T> struct parallel_block {
+  std::vector<T> values;
+  from_chars_result res;
+};
+
+// Runs f() on threads - 1 new threads and the calling thread.
+template <typename F> void run_parallel(unsigned threads, const F &f) {
+  std::vector<std::thread> workers;
+  workers.reserve(threads - 1);
+  for (unsigned i = 1; i < threads; ++i) {
+    workers.emplace_back(f);
+  }
+  f();
+  for (auto &w : workers) {
+    w.join();
+  }
+}
+
+} // namespace detail
+
+// Parses the delimiter separated integers in [first, last) like
+// from_chars_many using multiple threads and appends them to values. The
+// input is split into blocks of about block_size characters aligned to
+// delimiters. Threads claim blocks from a shared counter, so blocks that
+// take longer to parse do not leave the other threads idle, and parse them
+// into per block vectors that are then copied into values in order. If
+// threads is 0 std::thread::hardware_concurrency() threads are used. A
+// block_size of 0 is treated as 1. Blocks are parsed by Parser, see
+// detail::from_chars_many_parser.
+template <typename T, typename Parser = detail::from_chars_many_parser>
+from_chars_many_result from_chars_parallel(const char *first, const char *last,
+                                           std::vector<T> &values,
+                                           unsigned threads = 0,
+                                           size_t block_size = 1 << 20) {
+  const size_t size = last - first;
+  block_size = std::max<size_t>(block_size, 1);
+  const size_t nblocks = (size + block_size - 1) / block_size;
+  if (threads == 0) {
+    threads = std::thread::hardware_concurrency();
+  }
+  threads = unsigned(std::max<size_t>(1, std::min<size_t>(threads, nblocks)));
+
+  std::vector<detail::parallel_block<T>> blocks(nblocks);
+  std::atomic<size_t> next = {0};
+  detail::run_parallel(threads, [&] {
+    T batch[512];
+    for (size_t i; (i = next.fetch_add(1, std::memory_order_relaxed)) <
+                   nblocks;) {
+      const char *p =
+          i == 0 ? first
+                 : detail::align_to_delimiter(first + i * block_size, last);
+      const char *end = i + 1 == nblocks
+                            ? last
+                            : detail::align_to_delimiter(
+                                  first + (i + 1) * block_size, last);
+      auto &b = blocks[i];
+      b.res = {end, {}};
+      while (p != end) {
+        const auto res = Parser::parse(p, end, batch, batch + 512);
+        b.values.insert(b.values.end(), batch, batch + res.count);
+        if (__builtin_expect(res.ec != std::errc{}, 0)) {
+          b.res = {res.ptr, res.ec};
+          break;
+        }
+        p = res.ptr;
+      }
+    }
+  });
+
+  // Stitch the blocks up to and including the first one with an error.
+  from_chars_many_result res = {last, {}, 0};
+  std::vector<size_t> offsets(nblocks + 1, values.size());
+  size_t n = 0;
+  for (; n < nblocks; ++n) {
+    offsets[n + 1] = offsets[n] + blocks[n].values.size();
+    if (blocks[n].res.ec != std::errc{}) {
+      res.ptr = blocks[n].res.ptr;
+      res.ec = blocks[n].res.ec;
+      ++n;
+      break;
+    }
+  }
+  res.count = offsets[n] - values.size();
+  values.resize(offsets[n]);
+  next = 0;
+  detail::run_parallel(threads, [&] {
+    for (size_t i; (i = next.fetch_add(1, std::memory_order_relaxed)) < n;) {
+      std::copy(blocks[i].values.begin(), blocks[i].values.end(),
+                values.begin() + offsets[i]);
+      std::vector<T>().swap(blocks[i].values);
+    }
+  });
+  return res;
+}
+
+// Memory maps the file at path and parses it with from_chars_parallel. On
+// error offset is the position of the offending character in the file. If
+// the file cannot be mapped ec holds the error from the system call.
+template <typename T, typename Parser = detail::from_chars_many_parser>
+from_chars_file_result from_chars_file(const char *path, std::vector<T> &values,
+                                       unsigned threads = 0) {
+  const int fd = ::open(path, O_RDONLY);
+  if (fd == -1) {
+    return {0, std::errc(errno), 0};
+  }
+  struct stat st;
+  if (::fstat(fd, &st) == -1) {
+    const int err = errno;
+    ::close(fd);
+    return {0, std::errc(err), 0};
+  }
+  const size_t size = st.st_size;
+  if (size == 0) {
+    ::close(fd);
+    return {0, {}, 0};
+  }
+  void *map = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+  const int err = errno;
+  ::close(fd);
+  if (map == MAP_FAILED) {
+    return {0, std::errc(err), 0};
+  }
+  ::madvise(map, size, MADV_SEQUENTIAL);
+  const char *data = static_cast<const char *>(map);
+  const auto res =
+      from_chars_parallel<T, Parser>(data, data + size, values, threads);
+  ::munmap(map, size);
+  return {size_t(res.ptr - data), res.ec, res.count};
+}
+
+} // namespace RIGTORP_CHARCONV_ISA_NAMESPACE
+} // namespace rigtorp
@@ -0,0 +1,201 @@
+/*
+Copyright (c) 2018 Erik Rigtorp <erik@rigtorp.se>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+ */
+
+
+#pragma once
+
+#include <rigtorp/CharConv.h>
+
+#include <array>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <utility>
+
+namespace rigtorp {
+
+inline namespace RIGTORP_CHARCONV_ISA_NAMESPACE {
+
+namespace detail {
+
+// Splits the format string Fmt at compile time into literal pieces and
+// replacement fields {}. The braces {{ and }} are written as { and }.
+template <const char *Fmt> struct format_layout {
+  static constexpr size_t length = std::char_traits<char>::length(Fmt);
+
+  struct counts {
+    bool valid;
+    size_t text_size;
+    size_t fields;
+  };
+
+  static constexpr counts count() noexcept {
+    counts c = {true, 0, 0};
+    for (size_t i = 0; i < length; ++i) {
+      if (Fmt[i] == '{' && i + 1 < length && Fmt[i + 1] == '}') {
+        ++c.fields;
+      } else if ((Fmt[i] == '{' || Fmt[i] == '}') && i + 1 < length &&
+                 Fmt[i + 1] == Fmt[i]) {
+        ++c.text_size;
+      } else if (Fmt[i] == '{' || Fmt[i] == '}') {
+        c.valid = false;
+        continue;
+      } else {
+        ++c.text_size;
+        continue;
+      }
+      ++i;
+    }
+    return c;
+  }
+
+  static constexpr counts info = count();
+  static constexpr size_t text_size = info.text_size;
+  static constexpr size_t fields = info.fields;
+
+  // The literal text with the fields removed and the offsets of the fields
+  // in it. offsets[0] is 0 and offsets[fields + 1] is text_size, so piece i
+  // is [offsets[i], offsets[i + 1]).
+  struct split {
+    std::array<char, text_size + 1> text;
+    std::array<size_t, fields + 2> offsets;
+  };
+
+  static constexpr split make_split() noexcept {
+    split s = {};
+    size_t n = 0;
+    size_t field = 1;
+    for (size_t i = 0; i < length; ++i) {
+      if (Fmt[i] == '{' && i + 1 < length && Fmt[i + 1] == '}') {
+        s.offsets[field++] = n;
+        ++i;
+      } else {
+        s.text[n++] = Fmt[i];
+        i += (Fmt[i] == '{' || Fmt[i] == '}');
+      }
+    }
+    s.offsets[field] = n;
+    return s;
+  }
+
+  static constexpr split pieces = make_split();
+};
+
+template <typename T> struct format_field {
+  static_assert(std::is_integral<T>::value && !std::is_same<T, bool>::value,
+                "format fields must be integers or char");
+  using type = std::conditional_t<
+      sizeof(T) <= sizeof(int32_t),
+      std::conditional_t<std::is_signed<T>::value, int32_t, uint32_t>,
+      std::conditional_t<std::is_signed<T>::value, int64_t, uint64_t>>;
+  static constexpr size_t max_size = std::numeric_limits<type>::digits10 + 1 +
+                                     std::numeric_limits<type>::is_signed;
+};
+
+template <> struct format_field<char> {
+  using type = char;
+  static constexpr size_t max_size = 1;
+};
+
+inline char *format_write(char *p, char value) noexcept {
+  *p = value;
+  return p + 1;
+}
+
+template <typename T> inline char *format_write(char *p, T value) noexcept {
+  using UT = std::make_unsigned_t<T>;
+  UT uvalue = value;
+  if constexpr (std::is_signed<T>::value) {
+    if (value < 0) {
+      *p++ = '-';
+      uvalue = UT(~value) + UT(1);
+    }
+  }
+  p += to_chars_len(uvalue);
+  digit_pair_writer::write(p, uvalue);
+  return p;
+}
+
+template <typename Layout, size_t I> inline char *format_piece(char *p) {
+  constexpr size_t offset = Layout::pieces.offsets[I];
+  constexpr size_t size = Layout::pieces.offsets[I + 1] - offset;
+  if constexpr (size != 0) {
+    std::memcpy(p, Layout::pieces.text.data() + offset, size);
+  }
+  return p + size;
+}
+
+template <typename Layout, typename... Args, size_t... I>
+inline char *format_unchecked(char *p, std::index_sequence<I...>,
+                              Args... args) noexcept {
+  p = format_piece<Layout, 0>(p);
+  ((p = format_piece<Layout, I + 1>(format_write(
+        p, typename format_field<Args>::type(args)))),
+   ...);
+  return p;
+}
+
+} // namespace detail
+
+// Maximum number of characters written by format_to<Fmt> for Args.
+template <const char *Fmt, typename... Args>
+constexpr size_t format_max_size =
+    detail::format_layout<Fmt>::text_size +
+    (size_t(0) + ... + detail::format_field<Args>::max_size);
+
+// Writes the format string Fmt to [first, last) with each replacement field
+// {} replaced by the next argument. Integer arguments are written in base
+// 10 and char arguments as a single character. Fmt must be a constexpr
+// character array with static storage duration, for example
+//
+//   static constexpr char fmt[] = "px={} qty={} side={}\n";
+//   format_to<fmt>(first, last, px, qty, side);
+//
+// The format string is split into pieces at compile time and the function
+// is a straight sequence of copies and integer conversions. If the buffer
+// can hold format_max_size<Fmt, Args...> characters there is a single bounds
+// check, otherwise the output is built in a temporary buffer first.
+template <const char *Fmt, typename... Args>
+inline to_chars_result format_to(char *first, char *last,
+                                 Args... args) noexcept {
+  using layout = detail::format_layout<Fmt>;
+  static_assert(layout::info.valid, "unmatched { or } in format string");
+  static_assert(layout::fields == sizeof...(Args),
+                "number of arguments does not match format string");
+  constexpr size_t max_size = format_max_size<Fmt, Args...>;
+  if (__builtin_expect(size_t(last - first) < max_size, 0)) {
+    char buf[max_size + 1];
+    const char *end = detail::format_unchecked<layout>(
+        buf, std::index_sequence_for<Args...>{}, args...);
+    if (size_t(last - first) < size_t(end - buf)) {
+      return {last, std::errc::value_too_large};
+    }
+    std::memcpy(first, buf, end - buf);
+    return {first + (end - buf), {}};
+  }
+  return {detail::format_unchecked<layout>(
+              first, std::index_sequence_for<Args...>{}, args...),
+          {}};
+}
+
+} // namespace RIGTORP_CHARCONV_ISA_NAMESPACE
+} // namespace rigtorp
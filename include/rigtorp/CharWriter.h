@@ -0,0 +1,252 @@
+/*
+Copyright (c) 2018 Erik Rigtorp <erik@rigtorp.se>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+ */
+
+#pragma once
+
+#include <rigtorp/CharConv.h>
+
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <string_view>
+#include <utility>
+
+#include <sys/uio.h>
+#include <unistd.h>
+
+namespace rigtorp {
+
+// Maximum number of characters appended by char_writer::append for T.
+template <typename T> constexpr size_t max_chars = 0;
+template <> constexpr size_t max_chars<char> = 1;
+template <> constexpr size_t max_chars<int32_t> = 11;
+template <> constexpr size_t max_chars<uint32_t> = 10;
+template <> constexpr size_t max_chars<int64_t> = 20;
+template <> constexpr size_t max_chars<uint64_t> = 20;
+template <> constexpr size_t max_chars<float> = 15;
+template <> constexpr size_t max_chars<double> = 24;
+
+inline namespace RIGTORP_CHARCONV_ISA_NAMESPACE {
+
+// Backends own the buffer that char_writer appends to. The writer caches the
+// current position pos and the end of the buffer last. overflow makes room
+// for at least n characters at pos and flush hands the characters appended
+// so far to their destination.
+
+// Writes to a file descriptor through a fixed buffer of Capacity characters.
+// Characters appended with append_external are not copied but referenced
+// from the caller's memory, and flush writes the buffered and referenced
+// ranges in order with a single writev.
+template <size_t Capacity = 65536, size_t MaxRanges = 64> class fd_backend {
+  static_assert(MaxRanges >= 3, "MaxRanges must be at least 3");
+
+public:
+  explicit fd_backend(int fd) noexcept : fd_(fd) {}
+  fd_backend(const fd_backend &) = delete;
+  fd_backend &operator=(const fd_backend &) = delete;
+
+  void attach(char *&pos, char *&last) noexcept {
+    pos = segment_ = buf_.data();
+    last = buf_.data() + buf_.size();
+  }
+
+  std::errc overflow(char *&pos, char *&last, size_t n) noexcept {
+    if (__builtin_expect(n > Capacity, 0)) {
+      return std::errc::value_too_large;
+    }
+    return flush(pos, last);
+  }
+
+  // The referenced memory must stay valid until the next flush. Room is kept
+  // for the buffered segment before s and the one after it, which flush adds.
+  std::errc append_external(char *&pos, char *&last,
+                            std::string_view s) noexcept {
+    if (ranges_ + 3 > MaxRanges) {
+      const auto ec = flush(pos, last);
+      if (ec != std::errc{}) {
+        return ec;
+      }
+    }
+    if (pos != segment_) {
+      iov_[ranges_++] = {segment_, size_t(pos - segment_)};
+      segment_ = pos;
+    }
+    iov_[ranges_++] = {const_cast<char *>(s.data()), s.size()};
+    return {};
+  }
+
+  // On error the unwritten characters are discarded.
+  std::errc flush(char *&pos, char *&last) noexcept {
+    if (pos != segment_) {
+      iov_[ranges_++] = {segment_, size_t(pos - segment_)};
+    }
+    iovec *iov = iov_.data();
+    iovec *const iov_last = iov_.data() + ranges_;
+    std::errc ec = {};
+    while (iov != iov_last) {
+      const ssize_t res = ::writev(fd_, iov, int(iov_last - iov));
+      if (res == -1) {
+        if (errno == EINTR) {
+          continue;
+        }
+        ec = std::errc(errno);
+        break;
+      }
+      size_t written = res;
+      while (iov != iov_last && written >= iov->iov_len) {
+        written -= iov->iov_len;
+        ++iov;
+      }
+      if (iov != iov_last) {
+        iov->iov_base = static_cast<char *>(iov->iov_base) + written;
+        iov->iov_len -= written;
+      }
+    }
+    ranges_ = 0;
+    attach(pos, last);
+    return ec;
+  }
+
+private:
+  int fd_;
+  size_t ranges_ = 0;
+  char *segment_ = nullptr;
+  std::array<iovec, MaxRanges> iov_;
+  std::array<char, Capacity> buf_;
+};
+
+// Appends to a std::string or std::vector<char>, growing it geometrically.
+// The container is resized ahead of the writer and trimmed to the appended
+// characters on flush. Appending after a flush grows it again.
+template <typename String> class string_backend {
+public:
+  explicit string_backend(String &s) noexcept : s_(s) {}
+
+  void attach(char *&pos, char *&last) noexcept {
+    const size_t size = s_.size();
+    s_.resize(std::max(s_.capacity(), size + 64));
+    pos = s_.data() + size;
+    last = s_.data() + s_.size();
+  }
+
+  std::errc overflow(char *&pos, char *&last, size_t n) {
+    const size_t size = pos - s_.data();
+    s_.resize(std::max(2 * s_.size(), size + n));
+    pos = s_.data() + size;
+    last = s_.data() + s_.size();
+    return {};
+  }
+
+  std::errc append_external(char *&pos, char *&last, std::string_view s) {
+    if (size_t(last - pos) < s.size()) {
+      overflow(pos, last, s.size());
+    }
+    std::memcpy(pos, s.data(), s.size());
+    pos += s.size();
+    return {};
+  }
+
+  std::errc flush(char *&pos, char *&last) {
+    s_.resize(pos - s_.data());
+    pos = s_.data() + s_.size();
+    last = pos;
+    return {};
+  }
+
+private:
+  String &s_;
+};
+
+// Builds text in a buffer provided by Backend. Capacity is reserved once
+// for a batch of appends and the append functions then write without
+// bounds checks, so a message with many fields needs a single check.
+// Appending more than the reserved capacity is undefined behavior.
+template <typename Backend> class char_writer {
+public:
+  template <typename... Args>
+  explicit char_writer(Args &&...args) : backend_(std::forward<Args>(args)...) {
+    backend_.attach(pos_, last_);
+  }
+  char_writer(const char_writer &) = delete;
+  char_writer &operator=(const char_writer &) = delete;
+
+  ~char_writer() { flush(); }
+
+  // Makes room for appending at least n characters.
+  std::errc reserve(size_t n) {
+    if (__builtin_expect(size_t(last_ - pos_) >= n, 1)) {
+      return {};
+    }
+    return backend_.overflow(pos_, last_, n);
+  }
+
+  void append(char c) noexcept { *pos_++ = c; }
+
+  void append(std::string_view s) noexcept {
+    std::memcpy(pos_, s.data(), s.size());
+    pos_ += s.size();
+  }
+
+  void append(int32_t value) noexcept { append_integer(value); }
+  void append(uint32_t value) noexcept { append_integer(value); }
+  void append(int64_t value) noexcept { append_integer(value); }
+  void append(uint64_t value) noexcept { append_integer(value); }
+
+  void append(float value) noexcept {
+    pos_ = detail::to_chars_float(pos_, pos_ + max_chars<float>, value).ptr;
+  }
+
+  void append(double value) noexcept {
+    pos_ = detail::to_chars_float(pos_, pos_ + max_chars<double>, value).ptr;
+  }
+
+  // Appends s without copying it if the backend supports it. Does not
+  // require reserved capacity.
+  std::errc append_external(std::string_view s) {
+    return backend_.append_external(pos_, last_, s);
+  }
+
+  std::errc flush() { return backend_.flush(pos_, last_); }
+
+  Backend &backend() noexcept { return backend_; }
+
+private:
+  template <typename T> void append_integer(T value) noexcept {
+    using UT = std::make_unsigned_t<T>;
+    UT uvalue = value;
+    if constexpr (std::is_signed<T>::value) {
+      if (value < 0) {
+        *pos_++ = '-';
+        uvalue = UT(~value) + UT(1);
+      }
+    }
+    pos_ += detail::to_chars_len(uvalue);
+    detail::digit_pair_writer::write(pos_, uvalue);
+  }
+
+  Backend backend_;
+  char *pos_ = nullptr;
+  char *last_ = nullptr;
+};
+
+} // namespace RIGTORP_CHARCONV_ISA_NAMESPACE
+} // namespace rigtorp
@@ -0,0 +1,248 @@
+/*
+Copyright (c) 2017 Erik Rigtorp <erik@rigtorp.se>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+ */
+
+
+#pragma once
+
+// Instrumentation for CharConvBenchmark: hardware performance counters read
+// with perf_event_open and a per call latency histogram timed with the time
+// stamp counter.
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <utility>
+#include <vector>
+
+#if __has_include(<linux/perf_event.h>)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+// Counts hardware events for the calling thread between start and stop.
+// Each event is opened on its own so that events the CPU or hypervisor does
+// not provide are skipped instead of disabling all of them, and counts are
+// scaled if the kernel multiplexed the counters. In containers without perf
+// events no event opens and available() returns false.
+class perf_counters {
+public:
+  static constexpr size_t num_events = 4;
+  static constexpr const char *names[num_events] = {
+      "cycles", "instructions", "branch_misses", "l1d_misses"};
+
+  perf_counters() noexcept {
+#if __has_include(<linux/perf_event.h>)
+    const std::pair<uint32_t, uint64_t> events[num_events] = {
+        {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES},
+        {PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS},
+        {PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES},
+        {PERF_TYPE_HW_CACHE, PERF_COUNT_HW_CACHE_L1D |
+                                 (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+                                 (PERF_COUNT_HW_CACHE_RESULT_MISS << 16)}};
+    for (size_t i = 0; i < num_events; ++i) {
+      perf_event_attr attr;
+      std::memset(&attr, 0, sizeof(attr));
+      attr.size = sizeof(attr);
+      attr.type = events[i].first;
+      attr.config = events[i].second;
+      attr.disabled = 1;
+      attr.exclude_kernel = 1;
+      attr.exclude_hv = 1;
+      attr.read_format =
+          PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+      fds_[i] = int(::syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+    }
+#endif
+  }
+
+  perf_counters(const perf_counters &) = delete;
+  perf_counters &operator=(const perf_counters &) = delete;
+
+  ~perf_counters() {
+#if __has_include(<linux/perf_event.h>)
+    for (int fd : fds_) {
+      if (fd != -1) {
+        ::close(fd);
+      }
+    }
+#endif
+  }
+
+  bool available() const noexcept {
+    return std::any_of(std::begin(fds_), std::end(fds_),
+                       [](int fd) { return fd != -1; });
+  }
+  bool available(size_t i) const noexcept { return fds_[i] != -1; }
+
+  void start() noexcept {
+#if __has_include(<linux/perf_event.h>)
+    for (int fd : fds_) {
+      if (fd != -1) {
+        ::ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+        ::ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+      }
+    }
+#endif
+  }
+
+  void stop() noexcept {
+#if __has_include(<linux/perf_event.h>)
+    for (int fd : fds_) {
+      if (fd != -1) {
+        ::ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+      }
+    }
+#endif
+  }
+
+  // Returns the count of event i since start, or 0 if it is unavailable.
+  double read(size_t i) const noexcept {
+#if __has_include(<linux/perf_event.h>)
+    uint64_t buf[3];
+    if (fds_[i] == -1 || ::read(fds_[i], buf, sizeof(buf)) != sizeof(buf) ||
+        buf[2] == 0) {
+      return 0;
+    }
+    return double(buf[0]) * double(buf[1]) / double(buf[2]);
+#else
+    (void)i;
+    return 0;
+#endif
+  }
+
+private:
+  std::array<int, num_events> fds_ = {-1, -1, -1, -1};
+};
+
+// Returns a time stamp in ticks of the time stamp counter, or in
+// nanoseconds on other architectures.
+inline uint64_t latency_ticks() noexcept {
+#if defined(__x86_64__) || defined(__i386__)
+  _mm_lfence();
+  const uint64_t t = __rdtsc();
+  _mm_lfence();
+  return t;
+#else
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+#endif
+}
+
+// Returns the number of ticks of latency_ticks per nanosecond, measured
+// once against std::chrono::steady_clock.
+inline double latency_ticks_per_ns() {
+  static const double ticks_per_ns = [] {
+    using clock = std::chrono::steady_clock;
+    const auto t0 = clock::now();
+    const uint64_t c0 = latency_ticks();
+    while (clock::now() - t0 < std::chrono::milliseconds(10)) {
+    }
+    const auto t1 = clock::now();
+    const uint64_t c1 = latency_ticks();
+    return double(c1 - c0) /
+           std::chrono::duration<double, std::nano>(t1 - t0).count();
+  }();
+  return ticks_per_ns;
+}
+
+// Histogram of non-negative integers with a relative error of at most
+// 1 / 2^SubBits, like HdrHistogram. Values below 2^SubBits have their own
+// bucket and each following power of two is split into 2^SubBits buckets.
+template <unsigned SubBits = 5> class latency_histogram {
+public:
+  void record(uint64_t value) noexcept {
+    ++counts_[bucket(value)];
+    ++total_;
+  }
+
+  uint64_t count() const noexcept { return total_; }
+
+  // Returns the lowest value of the bucket holding the quantile q.
+  uint64_t percentile(double q) const noexcept {
+    const uint64_t rank = std::max<uint64_t>(1, uint64_t(q * total_ + 0.5));
+    uint64_t seen = 0;
+    for (size_t i = 0; i < counts_.size(); ++i) {
+      seen += counts_[i];
+      if (seen >= rank) {
+        return lowest(i);
+      }
+    }
+    return 0;
+  }
+
+private:
+  static constexpr uint64_t sub_count = uint64_t(1) << SubBits;
+
+  static size_t bucket(uint64_t value) noexcept {
+    if (value < sub_count) {
+      return value;
+    }
+    const unsigned msb = 63 - __builtin_clzll(value);
+    const unsigned shift = msb - SubBits;
+    return (shift + 1) * sub_count + ((value >> shift) - sub_count);
+  }
+
+  static uint64_t lowest(size_t i) noexcept {
+    if (i < sub_count) {
+      return i;
+    }
+    const unsigned shift = unsigned(i / sub_count) - 1;
+    return (sub_count + i % sub_count) << shift;
+  }
+
+  std::array<uint64_t, (64 - SubBits + 1) * sub_count> counts_ = {};
+  uint64_t total_ = 0;
+};
+
+// Evicts the L1 and L2 caches by reading a buffer twice the size of the L2
+// cache, or 4 MiB if the size is unknown.
+class cache_evictor {
+public:
+  cache_evictor() {
+    long l2 = 0;
+#if defined(_SC_LEVEL2_CACHE_SIZE)
+    l2 = ::sysconf(_SC_LEVEL2_CACHE_SIZE);
+#endif
+    buf_.resize(l2 > 0 ? 2 * size_t(l2) : size_t(4) << 20, 1);
+  }
+
+  void evict() noexcept {
+    uint64_t sum = 0;
+    for (size_t i = 0; i < buf_.size(); i += 64) {
+      sum += buf_[i];
+    }
+    sink_ = sum;
+  }
+
+private:
+  std::vector<uint8_t> buf_;
+  volatile uint64_t sink_ = 0;
+};
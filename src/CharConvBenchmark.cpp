@@ -20,56 +20,153 @@ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
 SOFTWARE.
  */
 
+#include "BenchmarkHarness.h"
+
 #include <algorithm>
+#include <array>
 #include <benchmark/benchmark.h>
 #include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
 #include <iostream>
+#include <memory>
 #include <random>
 #include <rigtorp/CharConv.h>
+#include <rigtorp/CharConvBigInt.h>
+#include <rigtorp/CharConvCache.h>
+#include <rigtorp/CharConvDispatch.h>
+#include <rigtorp/CharConvParallel.h>
+#include <rigtorp/CharFormat.h>
+#include <rigtorp/CharWriter.h>
 #include <sstream>
+#include <vector>
 
-template <typename T> auto generate_ints(int digits) {
-  T max = 1;
-  for (int i = 0; i < digits; ++i) {
-    max *= 10;
-  }
-  --max;
-  const T min = std::is_unsigned_v<T> ? 0 : -max;
-  std::random_device rd;
-  std::mt19937 gen(rd());
-  std::uniform_int_distribution<T> dis(min, max);
+__extension__ typedef __int128 i128;
+__extension__ typedef unsigned __int128 u128;
+
+// Inputs are generated with fixed seeds so that runs are comparable.
+constexpr std::mt19937::result_type benchmark_seed = 42;
+
+// std::uniform_int_distribution and std::to_string do not support 128-bit
+// integers, so 128-bit values are built from random digits instead.
+template <typename T> auto generate_ints_128(int digits) {
+  std::mt19937 gen(benchmark_seed + digits);
+  std::uniform_int_distribution<int> lead(1, 9);
+  std::uniform_int_distribution<int> digit(0, 9);
   std::array<T, 4096> v = {};
   std::generate(v.begin(), v.end(), [&] {
     T res;
+    bool overflow;
     do {
-      res = dis(gen);
-    } while (std::to_string(res).size() < static_cast<size_t>(digits));
+      res = lead(gen);
+      overflow = false;
+      for (int i = 1; i < digits; ++i) {
+        overflow |= __builtin_mul_overflow(res, 10, &res) ||
+                    __builtin_add_overflow(res, digit(gen), &res);
+      }
+    } while (overflow);
+    if (std::is_same_v<T, i128> && gen() % 2) {
+      res = -res;
+    }
     return res;
   });
   return v;
 }
 
+template <typename T> auto generate_ints(int digits) {
+  if constexpr (sizeof(T) > sizeof(uint64_t)) {
+    return generate_ints_128<T>(digits);
+  } else {
+    T max = 1;
+    for (int i = 0; i < digits; ++i) {
+      max *= 10;
+    }
+    --max;
+    const T min = std::is_unsigned_v<T> ? 0 : -max;
+    std::mt19937 gen(benchmark_seed + digits);
+    std::uniform_int_distribution<T> dis(min, max);
+    std::array<T, 4096> v = {};
+    std::generate(v.begin(), v.end(), [&] {
+      T res;
+      do {
+        res = dis(gen);
+      } while (std::to_string(res).size() < static_cast<size_t>(digits));
+      return res;
+    });
+    return v;
+  }
+}
+
 template <typename T> auto generate_strings(int digits) {
-  T max = 1;
+  if constexpr (sizeof(T) > sizeof(uint64_t)) {
+    const auto ints = generate_ints_128<T>(digits);
+    std::array<std::string, 4096> v;
+    std::transform(ints.begin(), ints.end(), v.begin(), [](T x) {
+      std::array<char, 48> buf = {};
+      const auto res = rigtorp::to_chars(buf.begin(), buf.end(), x);
+      return std::string(buf.begin(), res.ptr);
+    });
+    return v;
+  } else {
+    T max = 1;
+    for (int i = 0; i < digits; ++i) {
+      max *= 10;
+    }
+    --max;
+    const T min = std::is_unsigned_v<T> ? 0 : -max;
+    std::mt19937 gen(benchmark_seed + digits);
+    std::uniform_int_distribution<T> dis(min, max);
+    std::array<std::string, 4096> v;
+    std::generate(v.begin(), v.end(), [&] {
+      std::string res;
+      do {
+        res = std::to_string(dis(gen));
+      } while (res.size() < static_cast<size_t>(digits));
+      return res;
+    });
+    return v;
+  }
+}
+
+template <typename T> auto generate_floats(int digits) {
+  int64_t max = 1;
   for (int i = 0; i < digits; ++i) {
     max *= 10;
   }
-  --max;
-  const T min = std::is_unsigned_v<T> ? 0 : -max;
-  std::random_device rd;
-  std::mt19937 gen(rd());
-  std::uniform_int_distribution<T> dis(min, max);
-  std::array<std::string, 4096> v;
+  std::mt19937 gen(benchmark_seed + digits);
+  std::uniform_int_distribution<int64_t> dis(max / 10, max - 1);
+  std::uniform_int_distribution<int> exp(-10, 10);
+  std::array<T, 4096> v = {};
   std::generate(v.begin(), v.end(), [&] {
-    std::string res;
-    do {
-      res = std::to_string(dis(gen));
-    } while (res.size() < static_cast<size_t>(digits));
-    return res;
+    return static_cast<T>(dis(gen) * std::pow(10.0, exp(gen) - digits));
   });
   return v;
 }
 
+template <typename T> auto generate_float_strings(int digits) {
+  const auto v = generate_floats<T>(digits);
+  std::array<std::string, 4096> res;
+  std::transform(v.begin(), v.end(), res.begin(), [&](T x) {
+    std::array<char, 32> buf = {};
+    snprintf(buf.data(), buf.size(), "%.*g", digits, static_cast<double>(x));
+    return std::string(buf.data());
+  });
+  return res;
+}
+
+static const char *isa_name(rigtorp::dispatch::isa level) {
+  switch (level) {
+  case rigtorp::dispatch::isa::avx2:
+    return "avx2";
+  case rigtorp::dispatch::isa::sse41:
+    return "sse4.1";
+  case rigtorp::dispatch::isa::generic:
+    break;
+  }
+  return "generic";
+}
+
 static bool to_chars_naive(char *first, char *last[[maybe_unused]],
                            uint32_t v) {
   char *p = first;
@@ -106,6 +203,18 @@ static void BM_sprintf(benchmark::State &state) {
   }
 }
 
+template <typename T>
+static void BM_sprintf_float(benchmark::State &state) {
+  const auto v = generate_floats<T>(state.range(0));
+  std::array<char, 32> buf = {};
+  int i = 0;
+  for (auto _ : state) {
+    sprintf(buf.data(), std::is_same_v<T, float> ? "%.9g" : "%.17g",
+            v[i % v.size()]);
+    ++i;
+  }
+}
+
 static void BM_to_string(benchmark::State &state) {
   const auto v = generate_ints<int>(state.range(0));
   std::string buf;
@@ -139,13 +248,213 @@ static void BM_rigtorp_to_chars_naive(benchmark::State &state) {
   }
 }
 
-template <typename T> static void BM_rigtorp_to_chars(benchmark::State &state) {
+template <typename T, typename Writer>
+static void BM_rigtorp_to_chars(benchmark::State &state) {
+  const auto v = generate_ints<T>(state.range(0));
+  std::array<char, 48> buf = {};
+  int i = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(buf.data());
+    benchmark::DoNotOptimize(rigtorp::detail::to_chars<T, Writer>(
+        buf.data(), buf.data() + buf.size(), v[i % v.size()]));
+    benchmark::ClobberMemory();
+    ++i;
+  }
+}
+
+template <typename T>
+static void BM_rigtorp_to_chars_backward(benchmark::State &state) {
+  const auto v = generate_ints<T>(state.range(0));
+  std::array<char, 48> buf = {};
+  int i = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(buf.data());
+    benchmark::DoNotOptimize(
+        rigtorp::to_chars_backward(buf.data() + buf.size(), v[i % v.size()]));
+    benchmark::ClobberMemory();
+    ++i;
+  }
+}
+
+template <typename T>
+static void BM_rigtorp_to_chars_float(benchmark::State &state) {
+  const auto v = generate_floats<T>(state.range(0));
+  std::array<char, 32> buf = {};
+  int i = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(buf.data());
+    benchmark::DoNotOptimize(rigtorp::to_chars(
+        buf.data(), buf.data() + buf.size(), v[i % v.size()]));
+    benchmark::ClobberMemory();
+    ++i;
+  }
+}
+
+template <typename T>
+static void BM_scalar_to_chars_many(benchmark::State &state) {
+  const auto v = generate_ints<T>(state.range(0));
+  std::vector<char> buf(v.size() * (rigtorp::detail::to_chars_max_len<T> + 1));
+  size_t bytes = 0;
+  for (auto _ : state) {
+    char *p = buf.data();
+    char *const last = buf.data() + buf.size();
+    for (size_t i = 0; i < v.size(); ++i) {
+      if (i != 0) {
+        *p++ = ',';
+      }
+      p = rigtorp::detail::to_chars(p, last, v[i]).ptr;
+    }
+    benchmark::DoNotOptimize(p);
+    benchmark::ClobberMemory();
+    bytes += p - buf.data();
+  }
+  state.SetBytesProcessed(bytes);
+  state.SetItemsProcessed(state.iterations() * v.size());
+}
+
+template <typename T>
+static void BM_rigtorp_to_chars_many(benchmark::State &state) {
   const auto v = generate_ints<T>(state.range(0));
+  std::vector<char> buf(v.size() * (rigtorp::detail::to_chars_max_len<T> + 1));
+  size_t bytes = 0;
+  for (auto _ : state) {
+    const auto res =
+        rigtorp::to_chars_many(buf.data(), buf.data() + buf.size(), v.data(),
+                               v.data() + v.size(), ',');
+    benchmark::DoNotOptimize(res);
+    benchmark::ClobberMemory();
+    bytes += res.ptr - buf.data();
+  }
+  state.SetBytesProcessed(bytes);
+  state.SetItemsProcessed(state.iterations() * v.size());
+}
+
+// Set RIGTORP_CHARCONV_ISA to compare the dispatched kernels.
+template <typename T>
+static void BM_dispatch_to_chars_many(benchmark::State &state) {
+  const auto v = generate_ints<T>(state.range(0));
+  std::vector<char> buf(v.size() * (rigtorp::detail::to_chars_max_len<T> + 1));
+  size_t bytes = 0;
+  for (auto _ : state) {
+    const auto res = rigtorp::dispatch::to_chars_many(
+        buf.data(), buf.data() + buf.size(), v.data(), v.data() + v.size(),
+        ',');
+    benchmark::DoNotOptimize(res);
+    benchmark::ClobberMemory();
+    bytes += res.ptr - buf.data();
+  }
+  state.SetBytesProcessed(bytes);
+  state.SetItemsProcessed(state.iterations() * v.size());
+  state.SetLabel(isa_name(rigtorp::dispatch::selected_isa()));
+}
+
+template <unsigned N>
+static void BM_rigtorp_to_chars_padded(benchmark::State &state) {
+  const auto v = generate_ints<uint64_t>(state.range(0));
+  std::array<char, 32> buf = {};
+  int i = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(buf.data());
+    const auto value = v[i % v.size()];
+    const auto len = rigtorp::detail::to_chars_len(value);
+    std::memset(buf.data(), '0', N - len);
+    benchmark::DoNotOptimize(rigtorp::to_chars(
+        buf.data() + N - len, buf.data() + buf.size(), value));
+    benchmark::ClobberMemory();
+    ++i;
+  }
+}
+
+template <unsigned N>
+static void BM_rigtorp_to_chars_fixed(benchmark::State &state) {
+  const auto v = generate_ints<uint64_t>(state.range(0));
   std::array<char, 32> buf = {};
   int i = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(buf.data());
+    benchmark::DoNotOptimize(
+        rigtorp::to_chars_fixed<N>(buf.data(), v[i % v.size()]));
+    benchmark::ClobberMemory();
+    ++i;
+  }
+}
+
+template <int Base>
+static void BM_rigtorp_to_chars_base(benchmark::State &state) {
+  const auto v = generate_ints<uint64_t>(state.range(0));
+  std::array<char, 80> buf = {};
+  int i = 0;
   for (auto _ : state) {
     benchmark::DoNotOptimize(buf.data());
     benchmark::DoNotOptimize(rigtorp::to_chars(
+        buf.data(), buf.data() + buf.size(), v[i % v.size()], Base));
+    benchmark::ClobberMemory();
+    ++i;
+  }
+}
+
+template <int Base> static auto generate_base_strings(int digits) {
+  const auto v = generate_ints<uint64_t>(digits);
+  std::array<std::string, 4096> res;
+  std::transform(v.begin(), v.end(), res.begin(), [&](uint64_t x) {
+    std::array<char, 80> buf = {};
+    const auto r = rigtorp::to_chars(buf.data(), buf.data() + buf.size(), x,
+                                     Base);
+    return std::string(buf.data(), r.ptr);
+  });
+  return res;
+}
+
+template <int Base> static void BM_strtoull_base(benchmark::State &state) {
+  const auto v = generate_base_strings<Base>(state.range(0));
+  int i = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(strtoull(v[i % v.size()].data(), nullptr, Base));
+    ++i;
+  }
+}
+
+template <int Base>
+static void BM_rigtorp_from_chars_base(benchmark::State &state) {
+  const auto v = generate_base_strings<Base>(state.range(0));
+  uint64_t val = 0;
+  int i = 0;
+  for (auto _ : state) {
+    const auto &s = v[i % v.size()];
+    benchmark::DoNotOptimize(val);
+    benchmark::DoNotOptimize(
+        rigtorp::from_chars(s.data(), s.data() + s.size(), val, Base));
+    ++i;
+  }
+}
+
+static void BM_rigtorp_to_chars_decimal_div(benchmark::State &state) {
+  const auto v = generate_ints<int64_t>(state.range(0));
+  std::array<char, 32> buf = {};
+  int i = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(buf.data());
+    const auto value = v[i % v.size()];
+    auto res = rigtorp::to_chars(buf.data(), buf.data() + buf.size(),
+                                 value / 10000);
+    if (value < 0 && value > -10000) {
+      *res.ptr++ = '-';
+    }
+    *res.ptr++ = '.';
+    benchmark::DoNotOptimize(rigtorp::to_chars_fixed<4>(
+        res.ptr, uint32_t(value < 0 ? -(value % 10000) : value % 10000)));
+    benchmark::ClobberMemory();
+    ++i;
+  }
+}
+
+static void BM_rigtorp_to_chars_decimal(benchmark::State &state) {
+  const auto v = generate_ints<int64_t>(state.range(0));
+  std::array<char, 32> buf = {};
+  int i = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(buf.data());
+    benchmark::DoNotOptimize(rigtorp::to_chars_decimal<4>(
         buf.data(), buf.data() + buf.size(), v[i % v.size()]));
     benchmark::ClobberMemory();
     ++i;
@@ -170,6 +479,20 @@ static void BM_strtol(benchmark::State &state) {
   }
 }
 
+template <typename T>
+static void BM_strtod(benchmark::State &state) {
+  const auto v = generate_float_strings<T>(state.range(0));
+  int i = 0;
+  for (auto _ : state) {
+    if constexpr (std::is_same_v<T, float>) {
+      benchmark::DoNotOptimize(strtof(v[i % v.size()].data(), nullptr));
+    } else {
+      benchmark::DoNotOptimize(strtod(v[i % v.size()].data(), nullptr));
+    }
+    ++i;
+  }
+}
+
 static void BM_stoi(benchmark::State &state) {
   const auto v = generate_strings<int>(state.range(0));
   int i = 0;
@@ -192,7 +515,7 @@ static void BM_rigtorp_from_chars_unchecked(benchmark::State &state) {
   }
 }
 
-template <typename T>
+template <typename T, typename Parser>
 static void BM_rigtorp_from_chars(benchmark::State &state) {
   const auto v = generate_strings<T>(state.range(0));
   T val = 0;
@@ -201,76 +524,1761 @@ static void BM_rigtorp_from_chars(benchmark::State &state) {
     const auto &s = v[i % v.size()];
     benchmark::DoNotOptimize(val);
     benchmark::DoNotOptimize(
-        rigtorp::from_chars(s.data(), s.data() + s.size(), val));
+        rigtorp::detail::from_chars<T, Parser>(s.data(), s.data() + s.size(),
+                                               val));
     ++i;
   }
 }
 
-#if __has_include(<charconv>)
+static auto generate_decimal_strings(int digits) {
+  const auto v = generate_ints<int64_t>(digits);
+  std::array<std::string, 4096> res;
+  std::transform(v.begin(), v.end(), res.begin(), [&](int64_t x) {
+    std::array<char, 32> buf = {};
+    const auto r =
+        rigtorp::to_chars_decimal<4>(buf.data(), buf.data() + buf.size(), x);
+    return std::string(buf.data(), r.ptr);
+  });
+  return res;
+}
 
-#include <charconv>
+static void BM_rigtorp_from_chars_decimal_split(benchmark::State &state) {
+  const auto v = generate_decimal_strings(state.range(0));
+  int64_t val = 0;
+  int i = 0;
+  for (auto _ : state) {
+    const auto &s = v[i % v.size()];
+    benchmark::DoNotOptimize(val);
+    const char *first = s.data();
+    const char *last = s.data() + s.size();
+    const char *point = static_cast<const char *>(
+        std::memchr(first, '.', s.size()));
+    int64_t integer = 0;
+    int64_t fraction = 0;
+    rigtorp::from_chars(first, point, integer);
+    rigtorp::from_chars(point + 1, last, fraction);
+    static constexpr int64_t pad[] = {10000, 1000, 100, 10, 1};
+    fraction *= pad[last - point - 1];
+    val = integer * 10000 + (s[0] == '-' ? -fraction : fraction);
+    ++i;
+  }
+}
 
-template <typename T> static void BM_std_to_chars(benchmark::State &state) {
-  const auto v = generate_ints<T>(state.range(0));
-  std::array<char, 32> buf = {};
+static void BM_rigtorp_from_chars_decimal(benchmark::State &state) {
+  const auto v = generate_decimal_strings(state.range(0));
+  int64_t val = 0;
   int i = 0;
   for (auto _ : state) {
-    benchmark::DoNotOptimize(buf.data());
-    benchmark::DoNotOptimize(
-        std::to_chars(buf.data(), buf.data() + buf.size(), v[i % v.size()]));
-    benchmark::ClobberMemory();
+    const auto &s = v[i % v.size()];
+    benchmark::DoNotOptimize(val);
+    benchmark::DoNotOptimize(rigtorp::from_chars_decimal<4>(
+        s.data(), s.data() + s.size(), val));
     ++i;
   }
 }
 
-template <typename T> static void BM_std_from_chars(benchmark::State &state) {
-  const auto v = generate_strings<T>(state.range(0));
+template <typename T>
+static void BM_rigtorp_from_chars_float(benchmark::State &state) {
+  const auto v = generate_float_strings<T>(state.range(0));
   T val = 0;
   int i = 0;
   for (auto _ : state) {
     const auto &s = v[i % v.size()];
     benchmark::DoNotOptimize(val);
     benchmark::DoNotOptimize(
-        std::from_chars(s.data(), s.data() + s.size(), val));
+        rigtorp::from_chars(s.data(), s.data() + s.size(), val));
     ++i;
   }
 }
 
-#endif
+template <unsigned N>
+static void BM_rigtorp_from_chars_known_len(benchmark::State &state) {
+  const auto v = generate_strings<uint64_t>(N);
+  uint64_t val = 0;
+  int i = 0;
+  for (auto _ : state) {
+    const auto &s = v[i % v.size()];
+    benchmark::DoNotOptimize(val);
+    benchmark::DoNotOptimize(
+        rigtorp::from_chars(s.data(), s.data() + N, val));
+    ++i;
+  }
+}
 
-template <int N> static void Digits(benchmark::internal::Benchmark *b) {
-  for (int i = 1; i <= N; ++i) {
-    b->Arg(i);
+template <unsigned N>
+static void BM_rigtorp_from_chars_fixed(benchmark::State &state) {
+  const auto v = generate_strings<uint64_t>(N);
+  uint64_t val = 0;
+  int i = 0;
+  for (auto _ : state) {
+    const auto &s = v[i % v.size()];
+    benchmark::DoNotOptimize(val);
+    benchmark::DoNotOptimize(rigtorp::from_chars_fixed<N>(s.data(), val));
+    ++i;
   }
 }
 
-BENCHMARK(BM_sprintf)->Apply(Digits<9>);
-BENCHMARK(BM_to_string)->Apply(Digits<9>);
-BENCHMARK(BM_stringstream)->Apply(Digits<9>);
-#if __has_include(<charconv>)
-BENCHMARK_TEMPLATE(BM_std_to_chars, int32_t)->Apply(Digits<9>);
-BENCHMARK_TEMPLATE(BM_std_to_chars, uint32_t)->Apply(Digits<9>);
-BENCHMARK_TEMPLATE(BM_std_to_chars, int64_t)->Apply(Digits<19>);
-BENCHMARK_TEMPLATE(BM_std_to_chars, uint64_t)->Apply(Digits<19>);
-#endif
-BENCHMARK(BM_rigtorp_to_chars_naive)->Apply(Digits<9>);
-BENCHMARK_TEMPLATE(BM_rigtorp_to_chars, int32_t)->Apply(Digits<9>);
-BENCHMARK_TEMPLATE(BM_rigtorp_to_chars, uint32_t)->Apply(Digits<9>);
-BENCHMARK_TEMPLATE(BM_rigtorp_to_chars, int64_t)->Apply(Digits<19>);
-BENCHMARK_TEMPLATE(BM_rigtorp_to_chars, uint64_t)->Apply(Digits<19>);
-BENCHMARK(BM_atoi)->Apply(Digits<9>);
-BENCHMARK(BM_strtol)->Apply(Digits<9>);
-BENCHMARK(BM_stoi)->Apply(Digits<9>);
-#if __has_include(<charconv>)
-BENCHMARK_TEMPLATE(BM_std_from_chars, int32_t)->Apply(Digits<9>);
-BENCHMARK_TEMPLATE(BM_std_from_chars, uint32_t)->Apply(Digits<9>);
-BENCHMARK_TEMPLATE(BM_std_from_chars, int64_t)->Apply(Digits<19>);
-BENCHMARK_TEMPLATE(BM_std_from_chars, uint64_t)->Apply(Digits<19>);
-#endif
-BENCHMARK(BM_rigtorp_from_chars_unchecked)->Apply(Digits<9>);
-BENCHMARK_TEMPLATE(BM_rigtorp_from_chars, int32_t)->Apply(Digits<9>);
-BENCHMARK_TEMPLATE(BM_rigtorp_from_chars, uint32_t)->Apply(Digits<9>);
-BENCHMARK_TEMPLATE(BM_rigtorp_from_chars, int64_t)->Apply(Digits<19>);
-BENCHMARK_TEMPLATE(BM_rigtorp_from_chars, uint64_t)->Apply(Digits<19>);
+// Timestamps in nanoseconds spread over 10 years from 2020.
+static std::vector<int64_t> generate_timestamps() {
+  std::mt19937_64 gen(benchmark_seed);
+  std::uniform_int_distribution<int64_t> dis(
+      INT64_C(1577836800000000000),
+      INT64_C(1577836800000000000) + INT64_C(315576000000000000));
+  std::vector<int64_t> v(1000);
+  for (auto &x : v) {
+    x = dis(gen);
+  }
+  return v;
+}
+
+static std::vector<std::string> generate_timestamp_strings() {
+  std::vector<std::string> v;
+  for (const auto x : generate_timestamps()) {
+    char buf[32];
+    v.emplace_back(buf, rigtorp::to_chars_timestamp(buf, buf + 32, x).ptr);
+  }
+  return v;
+}
+
+static void BM_snprintf_timestamp(benchmark::State &state) {
+  const auto v = generate_timestamps();
+  std::array<char, 64> buf = {};
+  size_t i = 0;
+  for (auto _ : state) {
+    const int64_t x = v[i++ % v.size()];
+    const time_t t = x / 1000000000;
+    struct tm tm;
+    gmtime_r(&t, &tm);
+    benchmark::DoNotOptimize(
+        snprintf(buf.data(), buf.size(), "%04d-%02d-%02dT%02d:%02d:%02d.%09d",
+                 tm.tm_year + 1900, tm.tm_mon + 1, tm.tm_mday, tm.tm_hour,
+                 tm.tm_min, tm.tm_sec, int(x % 1000000000)));
+    benchmark::ClobberMemory();
+  }
+}
+
+// Formats with gmtime_r and a to_chars_fixed call per field.
+static void BM_rigtorp_to_chars_fixed_timestamp(benchmark::State &state) {
+  const auto v = generate_timestamps();
+  std::array<char, 32> buf = {};
+  size_t i = 0;
+  for (auto _ : state) {
+    const int64_t x = v[i++ % v.size()];
+    const time_t t = x / 1000000000;
+    struct tm tm;
+    gmtime_r(&t, &tm);
+    char *p = buf.data();
+    p = rigtorp::to_chars_fixed<4>(p, uint32_t(tm.tm_year + 1900)).ptr;
+    *p++ = '-';
+    p = rigtorp::to_chars_fixed<2>(p, uint32_t(tm.tm_mon + 1)).ptr;
+    *p++ = '-';
+    p = rigtorp::to_chars_fixed<2>(p, uint32_t(tm.tm_mday)).ptr;
+    *p++ = 'T';
+    p = rigtorp::to_chars_fixed<2>(p, uint32_t(tm.tm_hour)).ptr;
+    *p++ = ':';
+    p = rigtorp::to_chars_fixed<2>(p, uint32_t(tm.tm_min)).ptr;
+    *p++ = ':';
+    p = rigtorp::to_chars_fixed<2>(p, uint32_t(tm.tm_sec)).ptr;
+    *p++ = '.';
+    p = rigtorp::to_chars_fixed<9>(p, uint32_t(x % 1000000000)).ptr;
+    benchmark::DoNotOptimize(p);
+    benchmark::ClobberMemory();
+  }
+}
+
+static void BM_rigtorp_to_chars_timestamp(benchmark::State &state) {
+  const auto v = generate_timestamps();
+  std::array<char, 32> buf = {};
+  size_t i = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(buf.data());
+    benchmark::DoNotOptimize(rigtorp::to_chars_timestamp(
+        buf.data(), buf.data() + buf.size(), v[i++ % v.size()]));
+    benchmark::ClobberMemory();
+  }
+}
+
+// Parses with a from_chars_fixed call per field and timegm.
+static void BM_rigtorp_from_chars_fixed_timestamp(benchmark::State &state) {
+  const auto v = generate_timestamp_strings();
+  size_t i = 0;
+  for (auto _ : state) {
+    const char *p = v[i++ % v.size()].data();
+    struct tm tm = {};
+    uint32_t nanos = 0;
+    rigtorp::from_chars_fixed<4>(p, tm.tm_year);
+    rigtorp::from_chars_fixed<2>(p + 5, tm.tm_mon);
+    rigtorp::from_chars_fixed<2>(p + 8, tm.tm_mday);
+    rigtorp::from_chars_fixed<2>(p + 11, tm.tm_hour);
+    rigtorp::from_chars_fixed<2>(p + 14, tm.tm_min);
+    rigtorp::from_chars_fixed<2>(p + 17, tm.tm_sec);
+    rigtorp::from_chars_fixed<9>(p + 20, nanos);
+    tm.tm_year -= 1900;
+    tm.tm_mon -= 1;
+    benchmark::DoNotOptimize(int64_t(timegm(&tm)) * 1000000000 + nanos);
+  }
+}
+
+static void BM_rigtorp_from_chars_timestamp(benchmark::State &state) {
+  const auto v = generate_timestamp_strings();
+  int64_t val = 0;
+  size_t i = 0;
+  for (auto _ : state) {
+    const auto &s = v[i++ % v.size()];
+    benchmark::DoNotOptimize(val);
+    benchmark::DoNotOptimize(
+        rigtorp::from_chars_timestamp(s.data(), s.data() + s.size(), val));
+  }
+}
+
+// Random integers of state.range(0) limbs. Chunked uses 19 digits per
+// division by 10^19 at every size instead of switching to
+// divide-and-conquer above the threshold.
+static std::vector<uint64_t> generate_bigint(size_t n) {
+  std::mt19937_64 gen(25);
+  std::vector<uint64_t> x(n);
+  for (auto &limb : x) {
+    limb = gen();
+  }
+  return x;
+}
+
+template <bool Chunked>
+static void BM_rigtorp_to_chars_bigint(benchmark::State &state) {
+  const auto x = generate_bigint(state.range(0));
+  const size_t threshold =
+      Chunked ? SIZE_MAX : rigtorp::detail::bigint_to_chars_dc_threshold;
+  std::string buf(20 * x.size(), '\0');
+  // Builds the cached power table outside the timed loop.
+  rigtorp::detail::to_chars_bigint(&buf[0], &buf[0] + buf.size(), x.data(),
+                                   x.size(), threshold);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(buf.data());
+    benchmark::DoNotOptimize(rigtorp::detail::to_chars_bigint(
+        &buf[0], &buf[0] + buf.size(), x.data(), x.size(), threshold));
+    benchmark::ClobberMemory();
+  }
+  state.SetComplexityN(state.range(0));
+}
+
+template <bool Chunked>
+static void BM_rigtorp_from_chars_bigint(benchmark::State &state) {
+  auto x = generate_bigint(state.range(0));
+  const size_t threshold =
+      Chunked ? SIZE_MAX : rigtorp::detail::bigint_from_chars_dc_threshold;
+  std::string s(20 * x.size(), '\0');
+  s.resize(
+      rigtorp::to_chars(&s[0], &s[0] + s.size(), x.data(), x.data() + x.size())
+          .ptr -
+      s.data());
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(x.data());
+    benchmark::DoNotOptimize(rigtorp::detail::from_chars_bigint(
+        s.data(), s.data() + s.size(), x.data(), x.size(), threshold));
+    benchmark::ClobberMemory();
+  }
+  state.SetComplexityN(state.range(0));
+}
+
+template <typename T> static std::string generate_buffer(int digits) {
+  std::string buf;
+  for (const auto &s : generate_strings<T>(digits)) {
+    buf += s;
+    buf += ',';
+  }
+  return buf;
+}
+
+template <typename T>
+static void BM_tokenize_from_chars(benchmark::State &state) {
+  const auto buf = generate_buffer<T>(state.range(0));
+  std::vector<T> values(4096);
+  for (auto _ : state) {
+    const char *p = buf.data();
+    const char *const last = buf.data() + buf.size();
+    T *out = values.data();
+    while (p != last) {
+      const char *q = std::find(p, last, ',');
+      rigtorp::from_chars(p, q, *out++);
+      p = q == last ? q : q + 1;
+    }
+    benchmark::DoNotOptimize(values.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetBytesProcessed(state.iterations() * buf.size());
+  state.SetItemsProcessed(state.iterations() * values.size());
+}
+
+template <typename T>
+static void BM_tokenize_from_chars_prefix(benchmark::State &state) {
+  const auto buf = generate_buffer<T>(state.range(0));
+  std::vector<T> values(4096);
+  for (auto _ : state) {
+    const char *p = buf.data();
+    const char *const last = buf.data() + buf.size();
+    T *out = values.data();
+    while (p != last) {
+      p = rigtorp::from_chars_prefix(p, last, *out++).ptr + 1;
+    }
+    benchmark::DoNotOptimize(values.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetBytesProcessed(state.iterations() * buf.size());
+  state.SetItemsProcessed(state.iterations() * values.size());
+}
+
+template <typename T>
+static void BM_rigtorp_from_chars_many(benchmark::State &state) {
+  const auto buf = generate_buffer<T>(state.range(0));
+  std::vector<T> values(4096);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+        rigtorp::from_chars_many(buf.data(), buf.data() + buf.size(),
+                                 values.data(), values.data() + values.size()));
+    benchmark::ClobberMemory();
+  }
+  state.SetBytesProcessed(state.iterations() * buf.size());
+  state.SetItemsProcessed(state.iterations() * values.size());
+}
+
+template <typename T>
+static void BM_dispatch_from_chars_many(benchmark::State &state) {
+  const auto buf = generate_buffer<T>(state.range(0));
+  std::vector<T> values(4096);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(rigtorp::dispatch::from_chars_many(
+        buf.data(), buf.data() + buf.size(), values.data(),
+        values.data() + values.size()));
+    benchmark::ClobberMemory();
+  }
+  state.SetBytesProcessed(state.iterations() * buf.size());
+  state.SetItemsProcessed(state.iterations() * values.size());
+  state.SetLabel(isa_name(rigtorp::dispatch::selected_isa()));
+}
+
+// Builds messages of 30 comma separated integer fields with state.range(0)
+// digits each.
+static void BM_ostringstream_message(benchmark::State &state) {
+  const auto v = generate_ints<int64_t>(state.range(0));
+  std::ostringstream ss;
+  size_t i = 0;
+  for (auto _ : state) {
+    ss.str({});
+    for (int j = 0; j < 30; ++j) {
+      ss << v[i++ % v.size()] << ',';
+    }
+    benchmark::DoNotOptimize(ss.str());
+  }
+  state.SetItemsProcessed(state.iterations() * 30);
+}
+
+static void BM_rigtorp_to_chars_message(benchmark::State &state) {
+  const auto v = generate_ints<int64_t>(state.range(0));
+  std::array<char, 30 * (rigtorp::max_chars<int64_t> + 1)> buf = {};
+  size_t i = 0;
+  for (auto _ : state) {
+    char *p = buf.data();
+    char *const last = buf.data() + buf.size();
+    for (int j = 0; j < 30; ++j) {
+      p = rigtorp::to_chars(p, last, v[i++ % v.size()]).ptr;
+      if (p != last) {
+        *p++ = ',';
+      }
+    }
+    benchmark::DoNotOptimize(p);
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * 30);
+}
+
+static void BM_rigtorp_char_writer_message(benchmark::State &state) {
+  const auto v = generate_ints<int64_t>(state.range(0));
+  std::string s;
+  size_t i = 0;
+  for (auto _ : state) {
+    s.clear();
+    {
+      rigtorp::char_writer<rigtorp::string_backend<std::string>> w(s);
+      w.reserve(30 * (rigtorp::max_chars<int64_t> + 1));
+      for (int j = 0; j < 30; ++j) {
+        w.append(v[i++ % v.size()]);
+        w.append(',');
+      }
+    }
+    benchmark::DoNotOptimize(s.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * 30);
+}
+
+// Builds "px=<int64> qty=<uint32> side=<char>\n" records with prices of
+// state.range(0) digits.
+static constexpr char record_format[] = "px={} qty={} side={}\n";
+
+struct record {
+  int64_t px;
+  uint32_t qty;
+  char side;
+};
+
+static std::vector<record> generate_records(int digits) {
+  const auto px = generate_ints<int64_t>(digits);
+  const auto qty = generate_ints<uint32_t>(4);
+  std::vector<record> v(px.size());
+  for (size_t i = 0; i < v.size(); ++i) {
+    v[i] = {px[i], qty[i % qty.size()], i % 2 ? 'B' : 'S'};
+  }
+  return v;
+}
+
+static void BM_sprintf_record(benchmark::State &state) {
+  const auto v = generate_records(state.range(0));
+  std::array<char, 64> buf = {};
+  size_t i = 0;
+  for (auto _ : state) {
+    const auto &r = v[i++ % v.size()];
+    benchmark::DoNotOptimize(sprintf(buf.data(), "px=%lld qty=%u side=%c\n",
+                                     static_cast<long long>(r.px), r.qty,
+                                     r.side));
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+static void BM_stringstream_record(benchmark::State &state) {
+  const auto v = generate_records(state.range(0));
+  std::stringstream ss;
+  size_t i = 0;
+  for (auto _ : state) {
+    const auto &r = v[i++ % v.size()];
+    ss.str({});
+    ss << "px=" << r.px << " qty=" << r.qty << " side=" << r.side << '\n';
+    benchmark::DoNotOptimize(ss.str());
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+static void BM_rigtorp_to_chars_record(benchmark::State &state) {
+  const auto v = generate_records(state.range(0));
+  std::array<char, 64> buf = {};
+  size_t i = 0;
+  for (auto _ : state) {
+    const auto &r = v[i++ % v.size()];
+    char *p = buf.data();
+    char *const last = buf.data() + buf.size();
+    std::memcpy(p, "px=", 3);
+    p = rigtorp::to_chars(p + 3, last, r.px).ptr;
+    if (size_t(last - p) < 5) {
+      continue;
+    }
+    std::memcpy(p, " qty=", 5);
+    p = rigtorp::to_chars(p + 5, last, r.qty).ptr;
+    if (size_t(last - p) < 8) {
+      continue;
+    }
+    std::memcpy(p, " side=", 6);
+    p[6] = r.side;
+    p[7] = '\n';
+    benchmark::DoNotOptimize(p + 8);
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+static void BM_rigtorp_format_to_record(benchmark::State &state) {
+  const auto v = generate_records(state.range(0));
+  std::array<char, 64> buf = {};
+  size_t i = 0;
+  for (auto _ : state) {
+    const auto &r = v[i++ % v.size()];
+    benchmark::DoNotOptimize(buf.data());
+    benchmark::DoNotOptimize(rigtorp::format_to<record_format>(
+        buf.data(), buf.data() + buf.size(), r.px, r.qty, r.side));
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+static void BM_rigtorp_char_writer_fd(benchmark::State &state) {
+  const auto v = generate_ints<int64_t>(state.range(0));
+  const int fd = open("/dev/null", O_WRONLY);
+  if (fd == -1) {
+    state.SkipWithError("open failed");
+    return;
+  }
+  {
+    rigtorp::char_writer<rigtorp::fd_backend<>> w(fd);
+    size_t i = 0;
+    for (auto _ : state) {
+      w.reserve(30 * (rigtorp::max_chars<int64_t> + 1));
+      for (int j = 0; j < 30; ++j) {
+        w.append(v[i++ % v.size()]);
+        w.append(',');
+      }
+    }
+  }
+  close(fd);
+  state.SetItemsProcessed(state.iterations() * 30);
+}
+
+// Parses the buffer in chunks of state.range(0) bytes by copying the number
+// split across each chunk boundary into a side buffer.
+template <typename T>
+static void BM_from_chars_many_carry(benchmark::State &state) {
+  const auto buf = generate_buffer<T>(19);
+  const size_t chunk = state.range(0);
+  std::vector<T> values(4096);
+  std::string carry;
+  for (auto _ : state) {
+    T *out = values.data();
+    carry.clear();
+    for (size_t i = 0; i < buf.size(); i += chunk) {
+      const char *first = buf.data() + i;
+      const char *last = buf.data() + std::min(i + chunk, buf.size());
+      const char *p = std::find(first, last, ',');
+      if (p == last) {
+        carry.append(first, last);
+        continue;
+      }
+      if (!carry.empty()) {
+        carry.append(first, p);
+        rigtorp::from_chars(carry.data(), carry.data() + carry.size(), *out++);
+        carry.clear();
+      }
+      const char *tail = last;
+      while (tail[-1] != ',') {
+        --tail;
+      }
+      out += rigtorp::from_chars_many(p, tail, out,
+                                      values.data() + values.size())
+                 .count;
+      carry.assign(tail, last);
+    }
+    benchmark::DoNotOptimize(values.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetBytesProcessed(state.iterations() * buf.size());
+  state.SetItemsProcessed(state.iterations() * values.size());
+}
+
+template <typename T>
+static void BM_rigtorp_from_chars_stream(benchmark::State &state) {
+  const auto buf = generate_buffer<T>(19);
+  const size_t chunk = state.range(0);
+  std::vector<T> values(4096);
+  for (auto _ : state) {
+    rigtorp::from_chars_stream<T> stream;
+    T *out = values.data();
+    for (size_t i = 0; i < buf.size(); i += chunk) {
+      out += stream
+                 .feed(buf.data() + i,
+                       buf.data() + std::min(i + chunk, buf.size()), out,
+                       values.data() + values.size())
+                 .count;
+    }
+    benchmark::DoNotOptimize(values.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetBytesProcessed(state.iterations() * buf.size());
+  state.SetItemsProcessed(state.iterations() * values.size());
+}
+
+// Parses 64 MiB of text with state.range(0) threads.
+template <typename T>
+static void BM_rigtorp_from_chars_parallel(benchmark::State &state) {
+  const auto block = generate_buffer<T>(19);
+  std::string buf;
+  while (buf.size() < (64 << 20)) {
+    buf += block;
+  }
+  std::vector<T> values;
+  for (auto _ : state) {
+    values.clear();
+    benchmark::DoNotOptimize(rigtorp::from_chars_parallel(
+        buf.data(), buf.data() + buf.size(), values, state.range(0)));
+    benchmark::ClobberMemory();
+  }
+  state.SetBytesProcessed(state.iterations() * buf.size());
+  state.SetItemsProcessed(state.iterations() * values.size());
+}
+
+static void Threads(benchmark::internal::Benchmark *b) {
+  const unsigned n = std::max(1u, std::thread::hardware_concurrency());
+  for (unsigned i = 1; i < n; i *= 2) {
+    b->Arg(i);
+  }
+  b->Arg(n);
+}
+
+#if __has_include(<sys/mman.h>)
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+// Parses a 64 MiB file mapped with MADV_SEQUENTIAL in chunks of
+// state.range(0) bytes, summing the values in a callback.
+static void BM_rigtorp_from_chars_stream_mmap(benchmark::State &state) {
+  const auto buf = generate_buffer<uint64_t>(19);
+  char path[] = "/tmp/CharConvBenchmarkXXXXXX";
+  const int fd = mkstemp(path);
+  if (fd == -1) {
+    state.SkipWithError("mkstemp failed");
+    return;
+  }
+  unlink(path);
+  size_t size = 0;
+  while (size < (64 << 20)) {
+    if (write(fd, buf.data(), buf.size()) != ssize_t(buf.size())) {
+      close(fd);
+      state.SkipWithError("write failed");
+      return;
+    }
+    size += buf.size();
+  }
+  void *map = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);
+  if (map == MAP_FAILED) {
+    state.SkipWithError("mmap failed");
+    return;
+  }
+  madvise(map, size, MADV_SEQUENTIAL);
+  const char *data = static_cast<const char *>(map);
+  const size_t chunk = state.range(0);
+  for (auto _ : state) {
+    rigtorp::from_chars_stream<uint64_t> stream;
+    uint64_t sum = 0;
+    const auto add = [&](uint64_t x) { sum += x; };
+    for (size_t i = 0; i < size; i += chunk) {
+      stream.feed(data + i, data + std::min(i + chunk, size), add);
+    }
+    stream.finish(add);
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetBytesProcessed(state.iterations() * size);
+  munmap(map, size);
+}
+
+#endif
+
+#if __has_include(<charconv>)
+
+#include <charconv>
+
+template <typename T> static void BM_std_to_chars(benchmark::State &state) {
+  const auto v = generate_ints<T>(state.range(0));
+  std::array<char, 32> buf = {};
+  int i = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(buf.data());
+    benchmark::DoNotOptimize(
+        std::to_chars(buf.data(), buf.data() + buf.size(), v[i % v.size()]));
+    benchmark::ClobberMemory();
+    ++i;
+  }
+}
+
+template <typename T>
+static void BM_std_to_chars_float(benchmark::State &state) {
+  const auto v = generate_floats<T>(state.range(0));
+  std::array<char, 32> buf = {};
+  int i = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(buf.data());
+    benchmark::DoNotOptimize(
+        std::to_chars(buf.data(), buf.data() + buf.size(), v[i % v.size()]));
+    benchmark::ClobberMemory();
+    ++i;
+  }
+}
+
+template <int Base>
+static void BM_std_to_chars_base(benchmark::State &state) {
+  const auto v = generate_ints<uint64_t>(state.range(0));
+  std::array<char, 80> buf = {};
+  int i = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(buf.data());
+    benchmark::DoNotOptimize(std::to_chars(
+        buf.data(), buf.data() + buf.size(), v[i % v.size()], Base));
+    benchmark::ClobberMemory();
+    ++i;
+  }
+}
+
+template <int Base>
+static void BM_std_from_chars_base(benchmark::State &state) {
+  const auto v = generate_base_strings<Base>(state.range(0));
+  uint64_t val = 0;
+  int i = 0;
+  for (auto _ : state) {
+    const auto &s = v[i % v.size()];
+    benchmark::DoNotOptimize(val);
+    benchmark::DoNotOptimize(
+        std::from_chars(s.data(), s.data() + s.size(), val, Base));
+    ++i;
+  }
+}
+
+template <typename T> static void BM_std_from_chars(benchmark::State &state) {
+  const auto v = generate_strings<T>(state.range(0));
+  T val = 0;
+  int i = 0;
+  for (auto _ : state) {
+    const auto &s = v[i % v.size()];
+    benchmark::DoNotOptimize(val);
+    benchmark::DoNotOptimize(
+        std::from_chars(s.data(), s.data() + s.size(), val));
+    ++i;
+  }
+}
+
+template <typename T>
+static void BM_std_from_chars_float(benchmark::State &state) {
+  const auto v = generate_float_strings<T>(state.range(0));
+  T val = 0;
+  int i = 0;
+  for (auto _ : state) {
+    const auto &s = v[i % v.size()];
+    benchmark::DoNotOptimize(val);
+    benchmark::DoNotOptimize(
+        std::from_chars(s.data(), s.data() + s.size(), val));
+    ++i;
+  }
+}
+
+#endif
+
+// Inputs drawn from the distributions below vary in length from value to
+// value, so unlike the fixed length inputs above the branch predictor cannot
+// learn the length of the next number. The benchmarks taking a distribution
+// report bytes and items per second through the bytes_per_second and
+// items_per_second counters.
+enum distribution : int {
+  uniform_length, // Length uniform over all lengths, digits uniform
+  zipf,           // Small values, value k - 1 with probability ~ 1 / k
+  log_uniform,    // Logarithm uniform, Benford distributed leading digit
+  price_ticks,    // Random walks of a few prices in cents
+  order_ids,      // Interleaved increasing ids from a few sources
+  num_distributions
+};
+
+static const char *const distribution_names[] = {
+    "uniform_length", "zipf", "log_uniform", "price_ticks", "order_ids"};
+
+// Maximum number of digits such that all values of that length fit T.
+template <typename T> static int max_dist_digits() {
+  using UT = rigtorp::detail::make_unsigned_t<T>;
+  UT max = ~UT(0);
+  if (rigtorp::detail::is_signed<T>::value) {
+    max >>= 1;
+  }
+  return rigtorp::detail::to_chars_len(max) - 1;
+}
+
+template <typename T>
+static T random_digits(std::mt19937 &gen, int len, int lead) {
+  T res = lead;
+  for (int i = 1; i < len; ++i) {
+    res = res * 10 + T(gen() % 10);
+  }
+  return res;
+}
+
+template <typename T>
+static std::vector<T> generate_dist_ints(distribution d,
+                                         int digits = max_dist_digits<T>()) {
+  std::mt19937 gen(benchmark_seed + d);
+  std::vector<T> v(4096);
+  std::uniform_int_distribution<int> len(1, digits);
+  const auto random_sign = [&](T x) {
+    if constexpr (rigtorp::detail::is_signed<T>::value) {
+      return gen() % 2 ? T(-x) : x;
+    } else {
+      return x;
+    }
+  };
+  switch (d) {
+  case uniform_length:
+    for (auto &x : v) {
+      const int n = len(gen);
+      const int lead = n == 1 ? gen() % 10 : 1 + gen() % 9;
+      x = random_sign(random_digits<T>(gen, n, lead));
+    }
+    break;
+  case zipf: {
+    std::vector<double> weights(65536);
+    for (size_t k = 0; k < weights.size(); ++k) {
+      weights[k] = 1.0 / (k + 1);
+    }
+    std::discrete_distribution<int> rank(weights.begin(), weights.end());
+    for (auto &x : v) {
+      x = T(rank(gen));
+    }
+    break;
+  }
+  case log_uniform: {
+    std::discrete_distribution<int> lead(
+        {std::log10(2.0 / 1), std::log10(3.0 / 2), std::log10(4.0 / 3),
+         std::log10(5.0 / 4), std::log10(6.0 / 5), std::log10(7.0 / 6),
+         std::log10(8.0 / 7), std::log10(9.0 / 8), std::log10(10.0 / 9)});
+    for (auto &x : v) {
+      x = random_sign(random_digits<T>(gen, len(gen), 1 + lead(gen)));
+    }
+    break;
+  }
+  case price_ticks: {
+    T prices[] = {1234, 98765, 250075, 4512300};
+    for (auto &x : v) {
+      T &p = prices[gen() % 4];
+      const int ticks = gen() % 7;
+      p = p > T(1000) ? p + T(ticks) - T(3) : p + T(ticks);
+      x = p;
+    }
+    break;
+  }
+  case order_ids: {
+    T ids[] = {random_digits<T>(gen, digits, 1 + gen() % 8),
+               random_digits<T>(gen, std::max(1, digits - 3), 1 + gen() % 8),
+               random_digits<T>(gen, std::max(1, digits / 2), 1 + gen() % 8),
+               random_digits<T>(gen, std::min(6, digits), 1 + gen() % 8)};
+    for (auto &x : v) {
+      T &id = ids[gen() % 4];
+      id += T(1 + gen() % 4);
+      x = id;
+    }
+    break;
+  }
+  case num_distributions:
+    break;
+  }
+  return v;
+}
+
+// Prices are in units of 0.01. The other distributions are scaled by a
+// random power of 10 to vary the position of the decimal point.
+template <typename T>
+static std::vector<T> generate_dist_floats(distribution d) {
+  const auto ints = generate_dist_ints<int64_t>(
+      d, std::numeric_limits<T>::digits10);
+  std::mt19937 gen(benchmark_seed + d);
+  std::vector<T> v(ints.size());
+  std::transform(ints.begin(), ints.end(), v.begin(), [&](int64_t x) {
+    const int exp = d == price_ticks ? 2 : gen() % 9;
+    return static_cast<T>(x / std::pow(10.0, exp));
+  });
+  return v;
+}
+
+template <typename T, typename F>
+static std::vector<std::string> to_strings(const std::vector<T> &v, F f) {
+  std::vector<std::string> res(v.size());
+  std::transform(v.begin(), v.end(), res.begin(), [&](T x) {
+    std::array<char, 80> buf = {};
+    return std::string(buf.data(), f(buf.data(), buf.data() + buf.size(), x));
+  });
+  return res;
+}
+
+template <typename T>
+static std::vector<std::string> generate_dist_strings(distribution d) {
+  return to_strings(generate_dist_ints<T>(d), [](char *first, char *last,
+                                                 T x) {
+    return rigtorp::to_chars(first, last, x).ptr;
+  });
+}
+
+static std::string join(const std::vector<std::string> &v) {
+  std::string res;
+  for (const auto &s : v) {
+    res += s;
+    res += ',';
+  }
+  return res;
+}
+
+// Setting CHARCONV_BENCHMARK_PERF enables reading hardware performance
+// counters around the dist benchmarks.
+static bool perf_counters_enabled() {
+  static const bool enabled = [] {
+    if (std::getenv("CHARCONV_BENCHMARK_PERF") == nullptr) {
+      return false;
+    }
+    if (!perf_counters().available()) {
+      std::cerr << "perf events unavailable, counters disabled\n";
+      return false;
+    }
+    return true;
+  }();
+  return enabled;
+}
+
+// Calls f for each value, cycling through v, and reports the throughput. f
+// returns the number of characters written or parsed and converts items
+// values per call. If enabled the hardware events per value are reported.
+template <typename V, typename F>
+static void run_dist(benchmark::State &state, const std::vector<V> &v, F f,
+                     size_t items = 1) {
+  std::unique_ptr<perf_counters> perf;
+  if (perf_counters_enabled()) {
+    perf = std::make_unique<perf_counters>();
+    perf->start();
+  }
+  size_t bytes = 0;
+  size_t i = 0;
+  for (auto _ : state) {
+    bytes += f(v[i % v.size()]);
+    ++i;
+  }
+  if (perf) {
+    perf->stop();
+    for (size_t e = 0; e < perf_counters::num_events; ++e) {
+      if (perf->available(e)) {
+        state.counters[perf_counters::names[e]] =
+            perf->read(e) / double(std::max<size_t>(1, i * items));
+      }
+    }
+  }
+  state.counters["bytes_per_second"] =
+      benchmark::Counter(double(bytes), benchmark::Counter::kIsRate);
+  state.counters["items_per_second"] =
+      benchmark::Counter(double(i * items), benchmark::Counter::kIsRate);
+  state.SetLabel(distribution_names[state.range(0)]);
+}
+
+// Times each call of f with the time stamp counter and reports the p50,
+// p99 and p99.9 latency in nanoseconds. The cost of reading the counter is
+// measured first and subtracted from each sample. If cold is set the L1 and
+// L2 caches are evicted before each call.
+template <typename V, typename F>
+static void run_latency(benchmark::State &state, const std::vector<V> &v,
+                        F f, bool cold = false) {
+  std::unique_ptr<cache_evictor> evictor;
+  if (cold) {
+    evictor = std::make_unique<cache_evictor>();
+  }
+  uint64_t overhead = UINT64_MAX;
+  for (int j = 0; j < 1000; ++j) {
+    const uint64_t t0 = latency_ticks();
+    const uint64_t t1 = latency_ticks();
+    overhead = std::min(overhead, t1 - t0);
+  }
+  latency_histogram<> hist;
+  size_t i = 0;
+  for (auto _ : state) {
+    if (evictor) {
+      evictor->evict();
+    }
+    const uint64_t t0 = latency_ticks();
+    f(v[i % v.size()]);
+    const uint64_t t1 = latency_ticks();
+    hist.record(t1 - t0 - std::min(t1 - t0, overhead));
+    ++i;
+  }
+  const double ticks_per_ns = latency_ticks_per_ns();
+  state.counters["p50_ns"] = hist.percentile(0.5) / ticks_per_ns;
+  state.counters["p99_ns"] = hist.percentile(0.99) / ticks_per_ns;
+  state.counters["p999_ns"] = hist.percentile(0.999) / ticks_per_ns;
+  state.SetLabel(std::string(distribution_names[state.range(0)]) +
+                 (cold ? " cold" : ""));
+}
+
+template <typename T, typename Writer>
+static void BM_dist_rigtorp_to_chars(benchmark::State &state) {
+  const auto v = generate_dist_ints<T>(distribution(state.range(0)));
+  std::array<char, 48> buf = {};
+  run_dist(state, v, [&](T x) {
+    benchmark::DoNotOptimize(buf.data());
+    const auto res = rigtorp::detail::to_chars<T, Writer>(
+        buf.data(), buf.data() + buf.size(), x);
+    benchmark::ClobberMemory();
+    return size_t(res.ptr - buf.data());
+  });
+}
+
+// Reports the fraction of conversions served by the table of small values
+// and by the cache.
+template <typename T>
+static void BM_dist_rigtorp_to_chars_cache(benchmark::State &state) {
+  const auto v = generate_dist_ints<T>(distribution(state.range(0)));
+  std::array<char, 48> buf = {};
+  rigtorp::to_chars_cache<T> cache;
+  run_dist(state, v, [&](T x) {
+    benchmark::DoNotOptimize(buf.data());
+    const auto res = cache.to_chars(buf.data(), buf.data() + buf.size(), x);
+    benchmark::ClobberMemory();
+    return size_t(res.ptr - buf.data());
+  });
+  const double total = double(std::max<uint64_t>(
+      1, cache.small_hits() + cache.hits() + cache.misses()));
+  state.counters["small_hit_rate"] = cache.small_hits() / total;
+  state.counters["hit_rate"] = cache.hits() / total;
+}
+
+template <typename T>
+static void BM_dist_rigtorp_to_chars_backward(benchmark::State &state) {
+  const auto v = generate_dist_ints<T>(distribution(state.range(0)));
+  std::array<char, 48> buf = {};
+  run_dist(state, v, [&](T x) {
+    benchmark::DoNotOptimize(buf.data());
+    const char *p =
+        rigtorp::to_chars_backward(buf.data() + buf.size(), x);
+    benchmark::ClobberMemory();
+    return size_t(buf.data() + buf.size() - p);
+  });
+}
+
+template <int Base>
+static void BM_dist_rigtorp_to_chars_base(benchmark::State &state) {
+  const auto v = generate_dist_ints<uint64_t>(distribution(state.range(0)));
+  std::array<char, 80> buf = {};
+  run_dist(state, v, [&](uint64_t x) {
+    benchmark::DoNotOptimize(buf.data());
+    const auto res =
+        rigtorp::to_chars(buf.data(), buf.data() + buf.size(), x, Base);
+    benchmark::ClobberMemory();
+    return size_t(res.ptr - buf.data());
+  });
+}
+
+template <typename T>
+static void BM_dist_rigtorp_to_chars_float(benchmark::State &state) {
+  const auto v = generate_dist_floats<T>(distribution(state.range(0)));
+  std::array<char, 32> buf = {};
+  run_dist(state, v, [&](T x) {
+    benchmark::DoNotOptimize(buf.data());
+    const auto res = rigtorp::to_chars(buf.data(), buf.data() + buf.size(), x);
+    benchmark::ClobberMemory();
+    return size_t(res.ptr - buf.data());
+  });
+}
+
+static void BM_dist_rigtorp_to_chars_decimal(benchmark::State &state) {
+  const auto v = generate_dist_ints<int64_t>(distribution(state.range(0)));
+  std::array<char, 32> buf = {};
+  run_dist(state, v, [&](int64_t x) {
+    benchmark::DoNotOptimize(buf.data());
+    const auto res =
+        rigtorp::to_chars_decimal<4>(buf.data(), buf.data() + buf.size(), x);
+    benchmark::ClobberMemory();
+    return size_t(res.ptr - buf.data());
+  });
+}
+
+// The many benchmarks convert all 4096 values per iteration.
+template <typename T, bool Dispatch>
+static void BM_dist_rigtorp_to_chars_many(benchmark::State &state) {
+  const auto v = generate_dist_ints<T>(distribution(state.range(0)));
+  std::vector<char> buf(v.size() * (rigtorp::detail::to_chars_max_len<T> + 1));
+  const std::vector<int> batches = {0};
+  run_dist(state, batches, [&](int) {
+    const auto res =
+        Dispatch ? rigtorp::dispatch::to_chars_many(
+                       buf.data(), buf.data() + buf.size(), v.data(),
+                       v.data() + v.size(), ',')
+                 : rigtorp::to_chars_many(buf.data(), buf.data() + buf.size(),
+                                          v.data(), v.data() + v.size(), ',');
+    benchmark::DoNotOptimize(res);
+    benchmark::ClobberMemory();
+    return size_t(res.ptr - buf.data());
+  }, v.size());
+}
+
+template <typename T, typename Parser>
+static void BM_dist_rigtorp_from_chars(benchmark::State &state) {
+  const auto v = generate_dist_strings<T>(distribution(state.range(0)));
+  T val = 0;
+  run_dist(state, v, [&](const std::string &s) {
+    benchmark::DoNotOptimize(val);
+    const auto res = rigtorp::detail::from_chars<T, Parser>(
+        s.data(), s.data() + s.size(), val);
+    benchmark::DoNotOptimize(res);
+    return s.size();
+  });
+}
+
+template <typename T>
+static void BM_dist_rigtorp_from_chars_prefix(benchmark::State &state) {
+  const auto v = generate_dist_strings<T>(distribution(state.range(0)));
+  T val = 0;
+  run_dist(state, v, [&](const std::string &s) {
+    benchmark::DoNotOptimize(val);
+    const auto res =
+        rigtorp::from_chars_prefix(s.data(), s.data() + s.size(), val);
+    benchmark::DoNotOptimize(res);
+    return s.size();
+  });
+}
+
+template <int Base>
+static void BM_dist_rigtorp_from_chars_base(benchmark::State &state) {
+  const auto v = to_strings(
+      generate_dist_ints<uint64_t>(distribution(state.range(0))),
+      [](char *first, char *last, uint64_t x) {
+        return rigtorp::to_chars(first, last, x, Base).ptr;
+      });
+  uint64_t val = 0;
+  run_dist(state, v, [&](const std::string &s) {
+    benchmark::DoNotOptimize(val);
+    const auto res =
+        rigtorp::from_chars(s.data(), s.data() + s.size(), val, Base);
+    benchmark::DoNotOptimize(res);
+    return s.size();
+  });
+}
+
+template <typename T>
+static void BM_dist_rigtorp_from_chars_float(benchmark::State &state) {
+  const auto v = to_strings(
+      generate_dist_floats<T>(distribution(state.range(0))),
+      [](char *first, char *last, T x) {
+        return rigtorp::to_chars(first, last, x).ptr;
+      });
+  T val = 0;
+  run_dist(state, v, [&](const std::string &s) {
+    benchmark::DoNotOptimize(val);
+    const auto res = rigtorp::from_chars(s.data(), s.data() + s.size(), val);
+    benchmark::DoNotOptimize(res);
+    return s.size();
+  });
+}
+
+static void BM_dist_rigtorp_from_chars_decimal(benchmark::State &state) {
+  const auto v = to_strings(
+      generate_dist_ints<int64_t>(distribution(state.range(0))),
+      [](char *first, char *last, int64_t x) {
+        return rigtorp::to_chars_decimal<4>(first, last, x).ptr;
+      });
+  int64_t val = 0;
+  run_dist(state, v, [&](const std::string &s) {
+    benchmark::DoNotOptimize(val);
+    const auto res =
+        rigtorp::from_chars_decimal<4>(s.data(), s.data() + s.size(), val);
+    benchmark::DoNotOptimize(res);
+    return s.size();
+  });
+}
+
+template <typename T, bool Dispatch>
+static void BM_dist_rigtorp_from_chars_many(benchmark::State &state) {
+  const auto buf =
+      join(generate_dist_strings<T>(distribution(state.range(0))));
+  std::vector<T> values(4096);
+  const std::vector<int> batches = {0};
+  run_dist(state, batches, [&](int) {
+    const auto res =
+        Dispatch
+            ? rigtorp::dispatch::from_chars_many(
+                  buf.data(), buf.data() + buf.size(), values.data(),
+                  values.data() + values.size())
+            : rigtorp::from_chars_many(buf.data(), buf.data() + buf.size(),
+                                       values.data(),
+                                       values.data() + values.size());
+    benchmark::DoNotOptimize(res);
+    benchmark::ClobberMemory();
+    return buf.size();
+  }, values.size());
+}
+
+template <typename T, typename Writer>
+static void BM_latency_rigtorp_to_chars(benchmark::State &state) {
+  const auto v = generate_dist_ints<T>(distribution(state.range(0)));
+  std::array<char, 48> buf = {};
+  run_latency(state, v, [&](T x) {
+    benchmark::DoNotOptimize(buf.data());
+    benchmark::DoNotOptimize(rigtorp::detail::to_chars<T, Writer>(
+        buf.data(), buf.data() + buf.size(), x));
+    benchmark::ClobberMemory();
+  });
+}
+
+// Like BM_latency_rigtorp_to_chars but with cold caches, as for a call
+// between unrelated work that evicted the lookup tables.
+template <typename T, typename Writer>
+static void BM_cold_rigtorp_to_chars(benchmark::State &state) {
+  const auto v = generate_dist_ints<T>(distribution(state.range(0)));
+  std::array<char, 48> buf = {};
+  run_latency(
+      state, v,
+      [&](T x) {
+        benchmark::DoNotOptimize(buf.data());
+        benchmark::DoNotOptimize(rigtorp::detail::to_chars<T, Writer>(
+            buf.data(), buf.data() + buf.size(), x));
+        benchmark::ClobberMemory();
+      },
+      true);
+}
+
+template <typename T, typename Parser>
+static void BM_latency_rigtorp_from_chars(benchmark::State &state) {
+  const auto v = generate_dist_strings<T>(distribution(state.range(0)));
+  T val = 0;
+  run_latency(state, v, [&](const std::string &s) {
+    benchmark::DoNotOptimize(val);
+    benchmark::DoNotOptimize(rigtorp::detail::from_chars<T, Parser>(
+        s.data(), s.data() + s.size(), val));
+  });
+}
+
+#if __has_include(<charconv>)
+
+template <typename T>
+static void BM_dist_std_to_chars(benchmark::State &state) {
+  const auto v = generate_dist_ints<T>(distribution(state.range(0)));
+  std::array<char, 32> buf = {};
+  run_dist(state, v, [&](T x) {
+    benchmark::DoNotOptimize(buf.data());
+    const auto res = std::to_chars(buf.data(), buf.data() + buf.size(), x);
+    benchmark::ClobberMemory();
+    return size_t(res.ptr - buf.data());
+  });
+}
+
+template <typename T>
+static void BM_dist_std_from_chars(benchmark::State &state) {
+  const auto v = generate_dist_strings<T>(distribution(state.range(0)));
+  T val = 0;
+  run_dist(state, v, [&](const std::string &s) {
+    benchmark::DoNotOptimize(val);
+    const auto res = std::from_chars(s.data(), s.data() + s.size(), val);
+    benchmark::DoNotOptimize(res);
+    return s.size();
+  });
+}
+
+
+template <typename T>
+static void BM_latency_std_to_chars(benchmark::State &state) {
+  const auto v = generate_dist_ints<T>(distribution(state.range(0)));
+  std::array<char, 32> buf = {};
+  run_latency(state, v, [&](T x) {
+    benchmark::DoNotOptimize(buf.data());
+    benchmark::DoNotOptimize(
+        std::to_chars(buf.data(), buf.data() + buf.size(), x));
+    benchmark::ClobberMemory();
+  });
+}
+
+template <typename T>
+static void BM_latency_std_from_chars(benchmark::State &state) {
+  const auto v = generate_dist_strings<T>(distribution(state.range(0)));
+  T val = 0;
+  run_latency(state, v, [&](const std::string &s) {
+    benchmark::DoNotOptimize(val);
+    benchmark::DoNotOptimize(
+        std::from_chars(s.data(), s.data() + s.size(), val));
+  });
+}
+
+#endif
+
+static void Distributions(benchmark::internal::Benchmark *b) {
+  for (int d = 0; d < num_distributions; ++d) {
+    b->Arg(d);
+  }
+}
+
+template <int N> static void Digits(benchmark::internal::Benchmark *b) {
+  for (int i = 1; i <= N; ++i) {
+    b->Arg(i);
+  }
+}
+
+BENCHMARK(BM_sprintf)->Apply(Digits<9>);
+BENCHMARK(BM_to_string)->Apply(Digits<9>);
+BENCHMARK(BM_stringstream)->Apply(Digits<9>);
+BENCHMARK(BM_ostringstream_message)->Apply(Digits<18>);
+BENCHMARK(BM_rigtorp_to_chars_message)->Apply(Digits<18>);
+BENCHMARK(BM_rigtorp_char_writer_message)->Apply(Digits<18>);
+BENCHMARK(BM_sprintf_record)->Apply(Digits<18>);
+BENCHMARK(BM_stringstream_record)->Apply(Digits<18>);
+BENCHMARK(BM_rigtorp_to_chars_record)->Apply(Digits<18>);
+BENCHMARK(BM_rigtorp_format_to_record)->Apply(Digits<18>);
+BENCHMARK(BM_rigtorp_char_writer_fd)->Apply(Digits<18>);
+#if __has_include(<charconv>)
+BENCHMARK_TEMPLATE(BM_std_to_chars, int32_t)->Apply(Digits<9>);
+BENCHMARK_TEMPLATE(BM_std_to_chars, uint32_t)->Apply(Digits<9>);
+BENCHMARK_TEMPLATE(BM_std_to_chars, int64_t)->Apply(Digits<19>);
+BENCHMARK_TEMPLATE(BM_std_to_chars, uint64_t)->Apply(Digits<19>);
+#endif
+BENCHMARK(BM_rigtorp_to_chars_naive)->Apply(Digits<9>);
+BENCHMARK_TEMPLATE(BM_rigtorp_to_chars, int32_t,
+                   rigtorp::detail::single_digit_writer)
+    ->Apply(Digits<9>);
+BENCHMARK_TEMPLATE(BM_rigtorp_to_chars, int32_t,
+                   rigtorp::detail::digit_pair_writer)
+    ->Apply(Digits<9>);
+BENCHMARK_TEMPLATE(BM_rigtorp_to_chars, int32_t,
+                   rigtorp::detail::multiply_shift_writer)
+    ->Apply(Digits<9>);
+BENCHMARK_TEMPLATE(BM_rigtorp_to_chars, uint32_t,
+                   rigtorp::detail::single_digit_writer)
+    ->Apply(Digits<9>);
+BENCHMARK_TEMPLATE(BM_rigtorp_to_chars, uint32_t,
+                   rigtorp::detail::digit_pair_writer)
+    ->Apply(Digits<9>);
+BENCHMARK_TEMPLATE(BM_rigtorp_to_chars, uint32_t,
+                   rigtorp::detail::multiply_shift_writer)
+    ->Apply(Digits<9>);
+BENCHMARK_TEMPLATE(BM_rigtorp_to_chars, int64_t,
+                   rigtorp::detail::single_digit_writer)
+    ->Apply(Digits<19>);
+BENCHMARK_TEMPLATE(BM_rigtorp_to_chars, int64_t,
+                   rigtorp::detail::digit_pair_writer)
+    ->Apply(Digits<19>);
+BENCHMARK_TEMPLATE(BM_rigtorp_to_chars, int64_t,
+                   rigtorp::detail::multiply_shift_writer)
+    ->Apply(Digits<19>);
+BENCHMARK_TEMPLATE(BM_rigtorp_to_chars, uint64_t,
+                   rigtorp::detail::single_digit_writer)
+    ->Apply(Digits<19>);
+BENCHMARK_TEMPLATE(BM_rigtorp_to_chars, uint64_t,
+                   rigtorp::detail::digit_pair_writer)
+    ->Apply(Digits<19>);
+BENCHMARK_TEMPLATE(BM_rigtorp_to_chars, uint64_t,
+                   rigtorp::detail::multiply_shift_writer)
+    ->Apply(Digits<19>);
+BENCHMARK_TEMPLATE(BM_rigtorp_to_chars_backward, int32_t)->Apply(Digits<9>);
+BENCHMARK_TEMPLATE(BM_rigtorp_to_chars_backward, uint32_t)->Apply(Digits<9>);
+BENCHMARK_TEMPLATE(BM_rigtorp_to_chars_backward, int64_t)->Apply(Digits<19>);
+BENCHMARK_TEMPLATE(BM_rigtorp_to_chars_backward, uint64_t)->Apply(Digits<19>);
+BENCHMARK_TEMPLATE(BM_rigtorp_to_chars, i128,
+                   rigtorp::detail::single_digit_writer)
+    ->Apply(Digits<39>);
+BENCHMARK_TEMPLATE(BM_rigtorp_to_chars, i128,
+                   rigtorp::detail::digit_pair_writer)
+    ->Apply(Digits<39>);
+BENCHMARK_TEMPLATE(BM_rigtorp_to_chars, i128,
+                   rigtorp::detail::multiply_shift_writer)
+    ->Apply(Digits<39>);
+BENCHMARK_TEMPLATE(BM_rigtorp_to_chars, u128,
+                   rigtorp::detail::single_digit_writer)
+    ->Apply(Digits<39>);
+BENCHMARK_TEMPLATE(BM_rigtorp_to_chars, u128,
+                   rigtorp::detail::digit_pair_writer)
+    ->Apply(Digits<39>);
+BENCHMARK_TEMPLATE(BM_rigtorp_to_chars, u128,
+                   rigtorp::detail::multiply_shift_writer)
+    ->Apply(Digits<39>);
+BENCHMARK_TEMPLATE(BM_sprintf_float, float)->Apply(Digits<9>);
+#if __has_include(<charconv>)
+BENCHMARK_TEMPLATE(BM_std_to_chars_float, float)->Apply(Digits<9>);
+#endif
+BENCHMARK_TEMPLATE(BM_rigtorp_to_chars_float, float)->Apply(Digits<9>);
+BENCHMARK_TEMPLATE(BM_sprintf_float, double)->Apply(Digits<17>);
+#if __has_include(<charconv>)
+BENCHMARK_TEMPLATE(BM_std_to_chars_float, double)->Apply(Digits<17>);
+#endif
+BENCHMARK_TEMPLATE(BM_rigtorp_to_chars_float, double)->Apply(Digits<17>);
+BENCHMARK_TEMPLATE(BM_scalar_to_chars_many, int32_t)->Apply(Digits<9>);
+BENCHMARK_TEMPLATE(BM_rigtorp_to_chars_many, int32_t)->Apply(Digits<9>);
+BENCHMARK_TEMPLATE(BM_dispatch_to_chars_many, int32_t)->Apply(Digits<9>);
+BENCHMARK_TEMPLATE(BM_scalar_to_chars_many, uint32_t)->Apply(Digits<9>);
+BENCHMARK_TEMPLATE(BM_rigtorp_to_chars_many, uint32_t)->Apply(Digits<9>);
+BENCHMARK_TEMPLATE(BM_dispatch_to_chars_many, uint32_t)->Apply(Digits<9>);
+BENCHMARK_TEMPLATE(BM_scalar_to_chars_many, int64_t)->Apply(Digits<19>);
+BENCHMARK_TEMPLATE(BM_rigtorp_to_chars_many, int64_t)->Apply(Digits<19>);
+BENCHMARK_TEMPLATE(BM_dispatch_to_chars_many, int64_t)->Apply(Digits<19>);
+BENCHMARK_TEMPLATE(BM_scalar_to_chars_many, uint64_t)->Apply(Digits<19>);
+BENCHMARK_TEMPLATE(BM_rigtorp_to_chars_many, uint64_t)->Apply(Digits<19>);
+BENCHMARK_TEMPLATE(BM_dispatch_to_chars_many, uint64_t)->Apply(Digits<19>);
+BENCHMARK_TEMPLATE(BM_rigtorp_to_chars_padded, 6)->Apply(Digits<6>);
+BENCHMARK_TEMPLATE(BM_rigtorp_to_chars_fixed, 6)->Apply(Digits<6>);
+BENCHMARK_TEMPLATE(BM_rigtorp_to_chars_padded, 9)->Apply(Digits<9>);
+BENCHMARK_TEMPLATE(BM_rigtorp_to_chars_fixed, 9)->Apply(Digits<9>);
+BENCHMARK_TEMPLATE(BM_rigtorp_to_chars_padded, 19)->Apply(Digits<19>);
+BENCHMARK_TEMPLATE(BM_rigtorp_to_chars_fixed, 19)->Apply(Digits<19>);
+#if __has_include(<charconv>)
+BENCHMARK_TEMPLATE(BM_std_to_chars_base, 2)->Apply(Digits<19>);
+#endif
+BENCHMARK_TEMPLATE(BM_rigtorp_to_chars_base, 2)->Apply(Digits<19>);
+#if __has_include(<charconv>)
+BENCHMARK_TEMPLATE(BM_std_to_chars_base, 8)->Apply(Digits<19>);
+#endif
+BENCHMARK_TEMPLATE(BM_rigtorp_to_chars_base, 8)->Apply(Digits<19>);
+#if __has_include(<charconv>)
+BENCHMARK_TEMPLATE(BM_std_to_chars_base, 16)->Apply(Digits<19>);
+#endif
+BENCHMARK_TEMPLATE(BM_rigtorp_to_chars_base, 16)->Apply(Digits<19>);
+#if __has_include(<charconv>)
+BENCHMARK_TEMPLATE(BM_std_to_chars_base, 36)->Apply(Digits<19>);
+#endif
+BENCHMARK_TEMPLATE(BM_rigtorp_to_chars_base, 36)->Apply(Digits<19>);
+BENCHMARK(BM_rigtorp_to_chars_decimal_div)->Apply(Digits<18>);
+BENCHMARK(BM_rigtorp_to_chars_decimal)->Apply(Digits<18>);
+BENCHMARK(BM_atoi)->Apply(Digits<9>);
+BENCHMARK(BM_strtol)->Apply(Digits<9>);
+BENCHMARK(BM_stoi)->Apply(Digits<9>);
+BENCHMARK_TEMPLATE(BM_tokenize_from_chars, int32_t)->Apply(Digits<9>);
+BENCHMARK_TEMPLATE(BM_tokenize_from_chars_prefix, int32_t)
+    ->Apply(Digits<9>);
+BENCHMARK_TEMPLATE(BM_rigtorp_from_chars_many, int32_t)->Apply(Digits<9>);
+BENCHMARK_TEMPLATE(BM_dispatch_from_chars_many, int32_t)
+    ->Apply(Digits<9>);
+BENCHMARK_TEMPLATE(BM_tokenize_from_chars, uint32_t)->Apply(Digits<9>);
+BENCHMARK_TEMPLATE(BM_tokenize_from_chars_prefix, uint32_t)
+    ->Apply(Digits<9>);
+BENCHMARK_TEMPLATE(BM_rigtorp_from_chars_many, uint32_t)->Apply(Digits<9>);
+BENCHMARK_TEMPLATE(BM_dispatch_from_chars_many, uint32_t)
+    ->Apply(Digits<9>);
+BENCHMARK_TEMPLATE(BM_tokenize_from_chars, int64_t)->Apply(Digits<19>);
+BENCHMARK_TEMPLATE(BM_tokenize_from_chars_prefix, int64_t)
+    ->Apply(Digits<19>);
+BENCHMARK_TEMPLATE(BM_rigtorp_from_chars_many, int64_t)->Apply(Digits<19>);
+BENCHMARK_TEMPLATE(BM_dispatch_from_chars_many, int64_t)
+    ->Apply(Digits<19>);
+BENCHMARK_TEMPLATE(BM_tokenize_from_chars, uint64_t)->Apply(Digits<19>);
+BENCHMARK_TEMPLATE(BM_tokenize_from_chars_prefix, uint64_t)
+    ->Apply(Digits<19>);
+BENCHMARK_TEMPLATE(BM_rigtorp_from_chars_many, uint64_t)->Apply(Digits<19>);
+BENCHMARK_TEMPLATE(BM_dispatch_from_chars_many, uint64_t)
+    ->Apply(Digits<19>);
+BENCHMARK_TEMPLATE(BM_from_chars_many_carry, uint64_t)
+    ->RangeMultiplier(8)
+    ->Range(64, 64 << 10);
+BENCHMARK_TEMPLATE(BM_rigtorp_from_chars_stream, uint64_t)
+    ->RangeMultiplier(8)
+    ->Range(64, 64 << 10);
+BENCHMARK_TEMPLATE(BM_rigtorp_from_chars_parallel, uint64_t)
+    ->Apply(Threads)
+    ->UseRealTime();
+#if __has_include(<sys/mman.h>)
+BENCHMARK(BM_rigtorp_from_chars_stream_mmap)
+    ->RangeMultiplier(16)
+    ->Range(4 << 10, 1 << 20);
+#endif
+BENCHMARK_TEMPLATE(BM_rigtorp_from_chars_known_len, 4);
+BENCHMARK_TEMPLATE(BM_rigtorp_from_chars_fixed, 4);
+BENCHMARK_TEMPLATE(BM_rigtorp_from_chars_known_len, 6);
+BENCHMARK_TEMPLATE(BM_rigtorp_from_chars_fixed, 6);
+BENCHMARK_TEMPLATE(BM_rigtorp_from_chars_known_len, 9);
+BENCHMARK_TEMPLATE(BM_rigtorp_from_chars_fixed, 9);
+BENCHMARK_TEMPLATE(BM_rigtorp_from_chars_known_len, 16);
+BENCHMARK_TEMPLATE(BM_rigtorp_from_chars_fixed, 16);
+BENCHMARK_TEMPLATE(BM_rigtorp_from_chars_known_len, 19);
+BENCHMARK_TEMPLATE(BM_rigtorp_from_chars_fixed, 19);
+BENCHMARK(BM_snprintf_timestamp);
+BENCHMARK(BM_rigtorp_to_chars_fixed_timestamp);
+BENCHMARK(BM_rigtorp_to_chars_timestamp);
+BENCHMARK(BM_rigtorp_from_chars_fixed_timestamp);
+BENCHMARK(BM_rigtorp_from_chars_timestamp);
+BENCHMARK_TEMPLATE(BM_rigtorp_to_chars_bigint, true)
+    ->RangeMultiplier(2)
+    ->Range(4, 8192)
+    ->Complexity();
+BENCHMARK_TEMPLATE(BM_rigtorp_to_chars_bigint, false)
+    ->RangeMultiplier(2)
+    ->Range(4, 8192)
+    ->Complexity();
+BENCHMARK_TEMPLATE(BM_rigtorp_from_chars_bigint, true)
+    ->RangeMultiplier(2)
+    ->Range(4, 8192)
+    ->Complexity();
+BENCHMARK_TEMPLATE(BM_rigtorp_from_chars_bigint, false)
+    ->RangeMultiplier(2)
+    ->Range(4, 8192)
+    ->Complexity();
+#if __has_include(<charconv>)
+BENCHMARK_TEMPLATE(BM_std_from_chars, int32_t)->Apply(Digits<9>);
+BENCHMARK_TEMPLATE(BM_std_from_chars, uint32_t)->Apply(Digits<9>);
+BENCHMARK_TEMPLATE(BM_std_from_chars, int64_t)->Apply(Digits<19>);
+BENCHMARK_TEMPLATE(BM_std_from_chars, uint64_t)->Apply(Digits<19>);
+#endif
+BENCHMARK_TEMPLATE(BM_strtoull_base, 2)->Apply(Digits<19>);
+#if __has_include(<charconv>)
+BENCHMARK_TEMPLATE(BM_std_from_chars_base, 2)->Apply(Digits<19>);
+#endif
+BENCHMARK_TEMPLATE(BM_rigtorp_from_chars_base, 2)->Apply(Digits<19>);
+BENCHMARK_TEMPLATE(BM_strtoull_base, 8)->Apply(Digits<19>);
+#if __has_include(<charconv>)
+BENCHMARK_TEMPLATE(BM_std_from_chars_base, 8)->Apply(Digits<19>);
+#endif
+BENCHMARK_TEMPLATE(BM_rigtorp_from_chars_base, 8)->Apply(Digits<19>);
+BENCHMARK_TEMPLATE(BM_strtoull_base, 16)->Apply(Digits<19>);
+#if __has_include(<charconv>)
+BENCHMARK_TEMPLATE(BM_std_from_chars_base, 16)->Apply(Digits<19>);
+#endif
+BENCHMARK_TEMPLATE(BM_rigtorp_from_chars_base, 16)->Apply(Digits<19>);
+BENCHMARK_TEMPLATE(BM_strtoull_base, 36)->Apply(Digits<19>);
+#if __has_include(<charconv>)
+BENCHMARK_TEMPLATE(BM_std_from_chars_base, 36)->Apply(Digits<19>);
+#endif
+BENCHMARK_TEMPLATE(BM_rigtorp_from_chars_base, 36)->Apply(Digits<19>);
+BENCHMARK(BM_rigtorp_from_chars_decimal_split)->Apply(Digits<18>);
+BENCHMARK(BM_rigtorp_from_chars_decimal)->Apply(Digits<18>);
+BENCHMARK_TEMPLATE(BM_strtod, float)->Apply(Digits<9>);
+#if __has_include(<charconv>)
+BENCHMARK_TEMPLATE(BM_std_from_chars_float, float)->Apply(Digits<9>);
+#endif
+BENCHMARK_TEMPLATE(BM_rigtorp_from_chars_float, float)->Apply(Digits<9>);
+BENCHMARK_TEMPLATE(BM_strtod, double)->Apply(Digits<17>);
+#if __has_include(<charconv>)
+BENCHMARK_TEMPLATE(BM_std_from_chars_float, double)->Apply(Digits<17>);
+#endif
+BENCHMARK_TEMPLATE(BM_rigtorp_from_chars_float, double)->Apply(Digits<17>);
+BENCHMARK(BM_rigtorp_from_chars_unchecked)->Apply(Digits<9>);
+BENCHMARK_TEMPLATE(BM_rigtorp_from_chars, int32_t,
+                   rigtorp::detail::scalar_digit_parser)
+    ->Apply(Digits<9>);
+BENCHMARK_TEMPLATE(BM_rigtorp_from_chars, int32_t,
+                   rigtorp::detail::swar_digit_parser)
+    ->Apply(Digits<9>);
+BENCHMARK_TEMPLATE(BM_rigtorp_from_chars, uint32_t,
+                   rigtorp::detail::scalar_digit_parser)
+    ->Apply(Digits<9>);
+BENCHMARK_TEMPLATE(BM_rigtorp_from_chars, uint32_t,
+                   rigtorp::detail::swar_digit_parser)
+    ->Apply(Digits<9>);
+BENCHMARK_TEMPLATE(BM_rigtorp_from_chars, int64_t,
+                   rigtorp::detail::scalar_digit_parser)
+    ->Apply(Digits<19>);
+BENCHMARK_TEMPLATE(BM_rigtorp_from_chars, int64_t,
+                   rigtorp::detail::swar_digit_parser)
+    ->Apply(Digits<19>);
+BENCHMARK_TEMPLATE(BM_rigtorp_from_chars, uint64_t,
+                   rigtorp::detail::scalar_digit_parser)
+    ->Apply(Digits<19>);
+BENCHMARK_TEMPLATE(BM_rigtorp_from_chars, uint64_t,
+                   rigtorp::detail::swar_digit_parser)
+    ->Apply(Digits<19>);
+BENCHMARK_TEMPLATE(BM_rigtorp_from_chars, i128,
+                   rigtorp::detail::scalar_digit_parser)
+    ->Apply(Digits<39>);
+BENCHMARK_TEMPLATE(BM_rigtorp_from_chars, i128,
+                   rigtorp::detail::swar_digit_parser)
+    ->Apply(Digits<39>);
+BENCHMARK_TEMPLATE(BM_rigtorp_from_chars, u128,
+                   rigtorp::detail::scalar_digit_parser)
+    ->Apply(Digits<39>);
+BENCHMARK_TEMPLATE(BM_rigtorp_from_chars, u128,
+                   rigtorp::detail::swar_digit_parser)
+    ->Apply(Digits<39>);
+
+#if __has_include(<charconv>)
+BENCHMARK_TEMPLATE(BM_dist_std_to_chars, int32_t)->Apply(Distributions);
+#endif
+BENCHMARK_TEMPLATE(BM_dist_rigtorp_to_chars, int32_t,
+                   rigtorp::detail::single_digit_writer)
+    ->Apply(Distributions);
+BENCHMARK_TEMPLATE(BM_dist_rigtorp_to_chars, int32_t,
+                   rigtorp::detail::digit_pair_writer)
+    ->Apply(Distributions);
+BENCHMARK_TEMPLATE(BM_dist_rigtorp_to_chars, int32_t,
+                   rigtorp::detail::multiply_shift_writer)
+    ->Apply(Distributions);
+BENCHMARK_TEMPLATE(BM_dist_rigtorp_to_chars_cache, int32_t)
+    ->Apply(Distributions);
+BENCHMARK_TEMPLATE(BM_dist_rigtorp_to_chars_backward, int32_t)
+    ->Apply(Distributions);
+BENCHMARK_TEMPLATE(BM_dist_rigtorp_to_chars_many, int32_t, false)
+    ->Apply(Distributions);
+BENCHMARK_TEMPLATE(BM_dist_rigtorp_to_chars_many, int32_t, true)
+    ->Apply(Distributions);
+#if __has_include(<charconv>)
+BENCHMARK_TEMPLATE(BM_dist_std_to_chars, uint32_t)->Apply(Distributions);
+#endif
+BENCHMARK_TEMPLATE(BM_dist_rigtorp_to_chars, uint32_t,
+                   rigtorp::detail::single_digit_writer)
+    ->Apply(Distributions);
+BENCHMARK_TEMPLATE(BM_dist_rigtorp_to_chars, uint32_t,
+                   rigtorp::detail::digit_pair_writer)
+    ->Apply(Distributions);
+BENCHMARK_TEMPLATE(BM_dist_rigtorp_to_chars, uint32_t,
+                   rigtorp::detail::multiply_shift_writer)
+    ->Apply(Distributions);
+BENCHMARK_TEMPLATE(BM_dist_rigtorp_to_chars_cache, uint32_t)
+    ->Apply(Distributions);
+BENCHMARK_TEMPLATE(BM_dist_rigtorp_to_chars_backward, uint32_t)
+    ->Apply(Distributions);
+BENCHMARK_TEMPLATE(BM_dist_rigtorp_to_chars_many, uint32_t, false)
+    ->Apply(Distributions);
+BENCHMARK_TEMPLATE(BM_dist_rigtorp_to_chars_many, uint32_t, true)
+    ->Apply(Distributions);
+#if __has_include(<charconv>)
+BENCHMARK_TEMPLATE(BM_dist_std_to_chars, int64_t)->Apply(Distributions);
+#endif
+BENCHMARK_TEMPLATE(BM_dist_rigtorp_to_chars, int64_t,
+                   rigtorp::detail::single_digit_writer)
+    ->Apply(Distributions);
+BENCHMARK_TEMPLATE(BM_dist_rigtorp_to_chars, int64_t,
+                   rigtorp::detail::digit_pair_writer)
+    ->Apply(Distributions);
+BENCHMARK_TEMPLATE(BM_dist_rigtorp_to_chars, int64_t,
+                   rigtorp::detail::multiply_shift_writer)
+    ->Apply(Distributions);
+BENCHMARK_TEMPLATE(BM_dist_rigtorp_to_chars_cache, int64_t)
+    ->Apply(Distributions);
+BENCHMARK_TEMPLATE(BM_dist_rigtorp_to_chars_backward, int64_t)
+    ->Apply(Distributions);
+BENCHMARK_TEMPLATE(BM_dist_rigtorp_to_chars_many, int64_t, false)
+    ->Apply(Distributions);
+BENCHMARK_TEMPLATE(BM_dist_rigtorp_to_chars_many, int64_t, true)
+    ->Apply(Distributions);
+#if __has_include(<charconv>)
+BENCHMARK_TEMPLATE(BM_dist_std_to_chars, uint64_t)->Apply(Distributions);
+#endif
+BENCHMARK_TEMPLATE(BM_dist_rigtorp_to_chars, uint64_t,
+                   rigtorp::detail::single_digit_writer)
+    ->Apply(Distributions);
+BENCHMARK_TEMPLATE(BM_dist_rigtorp_to_chars, uint64_t,
+                   rigtorp::detail::digit_pair_writer)
+    ->Apply(Distributions);
+BENCHMARK_TEMPLATE(BM_dist_rigtorp_to_chars, uint64_t,
+                   rigtorp::detail::multiply_shift_writer)
+    ->Apply(Distributions);
+BENCHMARK_TEMPLATE(BM_dist_rigtorp_to_chars_cache, uint64_t)
+    ->Apply(Distributions);
+BENCHMARK_TEMPLATE(BM_dist_rigtorp_to_chars_backward, uint64_t)
+    ->Apply(Distributions);
+BENCHMARK_TEMPLATE(BM_dist_rigtorp_to_chars_many, uint64_t, false)
+    ->Apply(Distributions);
+BENCHMARK_TEMPLATE(BM_dist_rigtorp_to_chars_many, uint64_t, true)
+    ->Apply(Distributions);
+BENCHMARK_TEMPLATE(BM_dist_rigtorp_to_chars, i128,
+                   rigtorp::detail::single_digit_writer)
+    ->Apply(Distributions);
+BENCHMARK_TEMPLATE(BM_dist_rigtorp_to_chars, i128,
+                   rigtorp::detail::digit_pair_writer)
+    ->Apply(Distributions);
+BENCHMARK_TEMPLATE(BM_dist_rigtorp_to_chars, i128,
+                   rigtorp::detail::multiply_shift_writer)
+    ->Apply(Distributions);
+BENCHMARK_TEMPLATE(BM_dist_rigtorp_to_chars_backward, i128)
+    ->Apply(Distributions);
+BENCHMARK_TEMPLATE(BM_dist_rigtorp_to_chars, u128,
+                   rigtorp::detail::single_digit_writer)
+    ->Apply(Distributions);
+BENCHMARK_TEMPLATE(BM_dist_rigtorp_to_chars, u128,
+                   rigtorp::detail::digit_pair_writer)
+    ->Apply(Distributions);
+BENCHMARK_TEMPLATE(BM_dist_rigtorp_to_chars, u128,
+                   rigtorp::detail::multiply_shift_writer)
+    ->Apply(Distributions);
+BENCHMARK_TEMPLATE(BM_dist_rigtorp_to_chars_backward, u128)
+    ->Apply(Distributions);
+BENCHMARK_TEMPLATE(BM_dist_rigtorp_to_chars_base, 16)->Apply(Distributions);
+BENCHMARK_TEMPLATE(BM_dist_rigtorp_to_chars_float, float)
+    ->Apply(Distributions);
+BENCHMARK_TEMPLATE(BM_dist_rigtorp_to_chars_float, double)
+    ->Apply(Distributions);
+BENCHMARK(BM_dist_rigtorp_to_chars_decimal)->Apply(Distributions);
+#if __has_include(<charconv>)
+BENCHMARK_TEMPLATE(BM_dist_std_from_chars, int32_t)->Apply(Distributions);
+#endif
+BENCHMARK_TEMPLATE(BM_dist_rigtorp_from_chars, int32_t,
+                   rigtorp::detail::scalar_digit_parser)
+    ->Apply(Distributions);
+BENCHMARK_TEMPLATE(BM_dist_rigtorp_from_chars, int32_t,
+                   rigtorp::detail::swar_digit_parser)
+    ->Apply(Distributions);
+BENCHMARK_TEMPLATE(BM_dist_rigtorp_from_chars_prefix, int32_t)
+    ->Apply(Distributions);
+BENCHMARK_TEMPLATE(BM_dist_rigtorp_from_chars_many, int32_t, false)
+    ->Apply(Distributions);
+BENCHMARK_TEMPLATE(BM_dist_rigtorp_from_chars_many, int32_t, true)
+    ->Apply(Distributions);
+#if __has_include(<charconv>)
+BENCHMARK_TEMPLATE(BM_dist_std_from_chars, uint32_t)->Apply(Distributions);
+#endif
+BENCHMARK_TEMPLATE(BM_dist_rigtorp_from_chars, uint32_t,
+                   rigtorp::detail::scalar_digit_parser)
+    ->Apply(Distributions);
+BENCHMARK_TEMPLATE(BM_dist_rigtorp_from_chars, uint32_t,
+                   rigtorp::detail::swar_digit_parser)
+    ->Apply(Distributions);
+BENCHMARK_TEMPLATE(BM_dist_rigtorp_from_chars_prefix, uint32_t)
+    ->Apply(Distributions);
+BENCHMARK_TEMPLATE(BM_dist_rigtorp_from_chars_many, uint32_t, false)
+    ->Apply(Distributions);
+BENCHMARK_TEMPLATE(BM_dist_rigtorp_from_chars_many, uint32_t, true)
+    ->Apply(Distributions);
+#if __has_include(<charconv>)
+BENCHMARK_TEMPLATE(BM_dist_std_from_chars, int64_t)->Apply(Distributions);
+#endif
+BENCHMARK_TEMPLATE(BM_dist_rigtorp_from_chars, int64_t,
+                   rigtorp::detail::scalar_digit_parser)
+    ->Apply(Distributions);
+BENCHMARK_TEMPLATE(BM_dist_rigtorp_from_chars, int64_t,
+                   rigtorp::detail::swar_digit_parser)
+    ->Apply(Distributions);
+BENCHMARK_TEMPLATE(BM_dist_rigtorp_from_chars_prefix, int64_t)
+    ->Apply(Distributions);
+BENCHMARK_TEMPLATE(BM_dist_rigtorp_from_chars_many, int64_t, false)
+    ->Apply(Distributions);
+BENCHMARK_TEMPLATE(BM_dist_rigtorp_from_chars_many, int64_t, true)
+    ->Apply(Distributions);
+#if __has_include(<charconv>)
+BENCHMARK_TEMPLATE(BM_dist_std_from_chars, uint64_t)->Apply(Distributions);
+#endif
+BENCHMARK_TEMPLATE(BM_dist_rigtorp_from_chars, uint64_t,
+                   rigtorp::detail::scalar_digit_parser)
+    ->Apply(Distributions);
+BENCHMARK_TEMPLATE(BM_dist_rigtorp_from_chars, uint64_t,
+                   rigtorp::detail::swar_digit_parser)
+    ->Apply(Distributions);
+BENCHMARK_TEMPLATE(BM_dist_rigtorp_from_chars_prefix, uint64_t)
+    ->Apply(Distributions);
+BENCHMARK_TEMPLATE(BM_dist_rigtorp_from_chars_many, uint64_t, false)
+    ->Apply(Distributions);
+BENCHMARK_TEMPLATE(BM_dist_rigtorp_from_chars_many, uint64_t, true)
+    ->Apply(Distributions);
+BENCHMARK_TEMPLATE(BM_dist_rigtorp_from_chars, i128,
+                   rigtorp::detail::scalar_digit_parser)
+    ->Apply(Distributions);
+BENCHMARK_TEMPLATE(BM_dist_rigtorp_from_chars, i128,
+                   rigtorp::detail::swar_digit_parser)
+    ->Apply(Distributions);
+BENCHMARK_TEMPLATE(BM_dist_rigtorp_from_chars_prefix, i128)
+    ->Apply(Distributions);
+BENCHMARK_TEMPLATE(BM_dist_rigtorp_from_chars, u128,
+                   rigtorp::detail::scalar_digit_parser)
+    ->Apply(Distributions);
+BENCHMARK_TEMPLATE(BM_dist_rigtorp_from_chars, u128,
+                   rigtorp::detail::swar_digit_parser)
+    ->Apply(Distributions);
+BENCHMARK_TEMPLATE(BM_dist_rigtorp_from_chars_prefix, u128)
+    ->Apply(Distributions);
+BENCHMARK_TEMPLATE(BM_dist_rigtorp_from_chars_base, 16)
+    ->Apply(Distributions);
+BENCHMARK_TEMPLATE(BM_dist_rigtorp_from_chars_float, float)
+    ->Apply(Distributions);
+BENCHMARK_TEMPLATE(BM_dist_rigtorp_from_chars_float, double)
+    ->Apply(Distributions);
+BENCHMARK(BM_dist_rigtorp_from_chars_decimal)->Apply(Distributions);
+
+#if __has_include(<charconv>)
+BENCHMARK_TEMPLATE(BM_latency_std_to_chars, uint64_t)->Apply(Distributions);
+#endif
+BENCHMARK_TEMPLATE(BM_latency_rigtorp_to_chars, uint64_t,
+                   rigtorp::detail::single_digit_writer)
+    ->Apply(Distributions);
+BENCHMARK_TEMPLATE(BM_latency_rigtorp_to_chars, uint64_t,
+                   rigtorp::detail::digit_pair_writer)
+    ->Apply(Distributions);
+BENCHMARK_TEMPLATE(BM_latency_rigtorp_to_chars, uint64_t,
+                   rigtorp::detail::multiply_shift_writer)
+    ->Apply(Distributions);
+BENCHMARK_TEMPLATE(BM_cold_rigtorp_to_chars, uint32_t,
+                   rigtorp::detail::digit_pair_writer)
+    ->Apply(Distributions);
+BENCHMARK_TEMPLATE(BM_cold_rigtorp_to_chars, uint32_t,
+                   rigtorp::detail::multiply_shift_writer)
+    ->Apply(Distributions);
+BENCHMARK_TEMPLATE(BM_cold_rigtorp_to_chars, uint64_t,
+                   rigtorp::detail::digit_pair_writer)
+    ->Apply(Distributions);
+BENCHMARK_TEMPLATE(BM_cold_rigtorp_to_chars, uint64_t,
+                   rigtorp::detail::multiply_shift_writer)
+    ->Apply(Distributions);
+#if __has_include(<charconv>)
+BENCHMARK_TEMPLATE(BM_latency_std_from_chars, uint64_t)
+    ->Apply(Distributions);
+#endif
+BENCHMARK_TEMPLATE(BM_latency_rigtorp_from_chars, uint64_t,
+                   rigtorp::detail::scalar_digit_parser)
+    ->Apply(Distributions);
+BENCHMARK_TEMPLATE(BM_latency_rigtorp_from_chars, uint64_t,
+                   rigtorp::detail::swar_digit_parser)
+    ->Apply(Distributions);
 
 BENCHMARK_MAIN();
\ No newline at end of file
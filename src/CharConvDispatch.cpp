@@ -0,0 +1,226 @@
+/*
+Copyright (c) 2018 Erik Rigtorp <erik@rigtorp.se>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+ */
+
+
+#include "CharConvDispatchKernels.h"
+
+#include <rigtorp/CharConvParallel.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+
+namespace rigtorp {
+namespace dispatch {
+
+extern const kernel_table generic_kernels =
+    make_kernel_table(isa::generic);
+
+namespace {
+
+isa supported_isa() noexcept {
+#if defined(RIGTORP_CHARCONV_DISPATCH_X86)
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx2")) {
+    return isa::avx2;
+  }
+  if (__builtin_cpu_supports("sse4.1")) {
+    return isa::sse41;
+  }
+#endif
+  return isa::generic;
+}
+
+// Returns the level named by RIGTORP_CHARCONV_ISA in level. Returns false if
+// it is unset or not one of generic, sse4.1 or avx2, in which case it is
+// ignored.
+bool requested_isa(isa &level) noexcept {
+  const char *env = std::getenv("RIGTORP_CHARCONV_ISA");
+  if (env == nullptr) {
+    return false;
+  }
+  if (std::strcmp(env, "generic") == 0) {
+    level = isa::generic;
+    return true;
+  }
+  if (std::strcmp(env, "sse4.1") == 0) {
+    level = isa::sse41;
+    return true;
+  }
+  if (std::strcmp(env, "avx2") == 0) {
+    level = isa::avx2;
+    return true;
+  }
+  return false;
+}
+
+const kernel_table *select_kernels() noexcept {
+  isa level = supported_isa();
+  isa requested;
+  if (requested_isa(requested)) {
+    level = std::min(level, requested);
+  }
+#if defined(RIGTORP_CHARCONV_DISPATCH_X86)
+  switch (level) {
+  case isa::avx2:
+    return &avx2_kernels;
+  case isa::sse41:
+    return &sse41_kernels;
+  case isa::generic:
+    break;
+  }
+#endif
+  (void)level;
+  return &generic_kernels;
+}
+
+const kernel_table &kernels() noexcept {
+  static const kernel_table *const selected = select_kernels();
+  return *selected;
+}
+
+} // namespace
+
+isa selected_isa() noexcept { return kernels().level; }
+
+to_chars_result to_chars_many(char *first, char *last,
+                              const uint32_t *values_first,
+                              const uint32_t *values_last, char delimiter,
+                              size_t *offsets) noexcept {
+  return kernels().to_chars_many_u32(first, last, values_first, values_last,
+                                     delimiter, offsets);
+}
+
+to_chars_result to_chars_many(char *first, char *last,
+                              const int32_t *values_first,
+                              const int32_t *values_last, char delimiter,
+                              size_t *offsets) noexcept {
+  return kernels().to_chars_many_i32(first, last, values_first, values_last,
+                                     delimiter, offsets);
+}
+
+to_chars_result to_chars_many(char *first, char *last,
+                              const uint64_t *values_first,
+                              const uint64_t *values_last, char delimiter,
+                              size_t *offsets) noexcept {
+  return kernels().to_chars_many_u64(first, last, values_first, values_last,
+                                     delimiter, offsets);
+}
+
+to_chars_result to_chars_many(char *first, char *last,
+                              const int64_t *values_first,
+                              const int64_t *values_last, char delimiter,
+                              size_t *offsets) noexcept {
+  return kernels().to_chars_many_i64(first, last, values_first, values_last,
+                                     delimiter, offsets);
+}
+
+from_chars_many_result from_chars_many(const char *first, const char *last,
+                                       uint32_t *values_first,
+                                       uint32_t *values_last) noexcept {
+  return kernels().from_chars_many_u32(first, last, values_first,
+                                       values_last);
+}
+
+from_chars_many_result from_chars_many(const char *first, const char *last,
+                                       int32_t *values_first,
+                                       int32_t *values_last) noexcept {
+  return kernels().from_chars_many_i32(first, last, values_first,
+                                       values_last);
+}
+
+from_chars_many_result from_chars_many(const char *first, const char *last,
+                                       uint64_t *values_first,
+                                       uint64_t *values_last) noexcept {
+  return kernels().from_chars_many_u64(first, last, values_first,
+                                       values_last);
+}
+
+from_chars_many_result from_chars_many(const char *first, const char *last,
+                                       int64_t *values_first,
+                                       int64_t *values_last) noexcept {
+  return kernels().from_chars_many_i64(first, last, values_first,
+                                       values_last);
+}
+
+from_chars_many_result from_chars_parallel(const char *first, const char *last,
+                                           std::vector<uint32_t> &values,
+                                           unsigned threads,
+                                           size_t block_size) {
+  return rigtorp::from_chars_parallel<uint32_t, from_chars_many_parser>(
+      first, last, values, threads, block_size);
+}
+
+from_chars_many_result from_chars_parallel(const char *first, const char *last,
+                                           std::vector<int32_t> &values,
+                                           unsigned threads,
+                                           size_t block_size) {
+  return rigtorp::from_chars_parallel<int32_t, from_chars_many_parser>(
+      first, last, values, threads, block_size);
+}
+
+from_chars_many_result from_chars_parallel(const char *first, const char *last,
+                                           std::vector<uint64_t> &values,
+                                           unsigned threads,
+                                           size_t block_size) {
+  return rigtorp::from_chars_parallel<uint64_t, from_chars_many_parser>(
+      first, last, values, threads, block_size);
+}
+
+from_chars_many_result from_chars_parallel(const char *first, const char *last,
+                                           std::vector<int64_t> &values,
+                                           unsigned threads,
+                                           size_t block_size) {
+  return rigtorp::from_chars_parallel<int64_t, from_chars_many_parser>(
+      first, last, values, threads, block_size);
+}
+
+from_chars_file_result from_chars_file(const char *path,
+                                       std::vector<uint32_t> &values,
+                                       unsigned threads) {
+  return rigtorp::from_chars_file<uint32_t, from_chars_many_parser>(
+      path, values, threads);
+}
+
+from_chars_file_result from_chars_file(const char *path,
+                                       std::vector<int32_t> &values,
+                                       unsigned threads) {
+  return rigtorp::from_chars_file<int32_t, from_chars_many_parser>(
+      path, values, threads);
+}
+
+from_chars_file_result from_chars_file(const char *path,
+                                       std::vector<uint64_t> &values,
+                                       unsigned threads) {
+  return rigtorp::from_chars_file<uint64_t, from_chars_many_parser>(
+      path, values, threads);
+}
+
+from_chars_file_result from_chars_file(const char *path,
+                                       std::vector<int64_t> &values,
+                                       unsigned threads) {
+  return rigtorp::from_chars_file<int64_t, from_chars_many_parser>(
+      path, values, threads);
+}
+
+} // namespace dispatch
+} // namespace rigtorp
@@ -0,0 +1,78 @@
+/*
+Copyright (c) 2018 Erik Rigtorp <erik@rigtorp.se>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+ */
+
+
+#pragma once
+
+#include <rigtorp/CharConvDispatch.h>
+
+namespace rigtorp {
+namespace dispatch {
+
+template <typename T>
+using to_chars_many_fn = to_chars_result (*)(char *, char *, const T *,
+                                             const T *, char,
+                                             size_t *) noexcept;
+
+template <typename T>
+using from_chars_many_fn = from_chars_many_result (*)(const char *,
+                                                      const char *, T *,
+                                                      T *) noexcept;
+
+// The batch conversions compiled for one instruction set.
+struct kernel_table {
+  isa level;
+  to_chars_many_fn<uint32_t> to_chars_many_u32;
+  to_chars_many_fn<int32_t> to_chars_many_i32;
+  to_chars_many_fn<uint64_t> to_chars_many_u64;
+  to_chars_many_fn<int64_t> to_chars_many_i64;
+  from_chars_many_fn<uint32_t> from_chars_many_u32;
+  from_chars_many_fn<int32_t> from_chars_many_i32;
+  from_chars_many_fn<uint64_t> from_chars_many_u64;
+  from_chars_many_fn<int64_t> from_chars_many_i64;
+};
+
+extern const kernel_table generic_kernels;
+extern const kernel_table sse41_kernels;
+extern const kernel_table avx2_kernels;
+
+namespace {
+
+// Returns the kernels of the including translation unit. CharConv.h declares
+// them in a namespace named after the -m flags of the translation unit, so
+// each kernel source instantiates its own copies.
+constexpr kernel_table make_kernel_table(isa level) noexcept {
+  return {level,
+          &detail::to_chars_many<uint32_t>,
+          &detail::to_chars_many<int32_t>,
+          &detail::to_chars_many<uint64_t>,
+          &detail::to_chars_many<int64_t>,
+          &detail::from_chars_many<uint32_t>,
+          &detail::from_chars_many<int32_t>,
+          &detail::from_chars_many<uint64_t>,
+          &detail::from_chars_many<int64_t>};
+}
+
+} // namespace
+
+} // namespace dispatch
+} // namespace rigtorp
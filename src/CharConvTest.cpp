@@ -21,7 +21,27 @@ SOFTWARE.
  */
 
 #include <catch2/catch.hpp>
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <random>
 #include <rigtorp/CharConv.h>
+#include <rigtorp/CharConvBigInt.h>
+#include <rigtorp/CharConvCache.h>
+#include <rigtorp/CharConvDispatch.h>
+#include <rigtorp/CharConvParallel.h>
+#include <rigtorp/CharFormat.h>
+#include <rigtorp/CharWriter.h>
+
+#if __has_include(<charconv>)
+#include <charconv>
+#endif
+
+__extension__ typedef __int128 i128;
+__extension__ typedef unsigned __int128 u128;
 
 template <typename T> bool check_to_chars(T value, std::string_view expected) {
   using namespace rigtorp;
@@ -114,6 +134,506 @@ TEST_CASE("to_chars") {
   }
 }
 
+template <typename T, typename Writer>
+bool check_to_chars_writer(T value, std::string_view expected) {
+  std::array<char, 48> buf = {};
+  const auto res = rigtorp::detail::to_chars<T, Writer>(
+      buf.begin(), buf.end(), value);
+  return res.ec == std::errc{} && (res.ptr == buf.end() || *res.ptr == 0) &&
+         buf.data() == expected;
+}
+
+TEST_CASE("to_chars writers") {
+  using namespace rigtorp::detail;
+
+  uint64_t val = 1;
+  for (int i = 0; i < 20; ++i) {
+    CHECK(check_to_chars_writer<uint64_t, single_digit_writer>(
+        val, std::to_string(val)));
+    CHECK(check_to_chars_writer<uint64_t, digit_pair_writer>(
+        val, std::to_string(val)));
+    CHECK(check_to_chars_writer<uint64_t, digit_pair_writer>(
+        val - 1, std::to_string(val - 1)));
+    CHECK(check_to_chars_writer<uint64_t, digit_pair_writer>(
+        val + 1, std::to_string(val + 1)));
+    CHECK(check_to_chars_writer<uint32_t, digit_pair_writer>(
+        uint32_t(val), std::to_string(uint32_t(val))));
+    CHECK(check_to_chars_writer<int64_t, digit_pair_writer>(
+        -int64_t(val / 2), std::to_string(-int64_t(val / 2))));
+    val *= 10;
+  }
+  CHECK(check_to_chars_writer<uint64_t, digit_pair_writer>(
+      std::numeric_limits<uint64_t>::max(), "18446744073709551615"));
+  CHECK(check_to_chars_writer<int64_t, digit_pair_writer>(
+      std::numeric_limits<int64_t>::min(), "-9223372036854775808"));
+  CHECK(check_to_chars_writer<int32_t, digit_pair_writer>(
+      std::numeric_limits<int32_t>::min(), "-2147483648"));
+
+  SECTION("multiply_shift_writer") {
+    // Lengths of 32-bit values are tested exhaustively around each power
+    // of 10 and every 997th value otherwise.
+    for (uint64_t v = 0; v <= UINT32_MAX; v += 997) {
+      REQUIRE(check_to_chars_writer<uint32_t, multiply_shift_writer>(
+          uint32_t(v), std::to_string(v)));
+    }
+    uint64_t p = 1;
+    for (int i = 0; i < 20; ++i) {
+      for (uint64_t v = p - std::min<uint64_t>(p, 1000); v < p + 1000; ++v) {
+        REQUIRE(check_to_chars_writer<uint64_t, multiply_shift_writer>(
+            v, std::to_string(v)));
+        if (v <= UINT32_MAX) {
+          REQUIRE(check_to_chars_writer<uint32_t, multiply_shift_writer>(
+              uint32_t(v), std::to_string(v)));
+        }
+      }
+      p *= 10;
+    }
+    std::mt19937_64 gen(20);
+    for (int i = 0; i < 100000; ++i) {
+      const uint64_t v = gen() >> (gen() % 64);
+      REQUIRE(check_to_chars_writer<uint64_t, multiply_shift_writer>(
+          v, std::to_string(v)));
+      REQUIRE(check_to_chars_writer<int64_t, multiply_shift_writer>(
+          int64_t(v), std::to_string(int64_t(v))));
+    }
+    CHECK(check_to_chars_writer<uint64_t, multiply_shift_writer>(
+        std::numeric_limits<uint64_t>::max(), "18446744073709551615"));
+    CHECK(check_to_chars_writer<int64_t, multiply_shift_writer>(
+        std::numeric_limits<int64_t>::min(), "-9223372036854775808"));
+    CHECK(check_to_chars_writer<int32_t, multiply_shift_writer>(
+        std::numeric_limits<int32_t>::min(), "-2147483648"));
+
+    // 128-bit values are compared against the default writer.
+    for (int i = 0; i < 100000; ++i) {
+      const u128 v = ((u128(gen()) << 64) | gen()) >> (gen() % 128);
+      std::array<char, 48> buf = {};
+      const auto res = rigtorp::to_chars(buf.begin(), buf.end(), v);
+      REQUIRE(check_to_chars_writer<u128, multiply_shift_writer>(
+          v, std::string_view(buf.data(), res.ptr - buf.data())));
+    }
+
+    std::array<char, 32> buf = {};
+    auto res = rigtorp::to_chars<rigtorp::multiply_shift_writer>(
+        buf.begin(), buf.begin() + 3, 1000);
+    CHECK(res.ec == std::errc::value_too_large);
+    CHECK(res.ptr == buf.begin() + 3);
+    res = rigtorp::to_chars<rigtorp::multiply_shift_writer>(
+        buf.begin(), buf.begin() + 5, -1000);
+    CHECK(res.ec == std::errc{});
+    CHECK(std::string_view(buf.data(), res.ptr - buf.data()) == "-1000");
+    CHECK(rigtorp::multiply_shift_writer::write(buf.end(), 1234u) ==
+          buf.end() - 4);
+    constexpr auto max_len = [] {
+      char b[20] = {};
+      return rigtorp::to_chars<rigtorp::multiply_shift_writer>(b, b + 20,
+                                                               UINT64_MAX)
+                 .ptr -
+             b;
+    };
+    static_assert(max_len() == 20);
+  }
+}
+
+template <unsigned N, typename T> void check_to_chars_fixed(T value) {
+  std::array<char, 32> buf = {};
+  const auto res = rigtorp::to_chars_fixed<N>(buf.data(), value);
+  std::string digits = std::to_string(value);
+  std::string sign;
+  if (digits[0] == '-') {
+    sign = "-";
+    digits.erase(0, 1);
+  }
+  const bool overflow = digits.size() > N;
+  if (overflow) {
+    digits.erase(0, digits.size() - N);
+  }
+  const std::string expected = sign + std::string(N - digits.size(), '0') +
+                               digits;
+  INFO(value);
+  INFO(N);
+  CHECK((res.ec == std::errc::value_too_large) == overflow);
+  CHECK(res.ptr == buf.data() + expected.size());
+  CHECK(buf.data() == expected);
+}
+
+template <typename T, unsigned... N>
+void check_to_chars_fixed_widths(std::integer_sequence<unsigned, N...>) {
+  for (T value : {T(0), T(7), T(42), T(999999), T(123456789),
+                  std::numeric_limits<T>::max(), std::numeric_limits<T>::min(),
+                  T(std::numeric_limits<T>::max() / 3)}) {
+    (check_to_chars_fixed<N + 1>(value), ...);
+  }
+}
+
+template <typename T> void check_to_chars_backward(T value) {
+  std::array<char, 48> expected = {};
+  const auto res = rigtorp::to_chars(expected.begin(), expected.end(), value);
+  std::array<char, 48> buf = {};
+  const char *first = rigtorp::to_chars_backward(buf.end(), value);
+  CHECK(std::string_view(first, buf.end() - first) ==
+        std::string_view(expected.data(), res.ptr - expected.data()));
+}
+
+template <typename T, size_t Size> static void check_to_chars_cache() {
+  rigtorp::to_chars_cache<T, Size> cache;
+  std::mt19937_64 gen(1);
+  std::vector<T> values;
+  for (int i = 0; i < 64; ++i) {
+    values.push_back(T(gen()));
+  }
+  values.push_back(std::numeric_limits<T>::min());
+  values.push_back(std::numeric_limits<T>::max());
+  values.push_back(T(10000));
+  values.push_back(T(9999));
+  values.push_back(T(0));
+  if constexpr (std::is_signed<T>::value) {
+    values.push_back(T(-1));
+  }
+  for (int i = 0; i < 100000; ++i) {
+    const T value =
+        i % 4 == 0 ? T(gen() % 10000) : values[gen() % values.size()];
+    std::array<char, 32> expected, actual;
+    actual.fill('x');
+    const auto r1 = rigtorp::to_chars(expected.data(),
+                                      expected.data() + expected.size(), value);
+    const auto r2 =
+        cache.to_chars(actual.data(), actual.data() + actual.size(), value);
+    REQUIRE(r2.ec == std::errc{});
+    REQUIRE(std::string(actual.data(), r2.ptr) ==
+            std::string(expected.data(), r1.ptr));
+  }
+  CHECK(cache.small_hits() + cache.hits() + cache.misses() == 100000);
+  CHECK(cache.small_hits() > 10000);
+  if (Size >= 1024) {
+    CHECK(cache.hits() > 10 * cache.misses());
+  }
+}
+
+TEST_CASE("to_chars_cache") {
+  check_to_chars_cache<int32_t, 4096>();
+  check_to_chars_cache<uint32_t, 4096>();
+  check_to_chars_cache<int64_t, 4096>();
+  check_to_chars_cache<uint64_t, 4096>();
+  check_to_chars_cache<int64_t, 2>();
+  check_to_chars_cache<uint64_t, 2>();
+
+  rigtorp::to_chars_cache<int64_t> cache;
+  char buf[32];
+  auto format = [&](char *last, int64_t value) {
+    const auto res = cache.to_chars(buf, last, value);
+    REQUIRE(res.ec == std::errc{});
+    return std::string(buf, res.ptr);
+  };
+  CHECK(format(buf + sizeof(buf), 123456789) == "123456789");
+  CHECK(cache.misses() == 1);
+  CHECK(format(buf + 9, 123456789) == "123456789");
+  CHECK(cache.hits() == 1);
+  CHECK(format(buf + 1, 7) == "7");
+  CHECK(format(buf + 4, 1234) == "1234");
+  CHECK(cache.small_hits() == 2);
+  CHECK(cache.to_chars(buf, buf + 8, 123456789).ec ==
+        std::errc::value_too_large);
+  CHECK(cache.to_chars(buf, buf + 3, 1234).ec == std::errc::value_too_large);
+  CHECK(cache.to_chars(buf, buf + 4, -1234).ec == std::errc::value_too_large);
+  cache.reset_counters();
+  CHECK(cache.small_hits() + cache.hits() + cache.misses() == 0);
+}
+
+// Converts little-endian limbs to base 10 one digit at a time.
+static std::string bigint_to_string(std::vector<uint64_t> x) {
+  std::string s;
+  while (!x.empty() && x.back() == 0) {
+    x.pop_back();
+  }
+  while (!x.empty()) {
+    u128 rem = 0;
+    for (size_t i = x.size(); i-- != 0;) {
+      const u128 t = (rem << 64) | x[i];
+      x[i] = uint64_t(t / 10);
+      rem = t % 10;
+    }
+    s.push_back(char('0' + rem));
+    while (!x.empty() && x.back() == 0) {
+      x.pop_back();
+    }
+  }
+  if (s.empty()) {
+    s = "0";
+  }
+  std::reverse(s.begin(), s.end());
+  return s;
+}
+
+static void check_bigint(const std::vector<uint64_t> &x,
+                         const std::string &expected) {
+  const size_t n = x.size();
+  // Default, always chunked and always divide-and-conquer thresholds.
+  for (const size_t threshold : {size_t(0), SIZE_MAX, size_t(2)}) {
+    INFO(threshold);
+    const size_t to_threshold =
+        threshold == 0 ? rigtorp::detail::bigint_to_chars_dc_threshold
+                       : threshold;
+    const size_t from_threshold =
+        threshold == 0 ? rigtorp::detail::bigint_from_chars_dc_threshold
+                       : threshold;
+    std::string buf(20 * n + 1, 'x');
+    auto r = rigtorp::detail::to_chars_bigint(&buf[0], &buf[0] + buf.size(),
+                                              x.data(), n, to_threshold);
+    REQUIRE(r.ec == std::errc{});
+    REQUIRE(std::string(&buf[0], r.ptr) == expected);
+    r = rigtorp::detail::to_chars_bigint(
+        &buf[0], &buf[0] + expected.size(), x.data(), n, to_threshold);
+    CHECK(r.ec == std::errc{});
+    CHECK(r.ptr == &buf[0] + expected.size());
+    r = rigtorp::detail::to_chars_bigint(
+        &buf[0], &buf[0] + expected.size() - 1, x.data(), n, to_threshold);
+    CHECK(r.ec == std::errc::value_too_large);
+
+    std::vector<uint64_t> y(n, 42);
+    const auto p = rigtorp::detail::from_chars_bigint(
+        expected.data(), expected.data() + expected.size(), y.data(), n,
+        from_threshold);
+    REQUIRE(p.ec == std::errc{});
+    CHECK(p.ptr == expected.data() + expected.size());
+    REQUIRE(y == x);
+  }
+
+  std::string buf(20 * n + 1, 'x');
+  const auto r = rigtorp::to_chars(&buf[0], &buf[0] + buf.size(), x.data(),
+                                   x.data() + n);
+  CHECK(std::string(&buf[0], r.ptr) == expected);
+  std::vector<uint64_t> y(n);
+  CHECK(rigtorp::from_chars(expected.data(), expected.data() + expected.size(),
+                            y.data(), y.data() + n)
+            .ec == std::errc{});
+  CHECK(y == x);
+  if (n != 0 && x.back() != 0) {
+    const auto p = rigtorp::from_chars(expected.data(),
+                                       expected.data() + expected.size(),
+                                       y.data(), y.data() + n - 1);
+    CHECK(p.ec == std::errc::result_out_of_range);
+    CHECK(p.ptr == expected.data() + expected.size());
+  }
+}
+
+static void check_bigint(const std::vector<uint64_t> &x) {
+  check_bigint(x, bigint_to_string(x));
+}
+
+TEST_CASE("bigint") {
+  std::mt19937_64 gen(25);
+  for (const size_t n :
+       {0, 1, 2, 3, 5, 8, 23, 24, 25, 26, 31, 48, 49, 64, 65, 97, 130, 200}) {
+    INFO(n);
+    for (int i = 0; i < 3; ++i) {
+      std::vector<uint64_t> x(n);
+      for (auto &limb : x) {
+        limb = gen();
+      }
+      check_bigint(x);
+    }
+    check_bigint(std::vector<uint64_t>(n, ~uint64_t(0)));
+    if (n != 0) {
+      // Sparse values have long runs of zero digit chunks.
+      std::vector<uint64_t> x(n);
+      x.back() = 1;
+      check_bigint(x);
+      x[0] = 1;
+      check_bigint(x);
+    }
+  }
+
+  // 10^k - 1, 10^k and 10^k + 1 around the split points 19 * 2^j.
+  for (const size_t k : {1, 18, 19, 20, 37, 38, 39, 76, 152, 304, 456, 608,
+                         1216, 1217, 2432, 4864}) {
+    INFO(k);
+    const std::string nines(k, '9');
+    const std::string pow = "1" + std::string(k, '0');
+    const std::string pow1 = "1" + std::string(k - 1, '0') + "1";
+    for (const auto &s : {nines, pow, pow1}) {
+      std::vector<uint64_t> x(k / 19 + 1);
+      REQUIRE(rigtorp::from_chars(s.data(), s.data() + s.size(), x.data(),
+                                  x.data() + x.size())
+                  .ec == std::errc{});
+      check_bigint(x, s);
+    }
+  }
+
+  std::vector<uint64_t> x(4, 42);
+  auto parse = [&](std::string_view s, size_t n = 4) {
+    return rigtorp::from_chars(s.data(), s.data() + s.size(), x.data(),
+                               x.data() + n);
+  };
+  CHECK(parse("").ec == std::errc::invalid_argument);
+  CHECK(parse("-1").ec == std::errc::invalid_argument);
+  CHECK(parse("+1").ec == std::errc::invalid_argument);
+  const std::string_view bad = "1234567890123a";
+  CHECK(parse(bad).ptr == bad.data() + 13);
+  CHECK(parse(bad).ec == std::errc::invalid_argument);
+  CHECK(x == std::vector<uint64_t>(4, 42));
+  CHECK(parse("0", 0).ec == std::errc{});
+  CHECK(parse("1", 0).ec == std::errc::result_out_of_range);
+  CHECK(parse(std::string(200, '0') + "12").ec == std::errc{});
+  CHECK(x == std::vector<uint64_t>{12, 0, 0, 0});
+  CHECK(parse("18446744073709551615", 1).ec == std::errc{});
+  CHECK(parse("18446744073709551616", 1).ec ==
+        std::errc::result_out_of_range);
+  CHECK(parse("340282366920938463463374607431768211455", 2).ec ==
+        std::errc{});
+  CHECK(parse("340282366920938463463374607431768211456", 2).ec ==
+        std::errc::result_out_of_range);
+  CHECK(parse(std::string(81, '9')).ec == std::errc::result_out_of_range);
+
+  char buf[4];
+  const uint64_t zero = 0;
+  auto r = rigtorp::to_chars(buf, buf + 1, &zero, &zero + 1);
+  CHECK(r.ec == std::errc{});
+  CHECK(std::string(buf, r.ptr) == "0");
+  CHECK(rigtorp::to_chars(buf, buf, &zero, &zero + 1).ec ==
+        std::errc::value_too_large);
+  r = rigtorp::to_chars(buf, buf + 1, &zero, &zero);
+  CHECK(std::string(buf, r.ptr) == "0");
+}
+
+TEST_CASE("to_chars_backward") {
+  std::mt19937_64 gen(15);
+  uint64_t val = 1;
+  for (int i = 0; i < 20; ++i) {
+    check_to_chars_backward(val);
+    check_to_chars_backward(val - 1);
+    check_to_chars_backward(uint32_t(val));
+    check_to_chars_backward(int32_t(val));
+    check_to_chars_backward(-int32_t(val));
+    check_to_chars_backward(int64_t(val));
+    check_to_chars_backward(-int64_t(val));
+    val *= 10;
+  }
+  check_to_chars_backward(std::numeric_limits<int32_t>::min());
+  check_to_chars_backward(std::numeric_limits<uint32_t>::max());
+  check_to_chars_backward(std::numeric_limits<int64_t>::min());
+  check_to_chars_backward(std::numeric_limits<uint64_t>::max());
+  check_to_chars_backward(~u128(0));
+  check_to_chars_backward(-i128(~u128(0) >> 1) - 1);
+  for (int i = 0; i < 1000; ++i) {
+    const uint64_t value = gen() >> (gen() % 64);
+    check_to_chars_backward(value);
+    check_to_chars_backward(-int64_t(value));
+  }
+
+  SECTION("length prefix") {
+    std::array<char, 64> buf = {};
+    char *p = buf.end();
+    *--p = '|';
+    p = rigtorp::to_chars_backward(p, -42);
+    *--p = '=';
+    *--p = 'x';
+    const ptrdiff_t body_len = buf.end() - p;
+    *--p = '|';
+    p = rigtorp::to_chars_backward(p, int32_t(body_len));
+    CHECK(std::string_view(p, buf.end() - p) == "6|x=-42|");
+  }
+
+  static_assert([] {
+    char buf[8] = {};
+    return rigtorp::to_chars_backward(buf + 8, -123) == buf + 4 &&
+           buf[4] == '-' && buf[7] == '3';
+  }());
+}
+
+TEST_CASE("to_chars_fixed") {
+  check_to_chars_fixed_widths<uint32_t>(
+      std::make_integer_sequence<unsigned, 10>());
+  check_to_chars_fixed_widths<int32_t>(
+      std::make_integer_sequence<unsigned, 10>());
+  check_to_chars_fixed_widths<uint64_t>(
+      std::make_integer_sequence<unsigned, 20>());
+  check_to_chars_fixed_widths<int64_t>(
+      std::make_integer_sequence<unsigned, 19>());
+
+  // Negative values take N + 1 characters.
+  char buf[8] = {};
+  auto res = rigtorp::to_chars_fixed<4>(buf, int32_t(-42));
+  CHECK(res.ec == std::errc{});
+  CHECK(res.ptr == buf + 5);
+  CHECK(std::string_view(buf, 5) == "-0042");
+  res = rigtorp::to_chars_fixed<4>(buf, int64_t(-1234567));
+  CHECK(res.ec == std::errc::value_too_large);
+  CHECK(res.ptr == buf + 5);
+  CHECK(std::string_view(buf, 5) == "-4567");
+}
+
+template <typename T, typename U> void check_to_chars_float_bits(U bits) {
+  T value;
+  std::memcpy(&value, &bits, sizeof(value));
+  std::array<char, 32> buf = {};
+  const auto res = rigtorp::to_chars(buf.begin(), buf.end(), value);
+  REQUIRE(res.ec == std::errc{});
+  INFO(buf.data());
+  if (value != value) {
+    CHECK(std::string_view(buf.data()).find("nan") != std::string_view::npos);
+    return;
+  }
+  if (std::is_same<T, float>::value) {
+    CHECK(std::strtof(buf.data(), nullptr) == value);
+  } else {
+    CHECK(std::strtod(buf.data(), nullptr) == value);
+  }
+#if defined(__cpp_lib_to_chars)
+  std::array<char, 32> expected = {};
+  std::to_chars(expected.begin(), expected.end(), value);
+  CHECK(std::string_view(buf.data()) == expected.data());
+#endif
+}
+
+TEST_CASE("to_chars float") {
+  CHECK(check_to_chars(0.0, "0"));
+  CHECK(check_to_chars(-0.0, "-0"));
+  CHECK(check_to_chars(1.0, "1"));
+  CHECK(check_to_chars(0.1, "0.1"));
+  CHECK(check_to_chars(0.3, "0.3"));
+  CHECK(check_to_chars(1.5, "1.5"));
+  CHECK(check_to_chars(-123.456, "-123.456"));
+  CHECK(check_to_chars(100.0, "100"));
+  CHECK(check_to_chars(1e22, "1e+22"));
+  CHECK(check_to_chars(1e-7, "1e-07"));
+  CHECK(check_to_chars(123456789012.0, "123456789012"));
+  CHECK(check_to_chars(9007199254740993.0, "9007199254740992"));
+  CHECK(check_to_chars(0.1f, "0.1"));
+  CHECK(check_to_chars(16777216.0f, "16777216"));
+  CHECK(check_to_chars(3.4028235e38f, "3.4028235e+38"));
+  CHECK(check_to_chars(std::numeric_limits<double>::max(),
+                       "1.7976931348623157e+308"));
+  CHECK(check_to_chars(std::numeric_limits<double>::min(),
+                       "2.2250738585072014e-308"));
+  CHECK(check_to_chars(std::numeric_limits<double>::denorm_min(), "5e-324"));
+  CHECK(check_to_chars(std::numeric_limits<float>::denorm_min(), "1e-45"));
+  CHECK(check_to_chars(std::numeric_limits<double>::infinity(), "inf"));
+  CHECK(check_to_chars(-std::numeric_limits<float>::infinity(), "-inf"));
+  CHECK(check_to_chars(std::numeric_limits<double>::quiet_NaN(), "nan"));
+
+  SECTION("overflow") {
+    std::array<char, 32> buf = {};
+    auto res = rigtorp::to_chars(buf.begin(), buf.begin() + 4, 1.125);
+    CHECK(res.ec == std::errc::value_too_large);
+    CHECK(res.ptr == buf.begin() + 4);
+    res = rigtorp::to_chars(buf.begin(), buf.begin() + 4, 1.5);
+    CHECK(res.ec == std::errc{});
+    CHECK(res.ptr == buf.begin() + 3);
+    CHECK(std::string_view(buf.data(), 3) == "1.5");
+  }
+
+  SECTION("random") {
+    std::mt19937_64 gen(42);
+    for (int i = 0; i < 100000; ++i) {
+      const uint64_t bits = gen();
+      check_to_chars_float_bits<double>(bits);
+      check_to_chars_float_bits<float>(uint32_t(bits));
+      check_to_chars_float_bits<double>(bits >> (bits % 64));
+      check_to_chars_float_bits<float>(uint32_t(bits >> 32) >> (bits % 32));
+    }
+  }
+}
+
 template <typename T> bool check_from_chars(T expected, std::string_view s) {
   T value;
   auto r = rigtorp::from_chars(s.begin(), s.end(), value);
@@ -276,6 +796,1668 @@ TEST_CASE("from_chars") {
   }
 }
 
+template <typename T> void check_from_chars_float(const std::string &s) {
+  T value = 0;
+  const auto res = rigtorp::from_chars(s.data(), s.data() + s.size(), value);
+  const T expected = std::is_same<T, float>::value
+                         ? T(std::strtof(s.c_str(), nullptr))
+                         : T(std::strtod(s.c_str(), nullptr));
+  INFO(s);
+  CHECK(res.ptr == s.data() + s.size());
+  if (res.ec == std::errc::result_out_of_range) {
+    CHECK((expected == 0 || std::abs(expected) ==
+                                std::numeric_limits<T>::infinity()));
+    CHECK(value == 0);
+    return;
+  }
+  REQUIRE(res.ec == std::errc{});
+  CHECK(std::memcmp(&value, &expected, sizeof(T)) == 0);
+}
+
+template <typename T> void check_from_chars_prefix(std::string_view s) {
+  T value = 42;
+  const auto res = rigtorp::from_chars_prefix(s.begin(), s.end(), value);
+  INFO(s);
+#if __cpp_lib_to_chars || (defined(__GLIBCXX__) && __cplusplus >= 201703L)
+  T expected = 42;
+  const auto r = std::from_chars(s.begin(), s.end(), expected);
+  CHECK(res.ec == r.ec);
+  CHECK(res.ptr == r.ptr);
+  CHECK(value == expected);
+#endif
+  if (res.ec != std::errc{}) {
+    CHECK(value == 42);
+  }
+}
+
+TEST_CASE("from_chars_prefix") {
+  using namespace rigtorp;
+
+  for (const std::string_view s :
+       {"", "-", "+1", " 1", "x", "123", "123,456\n", "-123 ", "--1", "-x",
+        "0001x", "4294967295,", "4294967296,", "99999999999999999999999,1",
+        "-2147483648x", "-2147483649x", "9223372036854775807|",
+        "-9223372036854775809|", "18446744073709551616"}) {
+    check_from_chars_prefix<int32_t>(s);
+    check_from_chars_prefix<uint32_t>(s);
+    check_from_chars_prefix<int64_t>(s);
+    check_from_chars_prefix<uint64_t>(s);
+  }
+
+  std::mt19937 gen(16);
+  const std::string_view chars = "0123456789-+, x";
+  for (int i = 0; i < 10000; ++i) {
+    std::string s;
+    const int n = gen() % 32;
+    for (int j = 0; j < n; ++j) {
+      s += gen() % 4 ? char('0' + gen() % 10) : chars[gen() % chars.size()];
+    }
+    check_from_chars_prefix<int32_t>(s);
+    check_from_chars_prefix<uint32_t>(s);
+    check_from_chars_prefix<int64_t>(s);
+    check_from_chars_prefix<uint64_t>(s);
+  }
+
+  SECTION("overflow") {
+    const std::string_view s = "99999999999x";
+    int32_t value = 42;
+    const auto res = from_chars_prefix(s.begin(), s.end(), value);
+    CHECK(res.ec == std::errc::result_out_of_range);
+    CHECK(res.ptr == s.begin() + 11);
+    CHECK(value == 42);
+  }
+
+  SECTION("options") {
+    int32_t value = 0;
+    std::string_view s = " \t+12,";
+    auto res = from_chars_prefix(s.begin(), s.end(), value);
+    CHECK(res.ec == std::errc::invalid_argument);
+    CHECK(res.ptr == s.begin());
+    res = from_chars_prefix<allow_plus>(s.begin(), s.end(), value);
+    CHECK(res.ec == std::errc::invalid_argument);
+    res = from_chars_prefix<skip_whitespace>(s.begin(), s.end(), value);
+    CHECK(res.ec == std::errc::invalid_argument);
+    CHECK(res.ptr == s.begin());
+    res = from_chars_prefix<allow_plus | skip_whitespace>(s.begin(), s.end(),
+                                                          value);
+    CHECK(res.ec == std::errc{});
+    CHECK(res.ptr == s.begin() + 5);
+    CHECK(value == 12);
+    s = "\n-7";
+    res = from_chars_prefix<skip_whitespace>(s.begin(), s.end(), value);
+    CHECK(res.ec == std::errc{});
+    CHECK(value == -7);
+    s = "+";
+    res = from_chars_prefix<allow_plus>(s.begin(), s.end(), value);
+    CHECK(res.ec == std::errc::invalid_argument);
+    CHECK(res.ptr == s.begin());
+    s = "-+1";
+    res = from_chars_prefix<allow_plus>(s.begin(), s.end(), value);
+    CHECK(res.ec == std::errc::invalid_argument);
+    uint32_t u = 0;
+    s = "+5";
+    res = from_chars_prefix<allow_plus>(s.begin(), s.end(), u);
+    CHECK(res.ec == std::errc{});
+    CHECK(u == 5);
+  }
+
+  SECTION("tokenize") {
+    const std::string_view s = "123,456\n-7";
+    std::vector<int32_t> values;
+    for (const char *p = s.begin(); p != s.end();) {
+      int32_t value = 0;
+      const auto res = from_chars_prefix(p, s.end(), value);
+      REQUIRE(res.ec == std::errc{});
+      values.push_back(value);
+      p = res.ptr == s.end() ? res.ptr : res.ptr + 1;
+    }
+    CHECK(values == std::vector<int32_t>{123, 456, -7});
+  }
+}
+
+TEST_CASE("from_chars float") {
+  for (const char *s :
+       {"0", "-0", "1", "-1", "0.1", ".5", "5.", "1e10", "1E+10", "1e-10",
+        "123.456e-7", "0.000001", "3.1415926535897932384626433832795",
+        "9007199254740993", "9007199254740993.0000000000000001",
+        "2.2250738585072011e-308", "2.2250738585072014e-308",
+        "4.9406564584124654e-324", "2.4703282292062328e-324",
+        "1.7976931348623157e308", "1.7976931348623158e308",
+        "3.4028235e38", "1.4e-45", "0e999", "0.00000000000000000000000000",
+        "000000000000000000000000000000000000001",
+        "7.038531e-26", "1.00000017881393432617187499"}) {
+    check_from_chars_float<double>(s);
+    check_from_chars_float<float>(s);
+  }
+
+  SECTION("special") {
+    double d = 0;
+    CHECK(rigtorp::from_chars(std::string_view("inf").begin(),
+                              std::string_view("inf").end(), d)
+              .ec == std::errc{});
+    CHECK(d == std::numeric_limits<double>::infinity());
+    const std::string_view ninf = "-Infinity";
+    CHECK(rigtorp::from_chars(ninf.begin(), ninf.end(), d).ec == std::errc{});
+    CHECK(d == -std::numeric_limits<double>::infinity());
+    float f = 0;
+    const std::string_view nan = "nan";
+    CHECK(rigtorp::from_chars(nan.begin(), nan.end(), f).ec == std::errc{});
+    CHECK(f != f);
+  }
+
+  SECTION("out of range") {
+    for (std::string_view s : {"1e309", "-1e400", "1e-400", "2e-324"}) {
+      double d = 1;
+      const auto r = rigtorp::from_chars(s.begin(), s.end(), d);
+      CHECK(r.ec == std::errc::result_out_of_range);
+      CHECK(r.ptr == s.end());
+      CHECK(d == 1);
+    }
+  }
+
+  SECTION("invalid") {
+    for (std::string_view s :
+         {"", "-", ".", "+1", "1.2.3", "1e", "1e+", "1x", " 1", "infx", "e5",
+          "0x10", "1,5"}) {
+      double d = 1;
+      const auto r = rigtorp::from_chars(s.begin(), s.end(), d);
+      INFO(s);
+      CHECK(r.ec == std::errc::invalid_argument);
+      CHECK(d == 1);
+    }
+  }
+
+  SECTION("random") {
+    std::mt19937_64 gen(42);
+    std::array<char, 64> buf = {};
+    for (int i = 0; i < 20000; ++i) {
+      const uint64_t bits = gen();
+      double d;
+      std::memcpy(&d, &bits, sizeof(d));
+      if (std::isfinite(d)) {
+        std::snprintf(buf.data(), buf.size(), "%.17g", d);
+        check_from_chars_float<double>(buf.data());
+        std::snprintf(buf.data(), buf.size(), "%.*g", int(1 + gen() % 25), d);
+        check_from_chars_float<double>(buf.data());
+      }
+      const uint32_t fbits = uint32_t(bits >> 7);
+      float f;
+      std::memcpy(&f, &fbits, sizeof(f));
+      if (std::isfinite(f)) {
+        std::snprintf(buf.data(), buf.size(), "%.9g", f);
+        check_from_chars_float<float>(buf.data());
+        std::snprintf(buf.data(), buf.size(), "%.*g", int(1 + gen() % 25),
+                      double(f));
+        check_from_chars_float<float>(buf.data());
+      }
+      std::string s;
+      const int digits = 1 + gen() % 40;
+      for (int j = 0; j < digits; ++j) {
+        s += char('0' + gen() % 10);
+      }
+      if (gen() % 2) {
+        s.insert(gen() % s.size(), ".");
+      }
+      s += "e" + std::to_string(int(gen() % 700) - 350);
+      check_from_chars_float<double>(s);
+      check_from_chars_float<float>(s);
+    }
+  }
+
+  SECTION("halfway") {
+    // Exact midpoints between adjacent doubles, which need all digits to
+    // round correctly
+    std::mt19937_64 gen(42);
+    for (int i = 0; i < 200; ++i) {
+      const uint64_t bits = gen() >> 2;
+      double lo, hi;
+      std::memcpy(&lo, &bits, sizeof(lo));
+      hi = std::nextafter(lo, std::numeric_limits<double>::infinity());
+      std::array<char, 1200> buf = {};
+      std::snprintf(buf.data(), buf.size(), "%.1100Le",
+                    (static_cast<long double>(lo) + hi) / 2);
+      std::string s = buf.data();
+      check_from_chars_float<double>(s);
+      check_from_chars_float<double>(s.insert(s.find('e'), "000001"));
+    }
+  }
+}
+
+template <unsigned N, typename T> void check_from_chars_fixed(std::string s) {
+  const auto len = N + (s[0] == '-');
+  s.resize(32, '*');
+  T a = 123, b = 123;
+  const auto ra = rigtorp::from_chars(s.data(), s.data() + len, a);
+  const auto rb = rigtorp::from_chars_fixed<N>(s.data(), b);
+  INFO(s);
+  INFO(N);
+  CHECK(ra.ec == rb.ec);
+  CHECK(ra.ptr == rb.ptr);
+  CHECK(a == b);
+}
+
+template <typename T, unsigned... N>
+void check_from_chars_fixed_widths(std::integer_sequence<unsigned, N...>) {
+  std::mt19937 gen(sizeof...(N) + sizeof(T));
+  const auto random_digits = [&](unsigned n) {
+    std::string s;
+    for (unsigned i = 0; i < n; ++i) {
+      s += char('0' + gen() % 10);
+    }
+    return s;
+  };
+  for (int i = 0; i < 100; ++i) {
+    (check_from_chars_fixed<N + 1, T>(random_digits(N + 1)), ...);
+    (check_from_chars_fixed<N + 1, T>("-" + random_digits(N + 1)), ...);
+    (check_from_chars_fixed<N + 1, T>(std::string(N + 1, '9')), ...);
+    (check_from_chars_fixed<N + 1, T>(std::string(N + 1, '0')), ...);
+  }
+  for (unsigned pos = 0; pos < 20; ++pos) {
+    for (char c : {'/', ':', 'a', ' '}) {
+      std::string s = random_digits(20);
+      s[pos] = c;
+      (check_from_chars_fixed<N + 1, T>(s), ...);
+    }
+  }
+}
+
+TEST_CASE("from_chars_fixed") {
+  check_from_chars_fixed_widths<uint32_t>(
+      std::make_integer_sequence<unsigned, 10>());
+  check_from_chars_fixed_widths<int32_t>(
+      std::make_integer_sequence<unsigned, 10>());
+  check_from_chars_fixed_widths<uint64_t>(
+      std::make_integer_sequence<unsigned, 20>());
+  check_from_chars_fixed_widths<int64_t>(
+      std::make_integer_sequence<unsigned, 19>());
+
+  uint32_t u = 0;
+  CHECK(rigtorp::from_chars_fixed<10>("4294967295", u).ec == std::errc{});
+  CHECK(u == std::numeric_limits<uint32_t>::max());
+  CHECK(rigtorp::from_chars_fixed<10>("4294967296", u).ec ==
+        std::errc::result_out_of_range);
+  int64_t i = 0;
+  CHECK(rigtorp::from_chars_fixed<19>("-9223372036854775808", i).ec ==
+        std::errc{});
+  CHECK(i == std::numeric_limits<int64_t>::min());
+  uint64_t v = 0;
+  CHECK(rigtorp::from_chars_fixed<20>("18446744073709551616", v).ec ==
+        std::errc::result_out_of_range);
+}
+
+// Reference formatting of value / 10^Scale using std::to_string.
+template <unsigned Scale, typename T> std::string decimal_string(T value) {
+  std::string digits = std::to_string(value);
+  std::string sign;
+  if (digits[0] == '-') {
+    sign = "-";
+    digits.erase(0, 1);
+  }
+  if (digits.size() <= Scale) {
+    digits.insert(0, Scale + 1 - digits.size(), '0');
+  }
+  if (Scale > 0) {
+    digits.insert(digits.size() - Scale, ".");
+  }
+  return sign + digits;
+}
+
+template <unsigned Scale, typename T> void check_decimal(T value) {
+  std::array<char, 32> buf = {};
+  const auto expected = decimal_string<Scale>(value);
+  const auto res = rigtorp::to_chars_decimal<Scale>(buf.begin(), buf.end(),
+                                                    value);
+  INFO(expected);
+  CHECK(res.ec == std::errc{});
+  CHECK(res.ptr == buf.begin() + expected.size());
+  CHECK(buf.data() == expected);
+  T parsed = 0;
+  const auto r = rigtorp::from_chars_decimal<Scale>(
+      expected.data(), expected.data() + expected.size(), parsed);
+  CHECK(r.ec == std::errc{});
+  CHECK(r.ptr == expected.data() + expected.size());
+  CHECK(parsed == value);
+}
+
+template <unsigned Scale, typename Rounding = rigtorp::round_toward_zero>
+bool check_from_chars_decimal(std::string_view s, int64_t expected) {
+  int64_t value = 0;
+  const auto r =
+      rigtorp::from_chars_decimal<Scale, Rounding>(s.begin(), s.end(), value);
+  return r.ec == std::errc{} && r.ptr == s.end() && value == expected;
+}
+
+template <unsigned Scale>
+rigtorp::from_chars_result from_chars_decimal_error(std::string_view s) {
+  int64_t value = 42;
+  const auto r = rigtorp::from_chars_decimal<Scale>(s.begin(), s.end(), value);
+  return value == 42 ? r : rigtorp::from_chars_result{nullptr, std::errc{}};
+}
+
+TEST_CASE("to_chars_decimal") {
+  std::mt19937_64 gen(42);
+  for (int64_t value :
+       {int64_t(0), int64_t(1), int64_t(-1), int64_t(12345), int64_t(-99999),
+        std::numeric_limits<int64_t>::max(),
+        std::numeric_limits<int64_t>::min()}) {
+    check_decimal<0>(value);
+    check_decimal<1>(value);
+    check_decimal<4>(value);
+    check_decimal<8>(value);
+    check_decimal<18>(value);
+  }
+  for (int i = 0; i < 1000; ++i) {
+    const int64_t value = int64_t(gen()) >> (gen() % 64);
+    check_decimal<2>(value);
+    check_decimal<4>(value);
+    check_decimal<9>(value);
+    check_decimal<4>(uint32_t(value));
+    check_decimal<4>(int32_t(value));
+    check_decimal<4>(uint64_t(value));
+  }
+
+  std::array<char, 32> buf = {};
+  auto res = rigtorp::to_chars_decimal<4>(buf.begin(), buf.begin() + 6,
+                                          int64_t(-5));
+  CHECK(res.ec == std::errc::value_too_large);
+  CHECK(res.ptr == buf.begin() + 6);
+  res = rigtorp::to_chars_decimal<4>(buf.begin(), buf.begin() + 7,
+                                     int64_t(-5));
+  CHECK(res.ec == std::errc{});
+  CHECK(std::string_view(buf.data(), 7) == "-0.0005");
+}
+
+TEST_CASE("from_chars_decimal") {
+  using namespace rigtorp;
+
+  CHECK(check_from_chars_decimal<4>("123.4500", 1234500));
+  CHECK(check_from_chars_decimal<4>("123.45", 1234500));
+  CHECK(check_from_chars_decimal<4>("123", 1230000));
+  CHECK(check_from_chars_decimal<4>("123.", 1230000));
+  CHECK(check_from_chars_decimal<4>(".5", 5000));
+  CHECK(check_from_chars_decimal<4>("-0.0001", -1));
+  CHECK(check_from_chars_decimal<0>("42", 42));
+  CHECK(check_from_chars_decimal<4>("-922337203685477.5808",
+                                    std::numeric_limits<int64_t>::min()));
+  CHECK(check_from_chars_decimal<4>("922337203685477.5807",
+                                    std::numeric_limits<int64_t>::max()));
+
+  SECTION("rounding") {
+    CHECK(check_from_chars_decimal<2>("1.234", 123));
+    CHECK(check_from_chars_decimal<2>("1.239", 123));
+    CHECK(check_from_chars_decimal<2>("-1.239", -123));
+    CHECK(check_from_chars_decimal<0>("2.5", 2));
+    CHECK(check_from_chars_decimal<2, round_half_away_from_zero>("1.234", 123));
+    CHECK(check_from_chars_decimal<2, round_half_away_from_zero>("1.235", 124));
+    CHECK(
+        check_from_chars_decimal<2, round_half_away_from_zero>("-1.235", -124));
+    CHECK(check_from_chars_decimal<0, round_half_away_from_zero>("2.5", 3));
+    CHECK(check_from_chars_decimal<2, round_half_to_even>("1.235", 124));
+    CHECK(check_from_chars_decimal<2, round_half_to_even>("1.245", 124));
+    CHECK(check_from_chars_decimal<2, round_half_to_even>("1.2450", 124));
+    CHECK(check_from_chars_decimal<2, round_half_to_even>("1.24501", 125));
+    CHECK(check_from_chars_decimal<2, round_half_to_even>("-1.246", -125));
+    CHECK(check_from_chars_decimal<0, round_half_to_even>("2.5", 2));
+    CHECK(check_from_chars_decimal<0, round_half_to_even>("3.5", 4));
+    CHECK(check_from_chars_decimal<0, round_half_to_even>(".5", 0));
+  }
+
+  SECTION("errors") {
+    for (std::string_view s : {"", "-", ".", "-.", "1..2", "1.2.3", "+1",
+                               "1e5", "1.23x", "1.23456x", "x"}) {
+      INFO(s);
+      CHECK(from_chars_decimal_error<4>(s).ec == std::errc::invalid_argument);
+    }
+    CHECK(from_chars_decimal_error<4>("1.23456x").ptr[0] == 'x');
+    for (std::string_view s : {"922337203685477.5808", "-922337203685477.5809",
+                               "1000000000000000", "99999999999999999999"}) {
+      INFO(s);
+      CHECK(from_chars_decimal_error<4>(s).ec ==
+            std::errc::result_out_of_range);
+    }
+    // The fraction overflows the scaled integer part and must not wrap.
+    for (std::string_view s :
+         {"1844674407370955.1616", "1844674407370955.9999",
+          "-1844674407370955.1616", "-1844674407370955.9999"}) {
+      INFO(s);
+      CHECK(from_chars_decimal_error<4>(s).ec ==
+            std::errc::result_out_of_range);
+    }
+    uint64_t uvalue = 0;
+    const std::string_view umax = "1844674407370955.1615";
+    CHECK(from_chars_decimal<4>(umax.begin(), umax.end(), uvalue).ec ==
+          std::errc{});
+    CHECK(uvalue == std::numeric_limits<uint64_t>::max());
+    for (std::string_view s : {"1844674407370955.1616", "1844674407370955.9999",
+                               "1844674407370955.16155"}) {
+      INFO(s);
+      uvalue = 42;
+      CHECK(from_chars_decimal<4, round_half_away_from_zero>(s.begin(),
+                                                             s.end(), uvalue)
+                .ec == std::errc::result_out_of_range);
+      CHECK(uvalue == 42);
+    }
+    int64_t value = 0;
+    const std::string_view min = "-922337203685477.58085";
+    CHECK(from_chars_decimal<4, round_half_away_from_zero>(
+              min.begin(), min.end(), value)
+              .ec == std::errc::result_out_of_range);
+    const std::string_view max = "922337203685477.58075";
+    CHECK(from_chars_decimal<4, round_half_away_from_zero>(
+              max.begin(), max.end(), value)
+              .ec == std::errc::result_out_of_range);
+  }
+
+  static_assert([] {
+    int64_t value = 0;
+    const char s[] = "-1.25";
+    from_chars_decimal<3>(s, s + 5, value);
+    return value;
+  }() == -1250);
+}
+
+template <typename T> std::string to_string_base(T value, int base) {
+  using UT = std::make_unsigned_t<T>;
+  UT uvalue = value;
+  std::string res;
+  do {
+    res += "0123456789abcdefghijklmnopqrstuvwxyz"[uvalue % base];
+    uvalue /= base;
+  } while (uvalue != 0 && value >= 0);
+  if (value < 0) {
+    res.clear();
+    uvalue = UT(0) - UT(value);
+    do {
+      res += "0123456789abcdefghijklmnopqrstuvwxyz"[uvalue % base];
+      uvalue /= base;
+    } while (uvalue != 0);
+    res += '-';
+  }
+  return std::string(res.rbegin(), res.rend());
+}
+
+template <typename T> void check_base(T value, int base) {
+  const auto expected = to_string_base(value, base);
+  std::array<char, 80> buf = {};
+  const auto res = rigtorp::to_chars(buf.begin(), buf.end(), value, base);
+  INFO(expected);
+  INFO(base);
+  CHECK(res.ec == std::errc{});
+  CHECK(res.ptr == buf.begin() + expected.size());
+  CHECK(buf.data() == expected);
+  T parsed = 0;
+  const auto r = rigtorp::from_chars(
+      expected.data(), expected.data() + expected.size(), parsed, base);
+  CHECK(r.ec == std::errc{});
+  CHECK(r.ptr == expected.data() + expected.size());
+  CHECK(parsed == value);
+}
+
+TEST_CASE("to_chars_timestamp and from_chars_timestamp") {
+  using namespace rigtorp;
+
+  auto format = [](int64_t value) {
+    char buf[32];
+    const auto res = to_chars_timestamp(buf, buf + sizeof(buf), value);
+    REQUIRE(res.ec == std::errc{});
+    REQUIRE(res.ptr == buf + 29);
+    return std::string(buf, res.ptr);
+  };
+  auto parse = [](const std::string &s, int64_t &value) {
+    return from_chars_timestamp(s.data(), s.data() + s.size(), value);
+  };
+
+  SECTION("every day") {
+    constexpr int64_t nanos_per_day = INT64_C(86400000000000);
+    std::mt19937_64 gen(1);
+    for (int64_t day = std::numeric_limits<int64_t>::min() / nanos_per_day;
+         day <= std::numeric_limits<int64_t>::max() / nanos_per_day; ++day) {
+      const int64_t nanos = gen() % nanos_per_day;
+      if ((day == -106752 && nanos < 45763145224192) ||
+          (day == 106751 && nanos > 85636854775807)) {
+        continue;
+      }
+      const int64_t value = day * nanos_per_day + nanos;
+      const time_t t = value >= 0 ? value / 1000000000
+                                  : -((-(value + 1)) / 1000000000) - 1;
+      struct tm tm;
+      REQUIRE(gmtime_r(&t, &tm) != nullptr);
+      char expected[64];
+      snprintf(expected, sizeof(expected),
+               "%04d-%02d-%02dT%02d:%02d:%02d.%09d", tm.tm_year + 1900,
+               tm.tm_mon + 1, tm.tm_mday, tm.tm_hour, tm.tm_min, tm.tm_sec,
+               int(value - int64_t(t) * 1000000000));
+      const auto s = format(value);
+      REQUIRE(s == expected);
+      int64_t parsed = 0;
+      REQUIRE(parse(s, parsed).ec == std::errc{});
+      REQUIRE(parsed == value);
+    }
+  }
+
+  SECTION("limits") {
+    for (const auto &[value, expected] :
+         std::initializer_list<std::pair<int64_t, const char *>>{
+             {0, "1970-01-01T00:00:00.000000000"},
+             {-1, "1969-12-31T23:59:59.999999999"},
+             {951782400000000000, "2000-02-29T00:00:00.000000000"},
+             {std::numeric_limits<int64_t>::min(),
+              "1677-09-21T00:12:43.145224192"},
+             {std::numeric_limits<int64_t>::max(),
+              "2262-04-11T23:47:16.854775807"}}) {
+      CHECK(format(value) == expected);
+      int64_t parsed = 0;
+      CHECK(parse(expected, parsed).ec == std::errc{});
+      CHECK(parsed == value);
+    }
+    char buf[28];
+    CHECK(to_chars_timestamp(buf, buf + sizeof(buf), 0).ec ==
+          std::errc::value_too_large);
+  }
+
+  SECTION("utc offset") {
+    for (const auto &[s, expected] :
+         std::initializer_list<std::pair<const char *, int64_t>>{
+             {"1970-01-01T00:00:00.000000001Z", 1},
+             {"1970-01-01T01:00:00.000000000+01:00", 0},
+             {"1969-12-31T18:30:00.000000000-05:30", 0},
+             {"1970-01-01T00:00:00.000000000-00:00", 0},
+             {"2262-04-12T00:47:16.854775807+01:00",
+              std::numeric_limits<int64_t>::max()},
+             {"1677-09-20T23:12:43.145224192-01:00",
+              std::numeric_limits<int64_t>::min()}}) {
+      int64_t parsed = 0;
+      CHECK(parse(s, parsed).ec == std::errc{});
+      CHECK(parsed == expected);
+    }
+  }
+
+  SECTION("errors") {
+    for (const auto &[s, pos, ec] :
+         std::initializer_list<std::tuple<const char *, size_t, std::errc>>{
+             {"", 0, std::errc::invalid_argument},
+             {"1970-01-01T00:00:00.00000000", 28, std::errc::invalid_argument},
+             {"1970-01-01 00:00:00.000000000", 10, std::errc::invalid_argument},
+             {"1970/01-01T00:00:00.000000000", 4, std::errc::invalid_argument},
+             {"197x-01-01T00:00:00.000000000", 3, std::errc::invalid_argument},
+             {"1970-01-01T00:00:00.00000000x", 28, std::errc::invalid_argument},
+             {"1970-01-01T00:00:00,000000000", 19, std::errc::invalid_argument},
+             {"1970-00-01T00:00:00.000000000", 5, std::errc::invalid_argument},
+             {"1970-13-01T00:00:00.000000000", 5, std::errc::invalid_argument},
+             {"1970-01-00T00:00:00.000000000", 8, std::errc::invalid_argument},
+             {"1970-04-31T00:00:00.000000000", 8, std::errc::invalid_argument},
+             {"1900-02-29T00:00:00.000000000", 8, std::errc::invalid_argument},
+             {"1970-01-01T24:00:00.000000000", 11, std::errc::invalid_argument},
+             {"1970-01-01T00:60:00.000000000", 14, std::errc::invalid_argument},
+             {"1970-01-01T00:00:60.000000000", 17, std::errc::invalid_argument},
+             {"1970-01-01T00:00:00.000000000 ", 29,
+              std::errc::invalid_argument},
+             {"1970-01-01T00:00:00.000000000ZZ", 30,
+              std::errc::invalid_argument},
+             {"1970-01-01T00:00:00.000000000+01", 32,
+              std::errc::invalid_argument},
+             {"1970-01-01T00:00:00.000000000+0100", 32,
+              std::errc::invalid_argument},
+             {"1970-01-01T00:00:00.000000000+24:00", 30,
+              std::errc::invalid_argument},
+             {"1970-01-01T00:00:00.000000000+00:60", 33,
+              std::errc::invalid_argument},
+             {"2262-04-11T23:47:16.854775808", 29,
+              std::errc::result_out_of_range},
+             {"1677-09-21T00:12:43.145224191", 29,
+              std::errc::result_out_of_range},
+             {"9999-12-31T23:59:59.999999999", 29,
+              std::errc::result_out_of_range},
+             {"0000-01-01T00:00:00.000000000", 29,
+              std::errc::result_out_of_range}}) {
+      const std::string str = s;
+      int64_t value = 42;
+      const auto res = parse(str, value);
+      CHECK(res.ec == ec);
+      CHECK(res.ptr == str.data() + pos);
+      CHECK(value == 42);
+    }
+  }
+}
+
+TEST_CASE("to_chars and from_chars base") {
+  std::mt19937_64 gen(42);
+  for (int base = 2; base <= 36; ++base) {
+    for (uint64_t value :
+         {uint64_t(0), uint64_t(1), uint64_t(base - 1), uint64_t(base),
+          std::numeric_limits<uint64_t>::max(),
+          uint64_t(std::numeric_limits<int64_t>::min()),
+          uint64_t(std::numeric_limits<int32_t>::min()),
+          uint64_t(std::numeric_limits<uint32_t>::max())}) {
+      check_base(value, base);
+      check_base(int64_t(value), base);
+      check_base(uint32_t(value), base);
+      check_base(int32_t(value), base);
+    }
+    for (int i = 0; i < 200; ++i) {
+      const uint64_t value = gen() >> (gen() % 64);
+      check_base(value, base);
+      check_base(-int64_t(value), base);
+      check_base(uint32_t(value), base);
+      check_base(int32_t(value), base);
+    }
+  }
+
+  SECTION("errors") {
+    using namespace rigtorp;
+    std::array<char, 80> buf = {};
+    CHECK(to_chars(buf.begin(), buf.end(), 1, 1).ec ==
+          std::errc::invalid_argument);
+    CHECK(to_chars(buf.begin(), buf.end(), 1, 37).ec ==
+          std::errc::invalid_argument);
+    CHECK(to_chars(buf.begin(), buf.begin() + 7, 0xABCDEF01u, 16).ec ==
+          std::errc::value_too_large);
+
+    uint32_t u = 42;
+    const std::string_view upper = "DEADBEEF";
+    CHECK(from_chars(upper.begin(), upper.end(), u, 16).ec == std::errc{});
+    CHECK(u == 0xDEADBEEF);
+    const std::string_view hex = "12g4";
+    auto r = from_chars(hex.begin(), hex.end(), u, 16);
+    CHECK(r.ec == std::errc::invalid_argument);
+    CHECK(r.ptr == hex.begin() + 2);
+    const std::string_view bin = "1012";
+    r = from_chars(bin.begin(), bin.end(), u, 2);
+    CHECK(r.ec == std::errc::invalid_argument);
+    CHECK(r.ptr == bin.begin() + 3);
+    const std::string_view big = "100000000";
+    r = from_chars(big.begin(), big.end(), u, 16);
+    CHECK(r.ec == std::errc::result_out_of_range);
+    const std::string_view big36 = "1z141z4";
+    r = from_chars(big36.begin(), big36.end(), u, 36);
+    CHECK(r.ec == std::errc::result_out_of_range);
+    const std::string_view neg = "-80000000";
+    int32_t i = 0;
+    CHECK(from_chars(neg.begin(), neg.end(), i, 16).ec == std::errc{});
+    CHECK(i == std::numeric_limits<int32_t>::min());
+    CHECK(from_chars(upper.begin(), upper.end(), i, 16).ec ==
+          std::errc::result_out_of_range);
+    CHECK(from_chars(hex.begin(), hex.end(), u, 0).ec ==
+          std::errc::invalid_argument);
+  }
+
+  static_assert([] {
+    char buf[8] = {};
+    rigtorp::to_chars(buf, buf + 8, uint32_t(0xBEEF), 16);
+    return buf[0] == 'b' && buf[3] == 'f';
+  }());
+}
+
+template <typename T> std::string to_string_128(T value) {
+  const bool negative = std::is_same_v<T, i128> && value < T(0);
+  u128 u = negative ? u128(0) - u128(value) : u128(value);
+  std::string s;
+  do {
+    s += char('0' + u % 10);
+    u /= 10;
+  } while (u != 0);
+  if (negative) {
+    s += '-';
+  }
+  return {s.rbegin(), s.rend()};
+}
+
+template <typename T> void check_128(T value) {
+  const auto expected = to_string_128(value);
+  INFO(expected);
+  std::array<char, 48> buf = {};
+  const auto res = rigtorp::to_chars(buf.begin(), buf.end(), value);
+  CHECK(res.ec == std::errc{});
+  CHECK(std::string_view(buf.data(), res.ptr - buf.data()) == expected);
+  T parsed = 0;
+  const auto r = rigtorp::from_chars(
+      expected.data(), expected.data() + expected.size(), parsed);
+  CHECK(r.ec == std::errc{});
+  CHECK(r.ptr == expected.data() + expected.size());
+  CHECK(parsed == value);
+}
+
+TEST_CASE("to_chars and from_chars 128-bit") {
+  constexpr u128 u128_max = ~u128(0);
+  constexpr i128 i128_max = i128(u128_max >> 1);
+  constexpr i128 i128_min = -i128_max - 1;
+
+  SECTION("limits") {
+    check_128(u128(0));
+    check_128(u128_max);
+    check_128(i128(0));
+    check_128(i128_max);
+    check_128(i128_min);
+    CHECK(to_string_128(u128_max) ==
+          "340282366920938463463374607431768211455");
+    CHECK(to_string_128(i128_min) ==
+          "-170141183460469231731687303715884105728");
+  }
+
+  SECTION("log10") {
+    u128 val = 1;
+    for (int i = 0; i < 38; ++i) {
+      val *= 10;
+      check_128(val);
+      check_128(val - 1);
+      check_128(val + 1);
+      check_128(i128(val));
+      check_128(-i128(val - 1));
+      CHECK(rigtorp::detail::to_chars_len(val) == unsigned(i + 2));
+      CHECK(rigtorp::detail::to_chars_len(val - 1) == unsigned(i + 1));
+    }
+  }
+
+  SECTION("random") {
+    std::mt19937_64 gen(128);
+    for (int i = 0; i < 10000; ++i) {
+      const u128 value = ((u128(gen()) << 64) | gen()) >> (gen() % 128);
+      check_128(value);
+      check_128(i128(value));
+    }
+  }
+
+  SECTION("errors") {
+    std::array<char, 48> buf = {};
+    CHECK(rigtorp::to_chars(buf.begin(), buf.begin() + 38, u128_max).ec ==
+          std::errc::value_too_large);
+    CHECK(rigtorp::to_chars(buf.begin(), buf.begin() + 39, i128_min).ec ==
+          std::errc::value_too_large);
+
+    u128 u = 42;
+    const std::string_view big = "340282366920938463463374607431768211456";
+    auto r = rigtorp::from_chars(big.begin(), big.end(), u);
+    CHECK(r.ec == std::errc::result_out_of_range);
+    CHECK(r.ptr == big.end() - 1);
+    i128 i = 42;
+    const std::string_view small = "-170141183460469231731687303715884105729";
+    r = rigtorp::from_chars(small.begin(), small.end(), i);
+    CHECK(r.ec == std::errc::result_out_of_range);
+    const std::string_view invalid = "12345678901234567890123x5";
+    r = rigtorp::from_chars(invalid.begin(), invalid.end(), u);
+    CHECK(r.ec == std::errc::invalid_argument);
+    CHECK(r.ptr == invalid.begin() + 23);
+  }
+
+  static_assert([] {
+    char buf[40] = {};
+    rigtorp::to_chars(buf, buf + 40, ~u128(0));
+    return buf[0] == '3' && buf[38] == '5';
+  }());
+  static_assert([] {
+    const char s[] = "100000000000000000000000000000000000000";
+    u128 value = 0;
+    rigtorp::from_chars(s, s + sizeof(s) - 1, value);
+    constexpr u128 e19 = UINT64_C(10000000000000000000);
+    return value == e19 * e19;
+  }());
+}
+
+template <typename T, typename Parser>
+rigtorp::from_chars_result parse_with(std::string_view s, T &value) {
+  return rigtorp::detail::from_chars<T, Parser>(s.begin(), s.end(), value);
+}
+
+template <typename T> void check_from_chars_parsers(std::string_view s) {
+  using namespace rigtorp::detail;
+  T a = 123, b = 123;
+  const auto ra = parse_with<T, scalar_digit_parser>(s, a);
+  const auto rb = parse_with<T, swar_digit_parser>(s, b);
+  INFO(s);
+  CHECK(ra.ec == rb.ec);
+  CHECK(ra.ptr == rb.ptr);
+  CHECK(a == b);
+}
+
+constexpr uint64_t constexpr_from_chars(std::string_view s) {
+  uint64_t value = 0;
+  rigtorp::detail::from_chars(s.begin(), s.end(), value);
+  return value;
+}
+
+template <typename CharT>
+static std::basic_string<CharT> widen(const std::string &s) {
+  return {s.begin(), s.end()};
+}
+
+// Checks that to_chars and from_chars on CharT code units give the same
+// results as on char.
+template <typename CharT, typename T>
+static void check_code_units(T value, const std::vector<std::string> &inputs,
+                             const std::vector<uint32_t> &non_ascii) {
+  std::array<char, 48> buf;
+  std::array<CharT, 48> wbuf;
+  const auto r1 = rigtorp::to_chars(buf.data(), buf.data() + buf.size(), value);
+  const auto r2 =
+      rigtorp::to_chars(wbuf.data(), wbuf.data() + wbuf.size(), value);
+  REQUIRE(r2.ec == std::errc{});
+  REQUIRE(std::basic_string<CharT>(wbuf.data(), r2.ptr) ==
+          widen<CharT>(std::string(buf.data(), r1.ptr)));
+  const auto len = r2.ptr - wbuf.data();
+  const auto r3 = rigtorp::to_chars(wbuf.data(), wbuf.data() + len - 1, value);
+  CHECK(r3.ec == std::errc::value_too_large);
+  CHECK(r3.ptr == wbuf.data() + len - 1);
+
+  auto check_parse = [](const std::string &s,
+                        const std::basic_string<CharT> &ws) {
+    T v1 = 42, v2 = 42;
+    const auto p1 = rigtorp::from_chars(s.data(), s.data() + s.size(), v1);
+    const auto p2 = rigtorp::from_chars(ws.data(), ws.data() + ws.size(), v2);
+    INFO(s);
+    REQUIRE(p2.ec == p1.ec);
+    REQUIRE(p2.ptr - ws.data() == p1.ptr - s.data());
+    REQUIRE(v2 == v1);
+  };
+  for (const auto &s : inputs) {
+    check_parse(s, widen<CharT>(s));
+    // A code unit that is not a single byte is not a digit.
+    for (size_t i = 0; i < s.size(); ++i) {
+      for (const uint32_t c : non_ascii) {
+        if (sizeof(CharT) < 4 && c > 0xFFFF) {
+          continue;
+        }
+        std::string t = s;
+        t[i] = 'x';
+        auto wt = widen<CharT>(s);
+        wt[i] = CharT(c);
+        check_parse(t, wt);
+      }
+    }
+  }
+}
+
+template <typename CharT> static void check_code_units() {
+  std::vector<std::string> inputs = {"",
+                                     "-",
+                                     "0",
+                                     "-0",
+                                     "+1",
+                                     "00000000000000000000000000000000012",
+                                     "12345678",
+                                     "-123456789012345678",
+                                     "18446744073709551615",
+                                     "18446744073709551616",
+                                     "-9223372036854775809",
+                                     "340282366920938463463374607431768211456",
+                                     "1234567890123456789012345678901234567",
+                                     "1234 5678"};
+  const std::vector<uint32_t> non_ascii = {
+      '5' + 0x100, '5' + 0xFF00, 0xFF15, '5' + 0x10000, 0xFFFFFF35};
+  std::mt19937_64 gen(1);
+  for (int i = 0; i < 1000; ++i) {
+    const u128 x = (u128(gen()) << 64 | gen()) >> (gen() % 128);
+    check_code_units<CharT>(int32_t(x), {}, {});
+    check_code_units<CharT>(uint32_t(x), {}, {});
+    check_code_units<CharT>(int64_t(x), {}, {});
+    check_code_units<CharT>(uint64_t(x), {}, {});
+    check_code_units<CharT>(i128(x), {}, {});
+    check_code_units<CharT>(x, {}, {});
+  }
+  check_code_units<CharT>(std::numeric_limits<int32_t>::min(), inputs,
+                          non_ascii);
+  check_code_units<CharT>(std::numeric_limits<uint32_t>::max(), inputs,
+                          non_ascii);
+  check_code_units<CharT>(std::numeric_limits<int64_t>::min(), inputs,
+                          non_ascii);
+  check_code_units<CharT>(std::numeric_limits<uint64_t>::max(), inputs,
+                          non_ascii);
+  check_code_units<CharT>(i128(~u128(0) >> 1), inputs, non_ascii);
+  check_code_units<CharT>(~u128(0), inputs, non_ascii);
+}
+
+TEST_CASE("code units") {
+  check_code_units<char16_t>();
+  check_code_units<char32_t>();
+  check_code_units<wchar_t>();
+#if defined(__cpp_char8_t)
+  check_code_units<char8_t>();
+#endif
+}
+
+TEST_CASE("from_chars parsers") {
+  static_assert(constexpr_from_chars("12345678901234567") ==
+                12345678901234567);
+
+  SECTION("lengths") {
+    std::string s;
+    for (int i = 0; i < 32; ++i) {
+      s += char('1' + i % 9);
+      check_from_chars_parsers<int32_t>(s);
+      check_from_chars_parsers<uint32_t>(s);
+      check_from_chars_parsers<int64_t>(s);
+      check_from_chars_parsers<uint64_t>(s);
+      check_from_chars_parsers<int64_t>("-" + s);
+    }
+    for (int i = 0; i < 48; ++i) {
+      s += char('1' + i % 9);
+      check_from_chars_parsers<u128>(s.substr(0, i + 1));
+      check_from_chars_parsers<i128>("-" + s.substr(0, i + 1));
+    }
+  }
+
+  SECTION("invalid") {
+    for (int len = 1; len < 24; ++len) {
+      for (int pos = 0; pos < len; ++pos) {
+        for (char c : {'/', ':', 'a', ' ', '\0', '\xb0'}) {
+          std::string s(len, '7');
+          s[pos] = c;
+          check_from_chars_parsers<uint32_t>(s);
+          check_from_chars_parsers<uint64_t>(s);
+          check_from_chars_parsers<int64_t>(s);
+        }
+      }
+    }
+    for (int len = 1; len < 44; ++len) {
+      for (int pos = 0; pos < len; ++pos) {
+        std::string s(len, '3');
+        s[pos] = ':';
+        check_from_chars_parsers<u128>(s);
+      }
+    }
+  }
+
+  SECTION("overflow") {
+    check_from_chars_parsers<uint32_t>("4294967296");
+    check_from_chars_parsers<uint32_t>("42949672950");
+    check_from_chars_parsers<int32_t>("-2147483649");
+    check_from_chars_parsers<uint64_t>("18446744073709551616");
+    check_from_chars_parsers<uint64_t>("18446744073709551615");
+    check_from_chars_parsers<uint64_t>("99999999999999999999999");
+    check_from_chars_parsers<int64_t>("-9223372036854775809");
+    check_from_chars_parsers<int64_t>("00000000009223372036854775808");
+    check_from_chars_parsers<u128>("340282366920938463463374607431768211456");
+    check_from_chars_parsers<u128>("340282366920938463463374607431768211455");
+    check_from_chars_parsers<u128>("3402823669209384634633746074317682114550");
+    check_from_chars_parsers<i128>("-170141183460469231731687303715884105729");
+  }
+}
+
+template <typename T> std::vector<T> random_ints(size_t n) {
+  std::mt19937_64 gen(n);
+  std::vector<T> v(n);
+  for (auto &x : v) {
+    x = static_cast<T>(gen() >> (gen() % (sizeof(uint64_t) * 8)));
+    if (std::is_signed_v<T> && gen() % 2) {
+      x = static_cast<T>(-x);
+    }
+  }
+  v.push_back(std::numeric_limits<T>::min());
+  v.push_back(std::numeric_limits<T>::max());
+  return v;
+}
+
+template <typename T> void check_to_chars_many(size_t n) {
+  const auto v = random_ints<T>(n);
+  std::string expected;
+  std::vector<size_t> expected_offsets;
+  for (const auto &x : v) {
+    if (!expected.empty()) {
+      expected += ',';
+    }
+    expected_offsets.push_back(expected.size());
+    expected += std::to_string(x);
+  }
+
+  std::vector<char> buf(expected.size() + 64, '*');
+  std::vector<size_t> offsets(v.size());
+  auto res = rigtorp::to_chars_many(buf.data(), buf.data() + buf.size(),
+                                    v.data(), v.data() + v.size(), ',',
+                                    offsets.data());
+  REQUIRE(res.ec == std::errc{});
+  CHECK(std::string_view(buf.data(), res.ptr - buf.data()) == expected);
+  CHECK(offsets == expected_offsets);
+
+  for (size_t len = 0; len <= expected.size(); ++len) {
+    std::vector<char> small(len + 64, '*');
+    res = rigtorp::to_chars_many(small.data(), small.data() + len, v.data(),
+                                 v.data() + v.size(), ',', nullptr);
+    INFO(len);
+    if (len == expected.size()) {
+      CHECK(res.ec == std::errc{});
+      CHECK(std::string_view(small.data(), len) == expected);
+    } else {
+      CHECK(res.ec == std::errc::value_too_large);
+    }
+    CHECK(std::all_of(small.begin() + len, small.end(),
+                      [](char c) { return c == '*'; }));
+  }
+}
+
+TEST_CASE("to_chars_many") {
+  for (size_t n : {0, 1, 2, 3, 4, 5, 7, 8, 9, 31}) {
+    check_to_chars_many<int32_t>(n);
+    check_to_chars_many<uint32_t>(n);
+    check_to_chars_many<int64_t>(n);
+    check_to_chars_many<uint64_t>(n);
+  }
+
+  SECTION("all lengths") {
+    std::vector<uint64_t> v;
+    uint64_t val = 1;
+    for (int i = 0; i < 20; ++i) {
+      v.push_back(val - 1);
+      v.push_back(val);
+      v.push_back(val + 1);
+      val *= 10;
+    }
+    std::string expected;
+    for (const auto &x : v) {
+      expected += std::to_string(x) + '\n';
+    }
+    expected.pop_back();
+    std::vector<char> buf(1024);
+    const auto res = rigtorp::to_chars_many(
+        buf.data(), buf.data() + buf.size(), v.data(), v.data() + v.size(),
+        '\n');
+    CHECK(res.ec == std::errc{});
+    CHECK(std::string_view(buf.data(), res.ptr - buf.data()) == expected);
+  }
+}
+
+template <typename T>
+void check_from_chars_many(std::string_view s, size_t capacity = 1024) {
+  std::vector<T> expected;
+  rigtorp::from_chars_many_result expected_res = {nullptr, {}, 0};
+  const auto is_delim = [](char c) {
+    return c == ',' || c == ' ' || c == '\n' || c == '\r' || c == '\t';
+  };
+  for (auto p = s.begin(); p != s.end() && capacity != 0;) {
+    if (is_delim(*p)) {
+      ++p;
+      continue;
+    }
+    auto q = std::find_if(p, s.end(), is_delim);
+    T value;
+    const auto r = rigtorp::from_chars(p, q, value);
+    if (r.ec != std::errc{}) {
+      expected_res = {r.ptr, r.ec, expected.size()};
+      break;
+    }
+    expected.push_back(value);
+    if (expected.size() == capacity) {
+      expected_res = {q, {}, expected.size()};
+      break;
+    }
+    p = q;
+  }
+  if (capacity == 0) {
+    expected_res = {s.begin(), {}, 0};
+  } else if (expected_res.ptr == nullptr) {
+    expected_res = {s.end(), {}, expected.size()};
+  }
+
+  std::vector<T> values(capacity);
+  const auto res = rigtorp::from_chars_many(
+      s.begin(), s.end(), values.data(), values.data() + values.size());
+  INFO(s);
+  CHECK(res.ec == expected_res.ec);
+  CHECK(res.ptr == expected_res.ptr);
+  REQUIRE(res.count == expected_res.count);
+  values.resize(res.count);
+  CHECK(values == expected);
+}
+
+TEST_CASE("from_chars_many") {
+  check_from_chars_many<int32_t>("");
+  check_from_chars_many<int32_t>(" ,\n");
+  check_from_chars_many<int32_t>("123,456\n");
+  check_from_chars_many<int32_t>("-1 2\t3\r\n-4,, 5");
+  check_from_chars_many<int32_t>("1,2,3,4", 0);
+  check_from_chars_many<int32_t>("1,2,3,4", 2);
+  check_from_chars_many<uint32_t>("1,-2,3");
+  check_from_chars_many<uint32_t>("1,2x,3");
+  check_from_chars_many<int32_t>("1,2147483648,3");
+
+  {
+    // Empty fields are skipped.
+    const std::string_view s = "1,,2,\n,3";
+    int32_t values[4] = {};
+    const auto res =
+        rigtorp::from_chars_many(s.begin(), s.end(), values, values + 4);
+    CHECK(res.ec == std::errc{});
+    CHECK(res.ptr == s.end());
+    CHECK(res.count == 3);
+    CHECK(values[0] == 1);
+    CHECK(values[1] == 2);
+    CHECK(values[2] == 3);
+  }
+
+  std::mt19937 gen(42);
+  const std::string_view delims = ", \n\r\t";
+  for (int i = 0; i < 200; ++i) {
+    std::string s;
+    const int n = gen() % 64;
+    for (int j = 0; j < n; ++j) {
+      const int ndelims = gen() % 3;
+      for (int k = 0; k < ndelims + (j != 0); ++k) {
+        s += delims[gen() % delims.size()];
+      }
+      if (gen() % 2) {
+        s += '-';
+      }
+      const int digits = 1 + gen() % 24;
+      for (int k = 0; k < digits; ++k) {
+        s += char('0' + gen() % 10);
+      }
+      if (gen() % 200 == 0) {
+        s += 'x';
+      }
+    }
+    check_from_chars_many<int32_t>(s);
+    check_from_chars_many<uint32_t>(s);
+    check_from_chars_many<int64_t>(s);
+    check_from_chars_many<uint64_t>(s);
+    check_from_chars_many<int64_t>(s, gen() % 16);
+  }
+}
+
+// Checks that the kernels selected by dispatch produce the same output as
+// the header versions compiled for this translation unit.
+template <typename T> void check_dispatch(std::string_view s, size_t n) {
+  const auto v = random_ints<T>(n);
+  std::vector<char> buf(v.size() * 21 + 64, '*');
+  std::vector<char> expected_buf = buf;
+  std::vector<size_t> offsets(v.size()), expected_offsets(v.size());
+  for (size_t len : {buf.size(), v.size() * 2}) {
+    const auto res = rigtorp::dispatch::to_chars_many(
+        buf.data(), buf.data() + len, v.data(), v.data() + v.size(), ',',
+        offsets.data());
+    const auto expected_res = rigtorp::to_chars_many(
+        expected_buf.data(), expected_buf.data() + len, v.data(),
+        v.data() + v.size(), ',', expected_offsets.data());
+    INFO(len);
+    CHECK(res.ec == expected_res.ec);
+    CHECK(res.ptr - buf.data() == expected_res.ptr - expected_buf.data());
+    if (res.ec == std::errc{}) {
+      CHECK(std::string_view(buf.data(), res.ptr - buf.data()) ==
+            std::string_view(expected_buf.data(),
+                             expected_res.ptr - expected_buf.data()));
+      CHECK(offsets == expected_offsets);
+    }
+  }
+
+  std::vector<T> values(n), expected_values(n);
+  const auto res = rigtorp::dispatch::from_chars_many(
+      s.begin(), s.end(), values.data(), values.data() + values.size());
+  const auto expected_res = rigtorp::from_chars_many(
+      s.begin(), s.end(), expected_values.data(),
+      expected_values.data() + expected_values.size());
+  INFO(s);
+  CHECK(res.ec == expected_res.ec);
+  CHECK(res.ptr == expected_res.ptr);
+  REQUIRE(res.count == expected_res.count);
+  values.resize(res.count);
+  expected_values.resize(res.count);
+  CHECK(values == expected_values);
+}
+
+TEST_CASE("dispatch", "[dispatch]") {
+  using rigtorp::dispatch::isa;
+  const isa level = rigtorp::dispatch::selected_isa();
+  INFO(int(level));
+  if (const char *env = std::getenv("RIGTORP_CHARCONV_ISA")) {
+    if (std::strcmp(env, "generic") == 0) {
+      CHECK(level == isa::generic);
+    } else if (std::strcmp(env, "sse4.1") == 0) {
+      CHECK(level <= isa::sse41);
+    }
+  }
+  std::mt19937 gen(42);
+  const std::string_view delims = ", \n\r\t";
+  for (int i = 0; i < 200; ++i) {
+    std::string s;
+    const int n = gen() % 128;
+    for (int j = 0; j < n; ++j) {
+      s += delims[gen() % delims.size()];
+      if (gen() % 2) {
+        s += '-';
+      }
+      const int digits = 1 + gen() % 20;
+      for (int k = 0; k < digits; ++k) {
+        s += char('0' + gen() % 10);
+      }
+      if (gen() % 200 == 0) {
+        s += 'x';
+      }
+    }
+    check_dispatch<int32_t>(s, n);
+    check_dispatch<uint32_t>(s, n);
+    check_dispatch<int64_t>(s, n);
+    check_dispatch<uint64_t>(s, n);
+  }
+}
+
+// Feeds s in random sized chunks through outputs of the given capacity and
+// checks the result against from_chars_many on the whole input.
+template <typename T, typename Stream = rigtorp::from_chars_stream<T>>
+void check_from_chars_stream(std::string_view s, std::mt19937 &gen,
+                             size_t capacity) {
+  std::vector<T> expected(s.size() + 1);
+  const auto expected_res = rigtorp::from_chars_many(
+      s.begin(), s.end(), expected.data(), expected.data() + expected.size());
+  expected.resize(expected_res.count);
+
+  Stream stream;
+  std::vector<T> values;
+  std::vector<T> out(capacity);
+  rigtorp::from_chars_many_result res = {s.begin(), {}, 0};
+  const char *first = s.begin();
+  while (first != s.end() && res.ec == std::errc{}) {
+    const size_t len = std::min<size_t>(1 + gen() % 16, s.end() - first);
+    const char *last = first + len;
+    while (res.ec == std::errc{} && first != last) {
+      res = stream.feed(first, last, out.data(), out.data() + out.size());
+      values.insert(values.end(), out.begin(), out.begin() + res.count);
+      first = res.ptr;
+    }
+  }
+  if (res.ec == std::errc{}) {
+    res = stream.finish(out.data(), out.data() + out.size());
+    values.insert(values.end(), out.begin(), out.begin() + res.count);
+    if (res.ec != std::errc{}) {
+      CHECK(res.ptr == nullptr);
+      res.ptr = s.end();
+    }
+  }
+  INFO(s);
+  CHECK(res.ec == expected_res.ec);
+  if (res.ec != std::errc{}) {
+    CHECK(res.ptr == expected_res.ptr);
+  }
+  CHECK(values == expected);
+}
+
+template <typename T, bool Dispatch = false>
+void check_from_chars_parallel(std::string_view s, unsigned threads,
+                               size_t block_size) {
+  std::vector<T> expected(s.size() + 1);
+  const auto expected_res = rigtorp::from_chars_many(
+      s.begin(), s.end(), expected.data(), expected.data() + expected.size());
+  expected.resize(expected_res.count);
+
+  std::vector<T> values = {42};
+  rigtorp::from_chars_many_result res;
+  if constexpr (Dispatch) {
+    res = rigtorp::dispatch::from_chars_parallel(s.begin(), s.end(), values,
+                                                 threads, block_size);
+  } else {
+    res = rigtorp::from_chars_parallel(s.begin(), s.end(), values, threads,
+                                       block_size);
+  }
+  INFO(s);
+  INFO(block_size);
+  CHECK(res.ec == expected_res.ec);
+  CHECK(res.ptr == expected_res.ptr);
+  CHECK(res.count == expected_res.count);
+  expected.insert(expected.begin(), 42);
+  CHECK(values == expected);
+}
+
+TEST_CASE("from_chars_parallel") {
+  check_from_chars_parallel<int32_t>("", 4, 8);
+  check_from_chars_parallel<int32_t>("1", 4, 8);
+  check_from_chars_parallel<int32_t>("123456789012,1", 4, 4);
+  check_from_chars_parallel<int32_t>("1,22,333", 2, 0);
+
+  std::mt19937 gen(13);
+  const std::string_view delims = ", \n\r\t";
+  for (int i = 0; i < 200; ++i) {
+    std::string s;
+    const int n = gen() % 256;
+    for (int j = 0; j < n; ++j) {
+      const int ndelims = gen() % 3;
+      for (int k = 0; k < ndelims + (j != 0); ++k) {
+        s += delims[gen() % delims.size()];
+      }
+      if (gen() % 2) {
+        s += '-';
+      }
+      const int digits = 1 + gen() % 24;
+      for (int k = 0; k < digits; ++k) {
+        s += char('0' + gen() % 10);
+      }
+      if (gen() % 1000 == 0) {
+        s += 'x';
+      }
+    }
+    const unsigned threads = 1 + gen() % 4;
+    const size_t block_size = 1 + gen() % 64;
+    check_from_chars_parallel<int32_t>(s, threads, block_size);
+    check_from_chars_parallel<uint64_t>(s, threads, block_size);
+    check_from_chars_parallel<int64_t>(s, threads, block_size);
+  }
+
+  SECTION("file") {
+    char path[] = "/tmp/CharConvTestXXXXXX";
+    const int fd = mkstemp(path);
+    REQUIRE(fd != -1);
+    const std::string_view s = "1,2\n-3 4\n5x\n";
+    REQUIRE(write(fd, s.data(), s.size()) == ssize_t(s.size()));
+    close(fd);
+    std::vector<int32_t> values;
+    auto res = rigtorp::from_chars_file(path, values);
+    CHECK(res.ec == std::errc::invalid_argument);
+    CHECK(res.offset == 10);
+    CHECK(res.count == 4);
+    CHECK(values == std::vector<int32_t>{1, 2, -3, 4});
+    unlink(path);
+    res = rigtorp::from_chars_file(path, values);
+    CHECK(res.ec == std::errc::no_such_file_or_directory);
+  }
+}
+
+TEST_CASE("dispatch bulk parsers", "[dispatch]") {
+  using namespace rigtorp;
+  INFO(int(dispatch::selected_isa()));
+  std::mt19937 gen(17);
+  const std::string_view delims = ", \n\r\t";
+  for (int i = 0; i < 100; ++i) {
+    std::string s;
+    const int n = gen() % 256;
+    for (int j = 0; j < n; ++j) {
+      s += delims[gen() % delims.size()];
+      if (gen() % 2) {
+        s += '-';
+      }
+      const int digits = 1 + gen() % 20;
+      for (int k = 0; k < digits; ++k) {
+        s += char('0' + gen() % 10);
+      }
+      if (gen() % 1000 == 0) {
+        s += 'x';
+      }
+    }
+    const unsigned threads = 1 + gen() % 4;
+    const size_t block_size = 1 + gen() % 256;
+    check_from_chars_parallel<int32_t, true>(s, threads, block_size);
+    check_from_chars_parallel<uint32_t, true>(s, threads, block_size);
+    check_from_chars_parallel<int64_t, true>(s, threads, block_size);
+    check_from_chars_parallel<uint64_t, true>(s, threads, block_size);
+    check_from_chars_stream<int32_t, dispatch::from_chars_stream<int32_t>>(
+        s, gen, 64);
+    check_from_chars_stream<uint64_t, dispatch::from_chars_stream<uint64_t>>(
+        s, gen, 64);
+  }
+
+  char path[] = "/tmp/CharConvTestXXXXXX";
+  const int fd = mkstemp(path);
+  REQUIRE(fd != -1);
+  const std::string_view s = "1,2\n-3 4\n5x\n";
+  REQUIRE(write(fd, s.data(), s.size()) == ssize_t(s.size()));
+  close(fd);
+  std::vector<int64_t> values;
+  const auto res = dispatch::from_chars_file(path, values);
+  unlink(path);
+  CHECK(res.ec == std::errc::invalid_argument);
+  CHECK(res.offset == 10);
+  CHECK(res.count == 4);
+  CHECK(values == std::vector<int64_t>{1, 2, -3, 4});
+}
+
+TEST_CASE("from_chars_stream") {
+  using namespace rigtorp;
+
+  SECTION("split") {
+    const std::string_view s = "12 -345,6789\n-2147483648 4294967295 0,";
+    for (size_t i = 0; i <= s.size(); ++i) {
+      from_chars_stream<int64_t> stream;
+      std::vector<int64_t> values;
+      const auto push = [&](int64_t x) { values.push_back(x); };
+      CHECK(stream.feed(s.begin(), s.begin() + i, push).ec == std::errc{});
+      CHECK(stream.feed(s.begin() + i, s.end(), push).ec == std::errc{});
+      CHECK(!stream.pending());
+      CHECK(stream.finish(push).ec == std::errc{});
+      CHECK(values == std::vector<int64_t>{12, -345, 6789, -2147483648,
+                                           4294967295, 0});
+    }
+  }
+
+  SECTION("errors") {
+    from_chars_stream<int32_t> stream;
+    int32_t value = 0;
+    const std::string_view a = "1 21474";
+    const std::string_view b = "83648 3";
+    auto res = stream.feed(a.begin(), a.end(), &value, &value + 1);
+    CHECK(res.ec == std::errc{});
+    CHECK(res.ptr == a.begin() + 1);
+    CHECK(value == 1);
+    res = stream.feed(res.ptr, a.end(), &value, &value + 1);
+    CHECK(res.ec == std::errc{});
+    CHECK(res.count == 0);
+    CHECK(stream.pending());
+    res = stream.feed(b.begin(), b.end(), &value, &value + 1);
+    CHECK(res.ec == std::errc::result_out_of_range);
+    CHECK(res.ptr == b.begin() + 5);
+
+    stream.reset();
+    const std::string_view c = "7 -";
+    res = stream.feed(c.begin(), c.end(), &value, &value + 1);
+    CHECK(res.count == 1);
+    CHECK(value == 7);
+    res = stream.feed(res.ptr, c.end(), &value, &value + 1);
+    CHECK(res.count == 0);
+    res = stream.finish(&value, &value + 1);
+    CHECK(res.ec == std::errc::invalid_argument);
+    CHECK(res.ptr == nullptr);
+    CHECK(res.count == 0);
+
+    stream.reset();
+    const std::string_view d = "429496729";
+    const std::string_view e = "6x ";
+    stream.feed(d.begin(), d.end(), [](int32_t) {});
+    const auto r = stream.feed(e.begin(), e.end(), [](int32_t) {});
+    CHECK(r.ec == std::errc::result_out_of_range);
+    CHECK(r.ptr == e.begin());
+  }
+
+  SECTION("random") {
+    std::mt19937 gen(12);
+    const std::string_view delims = ", \n\r\t";
+    for (int i = 0; i < 500; ++i) {
+      std::string s;
+      const int n = gen() % 64;
+      for (int j = 0; j < n; ++j) {
+        const int ndelims = gen() % 3;
+        for (int k = 0; k < ndelims + (j != 0); ++k) {
+          s += delims[gen() % delims.size()];
+        }
+        if (gen() % 2) {
+          s += '-';
+        }
+        const int digits = gen() % 24;
+        for (int k = 0; k < digits; ++k) {
+          s += char('0' + gen() % 10);
+        }
+        if (gen() % 200 == 0) {
+          s += 'x';
+        }
+      }
+      check_from_chars_stream<int32_t>(s, gen, 1 + gen() % 4);
+      check_from_chars_stream<uint32_t>(s, gen, 64);
+      check_from_chars_stream<int64_t>(s, gen, 1 + gen() % 4);
+      check_from_chars_stream<uint64_t>(s, gen, 64);
+    }
+  }
+}
+
+TEST_CASE("char_writer") {
+  using namespace rigtorp;
+
+  SECTION("string") {
+    std::string s = "x";
+    {
+      char_writer<string_backend<std::string>> w(s);
+      for (int i = 0; i < 1000; ++i) {
+        REQUIRE(w.reserve(3 * max_chars<int64_t> + 4) == std::errc{});
+        w.append(int64_t(-i) * 1000000007);
+        w.append(',');
+        w.append(uint32_t(i));
+        w.append(std::string_view(" | "));
+      }
+      w.append_external("end");
+    }
+    std::string expected = "x";
+    for (int i = 0; i < 1000; ++i) {
+      expected += std::to_string(int64_t(-i) * 1000000007) + ',' +
+                  std::to_string(i) + " | ";
+    }
+    expected += "end";
+    CHECK(s == expected);
+  }
+
+  SECTION("vector") {
+    std::vector<char> v;
+    char_writer<string_backend<std::vector<char>>> w(v);
+    REQUIRE(w.reserve(max_chars<double> + max_chars<float> + 1) ==
+            std::errc{});
+    w.append(0.1);
+    w.append(' ');
+    w.append(-1.5f);
+    w.flush();
+    CHECK(std::string(v.begin(), v.end()) == "0.1 -1.5");
+  }
+
+  SECTION("append after flush") {
+    std::string s;
+    {
+      char_writer<string_backend<std::string>> w(s);
+      w.append(std::string_view("123,"));
+      w.flush();
+      CHECK(s == "123,");
+      REQUIRE(w.reserve(8) == std::errc{});
+      w.append(456);
+      w.append('\n');
+      w.flush();
+      CHECK(s == "123,456\n");
+      w.append_external("end");
+    }
+    CHECK(s == "123,456\nend");
+  }
+
+  SECTION("fd") {
+    char path[] = "/tmp/CharConvTestXXXXXX";
+    const int fd = mkstemp(path);
+    REQUIRE(fd != -1);
+    unlink(path);
+    std::string expected;
+    {
+      char_writer<fd_backend<64, 4>> w(fd);
+      CHECK(w.reserve(65) == std::errc::value_too_large);
+      const std::string external(100, 'e');
+      for (int i = 0; i < 100; ++i) {
+        REQUIRE(w.reserve(max_chars<uint64_t> + 1) == std::errc{});
+        w.append(uint64_t(i) * 12345678901);
+        w.append('\n');
+        expected += std::to_string(uint64_t(i) * 12345678901) + '\n';
+        if (i % 10 == 0) {
+          REQUIRE(w.append_external(external) == std::errc{});
+          expected += external;
+        }
+      }
+      CHECK(w.flush() == std::errc{});
+    }
+    std::string actual(expected.size() + 1, 0);
+    CHECK(pread(fd, actual.data(), actual.size(), 0) ==
+          ssize_t(expected.size()));
+    actual.resize(expected.size());
+    CHECK(actual == expected);
+    close(fd);
+
+    char_writer<fd_backend<64>> w(-1);
+    w.append('x');
+    CHECK(w.flush() == std::errc::bad_file_descriptor);
+  }
+
+  SECTION("fd append_external every value") {
+    char path[] = "/tmp/CharConvTestXXXXXX";
+    const int fd = mkstemp(path);
+    REQUIRE(fd != -1);
+    unlink(path);
+    std::string expected;
+    {
+      char_writer<fd_backend<64, 3>> w(fd);
+      const std::string_view external = "e|";
+      for (int i = 0; i < 100; ++i) {
+        REQUIRE(w.reserve(max_chars<uint32_t> + 1) == std::errc{});
+        w.append(uint32_t(i) * 7919);
+        w.append('\n');
+        REQUIRE(w.append_external(external) == std::errc{});
+        expected += std::to_string(i * 7919) + '\n';
+        expected += external;
+      }
+      CHECK(w.flush() == std::errc{});
+    }
+    std::string actual(expected.size() + 1, 0);
+    CHECK(pread(fd, actual.data(), actual.size(), 0) ==
+          ssize_t(expected.size()));
+    actual.resize(expected.size());
+    CHECK(actual == expected);
+    close(fd);
+  }
+}
+
+static constexpr char format_record[] = "px={} qty={} side={}\n";
+static constexpr char format_braces[] = "{{{}}}";
+static constexpr char format_literal[] = "no fields";
+static constexpr char format_empty[] = "";
+
+TEST_CASE("format_to") {
+  using namespace rigtorp;
+
+  static_assert(format_max_size<format_record, int64_t, uint32_t, char> ==
+                3 + 20 + 5 + 10 + 6 + 1 + 1);
+  static_assert(format_max_size<format_braces, int16_t> == 2 + 11);
+  static_assert(format_max_size<format_empty> == 0);
+
+  std::array<char, 64> buf;
+  auto format = [&](auto res) {
+    REQUIRE(res.ec == std::errc{});
+    return std::string(buf.data(), res.ptr);
+  };
+
+  CHECK(format(format_to<format_record>(buf.data(), buf.data() + buf.size(),
+                                        int64_t(-12345), uint32_t(100),
+                                        'B')) == "px=-12345 qty=100 side=B\n");
+  CHECK(format(format_to<format_record>(
+            buf.data(), buf.data() + buf.size(),
+            std::numeric_limits<int64_t>::min(),
+            std::numeric_limits<uint32_t>::max(), 'S')) ==
+        "px=-9223372036854775808 qty=4294967295 side=S\n");
+  CHECK(format(format_to<format_braces>(buf.data(), buf.data() + buf.size(),
+                                        int16_t(-7))) == "{-7}");
+  CHECK(format(format_to<format_literal>(
+            buf.data(), buf.data() + buf.size())) == "no fields");
+  CHECK(format(format_to<format_empty>(buf.data(), buf.data())) == "");
+
+  std::mt19937_64 gen(1);
+  for (int i = 0; i < 10000; ++i) {
+    const int64_t px = gen();
+    const uint32_t qty = gen() >> (gen() % 64);
+    const auto res = format_to<format_record>(
+        buf.data(), buf.data() + buf.size(), px, qty, 'B');
+    REQUIRE(res.ec == std::errc{});
+    REQUIRE(std::string(buf.data(), res.ptr) ==
+            "px=" + std::to_string(px) + " qty=" + std::to_string(qty) +
+                " side=B\n");
+  }
+
+  // Buffers smaller than the maximum size fall back to a temporary buffer.
+  const std::string expected = "px=1 qty=2 side=B\n";
+  for (size_t n = 0; n <= expected.size(); ++n) {
+    std::string out(n, 'x');
+    const auto res = format_to<format_record>(out.data(), out.data() + n,
+                                              int64_t(1), uint32_t(2), 'B');
+    if (n < expected.size()) {
+      CHECK(res.ec == std::errc::value_too_large);
+      CHECK(res.ptr == out.data() + n);
+      CHECK(out == std::string(n, 'x'));
+    } else {
+      CHECK(res.ec == std::errc{});
+      CHECK(out == expected);
+    }
+  }
+}
+
 TEST_CASE("all", "[.]") {
   for (int32_t i = std::numeric_limits<int32_t>::min();
        i < std::numeric_limits<int32_t>::max(); ++i) {